@@ -0,0 +1,403 @@
+//This file is part of Bertini 2.
+//
+//benchmark/harness.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/harness.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/harness.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/harness.hpp
+
+\brief A small harness for registering and running benchmarks, in the style of Google Benchmark, without depending on it.
+
+A benchmark is a function of a State, which does its setup, then loops while the state says to keep running, timing only the loop.
+
+\code
+Register("complex/mul/dbl", [](State & state)
+{
+	dbl a(1,2), b(3,4);
+	while (state.KeepRunning())
+		DoNotOptimize(a *= b);
+});
+
+int main(int argc, char** argv)
+{
+	return RunBenchmarks(argc, argv);
+}
+\endcode
+
+The number of iterations grows until the loop runs for a minimum time, unless the benchmark fixes it.  Results are printed as a table, and with `--json=<file>` are also written in the JSON format of Google Benchmark, so the tools which compare its runs can compare these.  Programs built on the harness take
+
+  --filter=<substring>   run only the benchmarks whose names contain the substring
+  --min_time=<seconds>   the minimum time to run each benchmark, 0.5 by default
+  --json=<file>          also write the results to a file, as JSON
+*/
+
+#ifndef BERTINI_BENCHMARK_HARNESS_HPP
+#define BERTINI_BENCHMARK_HARNESS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bertini {
+namespace benchmark {
+
+	/**
+	\brief Keeps the compiler from discarding a computation whose result is otherwise unused.
+	*/
+	template<typename T>
+	inline
+	void DoNotOptimize(T const& value)
+	{
+		asm volatile("" : : "r,m"(value) : "memory");
+	}
+
+
+	/**
+	\brief The loop state of one run of a benchmark.
+	*/
+	class State
+	{
+	public:
+		explicit
+		State(std::uint64_t iterations) : remaining_(iterations), iterations_(iterations)
+		{}
+
+		/**
+		\brief True while there are iterations left to run.  The clock starts at the first call, and stops at the last.
+		*/
+		bool KeepRunning()
+		{
+			if (!started_)
+			{
+				started_ = true;
+				cpu_start_ = std::clock();
+				start_ = Clock::now();
+			}
+			if (remaining_ > 0)
+			{
+				--remaining_;
+				return true;
+			}
+			Stop();
+			return false;
+		}
+
+		std::uint64_t Iterations() const
+		{
+			return iterations_;
+		}
+
+		double RealSeconds() const
+		{
+			return real_seconds_;
+		}
+
+		double CPUSeconds() const
+		{
+			return cpu_seconds_;
+		}
+
+		/**
+		\brief Numbers reported alongside the times, such as the number of paths a solve tracked.  They are reported as given, not per iteration.
+		*/
+		std::map<std::string, double> counters;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		void Stop()
+		{
+			if (stopped_)
+				return;
+			stopped_ = true;
+			real_seconds_ = std::chrono::duration<double>(Clock::now() - start_).count();
+			cpu_seconds_ = static_cast<double>(std::clock() - cpu_start_) / CLOCKS_PER_SEC;
+		}
+
+		std::uint64_t remaining_;
+		std::uint64_t iterations_;
+		bool started_ = false;
+		bool stopped_ = false;
+		Clock::time_point start_;
+		std::clock_t cpu_start_ = 0;
+		double real_seconds_ = 0;
+		double cpu_seconds_ = 0;
+	};
+
+
+	/**
+	\brief A registered benchmark.  The setters return the benchmark, so they can be chained onto Register.
+	*/
+	class Benchmark
+	{
+	public:
+		Benchmark(std::string name, std::function<void(State&)> f) : name_(std::move(name)), f_(std::move(f))
+		{}
+
+		/**
+		\brief Run exactly this many iterations, rather than as many as fill the minimum time.  For macro benchmarks, whose single iteration is already long.
+		*/
+		Benchmark& Iterations(std::uint64_t n)
+		{
+			fixed_iterations_ = n;
+			return *this;
+		}
+
+		/**
+		\brief The unit to report times in: ns, us, ms, or s.
+		*/
+		Benchmark& Unit(std::string unit)
+		{
+			if (unit != "ns" && unit != "us" && unit != "ms" && unit != "s")
+				throw std::runtime_error("unknown time unit " + unit + " for benchmark " + name_);
+			unit_ = std::move(unit);
+			return *this;
+		}
+
+		std::string const& Name() const
+		{
+			return name_;
+		}
+
+		std::string const& TimeUnit() const
+		{
+			return unit_;
+		}
+
+		double PerSecond() const
+		{
+			return unit_=="ns" ? 1e9 : unit_=="us" ? 1e6 : unit_=="ms" ? 1e3 : 1;
+		}
+
+		/**
+		\brief Run the benchmark, growing the number of iterations until a run takes at least min_seconds, and return the last run.
+		*/
+		State Run(double min_seconds) const
+		{
+			if (fixed_iterations_)
+			{
+				State state(fixed_iterations_);
+				f_(state);
+				return state;
+			}
+
+			const std::uint64_t max_iterations = 1000000000;
+			std::uint64_t n = 1;
+			for (;;)
+			{
+				State state(n);
+				f_(state);
+				if (state.RealSeconds() >= min_seconds || n >= max_iterations)
+					return state;
+
+				// aim 40% past the minimum, as Google Benchmark does, but grow at most tenfold
+				double factor = state.RealSeconds() > 0 ? 1.4*min_seconds/state.RealSeconds() : 10;
+				n = std::min<std::uint64_t>(max_iterations, static_cast<std::uint64_t>(n*std::min(std::max(factor, 1.1), 10.) + 1));
+			}
+		}
+
+	private:
+		std::string name_;
+		std::function<void(State&)> f_;
+		std::uint64_t fixed_iterations_ = 0;
+		std::string unit_ = "ns";
+	};
+
+
+	inline
+	std::vector<Benchmark>& Registry()
+	{
+		static std::vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+
+
+	/**
+	\brief Register a benchmark, to be run by RunBenchmarks.  Benchmarks run in the order they were registered.
+	*/
+	inline
+	Benchmark& Register(std::string name, std::function<void(State&)> f)
+	{
+		Registry().emplace_back(std::move(name), std::move(f));
+		return Registry().back();
+	}
+
+
+	namespace detail {
+
+		inline
+		std::string JSONString(std::string const& s)
+		{
+			std::string escaped("\"");
+			for (char c : s)
+			{
+				if (c=='"' || c=='\\')
+					escaped += '\\';
+				escaped += c;
+			}
+			return escaped + '"';
+		}
+
+		inline
+		std::string JSONNumber(double x)
+		{
+			if (!std::isfinite(x))
+				return "null";
+			std::ostringstream out;
+			out << std::setprecision(17) << x;
+			return out.str();
+		}
+
+		struct Result
+		{
+			Benchmark const* benchmark;
+			State state;
+		};
+
+		inline
+		void WriteJSON(std::ostream & out, std::string const& executable, std::vector<Result> const& results)
+		{
+			auto now = std::time(nullptr);
+			char date[64];
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+			out << "{\n  \"context\": {\n"
+			    << "    \"date\": " << JSONString(date) << ",\n"
+			    << "    \"executable\": " << JSONString(executable) << ",\n"
+			    << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+			    << "    \"library_build_type\": \"release\"\n"
+#else
+			    << "    \"library_build_type\": \"debug\"\n"
+#endif
+			    << "  },\n  \"benchmarks\": [";
+
+			for (decltype(results.size()) ii = 0; ii < results.size(); ++ii)
+			{
+				auto const& b = *results[ii].benchmark;
+				auto const& s = results[ii].state;
+				out << (ii ? "," : "") << "\n    {\n"
+				    << "      \"name\": " << JSONString(b.Name()) << ",\n"
+				    << "      \"run_name\": " << JSONString(b.Name()) << ",\n"
+				    << "      \"run_type\": \"iteration\",\n"
+				    << "      \"iterations\": " << s.Iterations() << ",\n"
+				    << "      \"real_time\": " << JSONNumber(s.RealSeconds()*b.PerSecond()/s.Iterations()) << ",\n"
+				    << "      \"cpu_time\": " << JSONNumber(s.CPUSeconds()*b.PerSecond()/s.Iterations()) << ",\n";
+				for (auto const& c : s.counters)
+					out << "      " << JSONString(c.first) << ": " << JSONNumber(c.second) << ",\n";
+				out << "      \"time_unit\": " << JSONString(b.TimeUnit()) << "\n    }";
+			}
+			out << "\n  ]\n}\n";
+		}
+
+	} // namespace detail
+
+
+	/**
+	\brief Run the registered benchmarks, as selected by the command line, printing a table of results and optionally writing them as JSON.
+
+	\return The exit status for main.
+	*/
+	inline
+	int RunBenchmarks(int argc, char** argv)
+	{
+		std::string filter, json;
+		double min_seconds = 0.5;
+
+		for (int ii = 1; ii < argc; ++ii)
+		{
+			const std::string arg(argv[ii]);
+			auto is = [&](std::string const& flag) { return arg.compare(0, flag.size(), flag)==0; };
+
+			if (is("--filter="))
+				filter = arg.substr(9);
+			else if (is("--min_time="))
+				min_seconds = std::stod(arg.substr(11));
+			else if (is("--json="))
+				json = arg.substr(7);
+			else
+			{
+				std::cerr << "usage: " << argv[0] << " [--filter=<substring>] [--min_time=<seconds>] [--json=<file>]\n";
+				return 1;
+			}
+		}
+
+		std::ofstream json_out;
+		if (!json.empty())
+		{
+			json_out.open(json);
+			if (!json_out)
+			{
+				std::cerr << "unable to open " << json << " for writing\n";
+				return 1;
+			}
+		}
+
+		std::cout << std::left << std::setw(48) << "benchmark" << std::right
+		          << std::setw(16) << "time" << std::setw(16) << "cpu" << std::setw(14) << "iterations" << '\n';
+
+		std::vector<detail::Result> results;
+		for (auto const& b : Registry())
+		{
+			if (b.Name().find(filter)==std::string::npos)
+				continue;
+
+			try
+			{
+				auto state = b.Run(min_seconds);
+				std::cout << std::left << std::setw(48) << b.Name() << std::right << std::setprecision(4)
+				          << std::setw(13) << state.RealSeconds()*b.PerSecond()/state.Iterations() << ' ' << std::setw(2) << b.TimeUnit()
+				          << std::setw(13) << state.CPUSeconds()*b.PerSecond()/state.Iterations() << ' ' << std::setw(2) << b.TimeUnit()
+				          << std::setw(14) << state.Iterations();
+				for (auto const& c : state.counters)
+					std::cout << "  " << c.first << '=' << c.second;
+				std::cout << std::endl;
+				results.push_back({&b, std::move(state)});
+			}
+			catch (std::exception const& e)
+			{
+				std::cout << std::left << std::setw(48) << b.Name() << std::right << "  error: " << e.what() << std::endl;
+			}
+		}
+
+		if (json_out.is_open())
+			detail::WriteJSON(json_out, argv[0], results);
+
+		return 0;
+	}
+
+} // namespace benchmark
+} // namespace bertini
+
+#endif
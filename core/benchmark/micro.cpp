@@ -0,0 +1,240 @@
+//This file is part of Bertini 2.
+//
+//benchmark/micro.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/micro.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/micro.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/micro.cpp
+
+\brief Micro benchmarks of the kernels path tracking is made of: system and Jacobian evaluation, complex arithmetic, linear solves, and predictor steps, in double and at several multiple precisions.
+
+Benchmarks are named kernel/size/precision, where the precision is dbl or the number of digits.  Run it as
+
+  b2_benchmark_micro [--filter=<substring>] [--min_time=<seconds>] [--json=<file>]
+*/
+
+#include "bertini2/system.hpp"
+#include "bertini2/system/start_systems.hpp"
+#include "bertini2/trackers/explicit_predictors.hpp"
+#include "harness.hpp"
+#include "systems.hpp"
+
+
+using namespace bertini;
+using namespace bertini::benchmark;
+
+namespace {
+
+	const std::vector<unsigned> Precisions{30, 50, 100};
+
+
+	std::string PrecisionName(dbl)
+	{
+		return "dbl";
+	}
+
+	std::string PrecisionName(mpfr)
+	{
+		return std::to_string(DefaultPrecision());
+	}
+
+
+	/**
+	Sets the default precision for the multiple precision case, and is a no-op for doubles, so the benchmarks below are written once for both.
+	*/
+	template<typename T>
+	void ForEachPrecision(std::function<void()> const& f)
+	{
+		if (std::is_same<T,dbl>::value)
+			f();
+		else
+			for (auto p : Precisions)
+			{
+				DefaultPrecision(p);
+				f();
+			}
+	}
+
+
+	template<typename T>
+	void RegisterEvaluation(std::string const& name, System sys)
+	{
+		sys.Differentiate();
+		ForEachPrecision<T>([&]{
+			const auto precision = DefaultPrecision();
+			Register("eval/" + name + "/" + PrecisionName(T()), [sys, precision](State & state)
+			{
+				DefaultPrecision(precision);
+				sys.precision(precision);
+
+				Vec<T> x = RandomOfUnits<T>(sys.NumVariables());
+				Vec<T> f(sys.NumTotalFunctions());
+				Mat<T> J(sys.NumTotalFunctions(), sys.NumVariables());
+				const T shift = T(1)/T(1000);
+
+				while (state.KeepRunning())
+				{
+					x(0) += shift; // move, so nothing is cached
+					sys.EvalInPlace(f, x);
+					sys.JacobianInPlace(J, x);
+				}
+				DoNotOptimize(J);
+			});
+		});
+	}
+
+
+	template<typename T>
+	void RegisterArithmetic()
+	{
+		ForEachPrecision<T>([&]{
+			const auto precision = DefaultPrecision();
+			const auto suffix = "/" + PrecisionName(T());
+
+			// a and b are units, so repeated products and quotients neither overflow nor underflow
+			Register("complex/add" + suffix, [precision](State & state)
+			{
+				DefaultPrecision(precision);
+				T a = RandomUnit<T>(), b = RandomUnit<T>();
+				while (state.KeepRunning())
+					DoNotOptimize(a += b);
+			});
+			Register("complex/mul" + suffix, [precision](State & state)
+			{
+				DefaultPrecision(precision);
+				T a = RandomUnit<T>(), b = RandomUnit<T>();
+				while (state.KeepRunning())
+					DoNotOptimize(a *= b);
+			});
+			Register("complex/div" + suffix, [precision](State & state)
+			{
+				DefaultPrecision(precision);
+				T a = RandomUnit<T>(), b = RandomUnit<T>();
+				while (state.KeepRunning())
+					DoNotOptimize(a /= b);
+			});
+		});
+	}
+
+
+	template<typename T>
+	void RegisterLinearSolve(unsigned n)
+	{
+		ForEachPrecision<T>([&]{
+			const auto precision = DefaultPrecision();
+			Register("lu_solve/" + std::to_string(n) + "/" + PrecisionName(T()), [n, precision](State & state)
+			{
+				DefaultPrecision(precision);
+				Mat<T> A = RandomOfUnits<T>(n, n);
+				Vec<T> b = RandomOfUnits<T>(n);
+				Vec<T> x(n);
+
+				while (state.KeepRunning())
+					x = A.partialPivLu().solve(b);
+				DoNotOptimize(x);
+			});
+		});
+	}
+
+
+	/**
+	One step of each predictor, from a start point of a total degree homotopy to Katsura(n).
+	*/
+	template<typename T>
+	void RegisterPredictors(unsigned n)
+	{
+		using tracking::Predictor;
+
+		auto target = Katsura(n);
+		auto start = start_system::TotalDegree(target);
+		auto t = MakeVariable("t");
+		System homotopy = (1-t)*target + MakeRational(node::Rational::Rand())*t*start;
+		homotopy.AddPathVariable(t);
+
+		const std::vector<std::pair<Predictor, std::string>> methods{
+			{Predictor::Euler, "euler"}, {Predictor::Heun, "heun"}, {Predictor::RK4, "rk4"},
+			{Predictor::HeunEuler, "heun_euler"}, {Predictor::RKNorsett34, "norsett34"}, {Predictor::RKF45, "rkf45"},
+			{Predictor::RKCashKarp45, "cash_karp45"}, {Predictor::RKDormandPrince56, "dormand_prince56"}, {Predictor::RKVerner67, "verner67"}};
+
+		ForEachPrecision<T>([&]{
+			const auto precision = DefaultPrecision();
+			for (auto const& m : methods)
+			{
+				const auto method = m.first;
+				Register("predict/" + m.second + "/katsura" + std::to_string(n) + "/" + PrecisionName(T()), [homotopy, start, method, precision](State & state)
+				{
+					DefaultPrecision(precision);
+					homotopy.precision(precision);
+
+					tracking::predict::ExplicitRKPredictor predictor(method, homotopy);
+					predictor.ChangePrecision(precision);
+
+					const Vec<T> x = start.StartPoint<T>(0);
+					const T time(1), delta_t(-0.01);
+					Vec<T> next(x.size());
+					NumErrorT condition_number_estimate;
+					unsigned num_steps_since_last_condition_number_computation = 1;
+
+					while (state.KeepRunning())
+						predictor.Predict(next, homotopy, x, time, delta_t,
+						                  condition_number_estimate, num_steps_since_last_condition_number_computation, 1, 1e-5);
+					DoNotOptimize(next);
+				});
+			}
+		});
+	}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+	const auto original_precision = DefaultPrecision();
+
+	RegisterArithmetic<dbl>();
+	RegisterArithmetic<mpfr>();
+
+	for (unsigned n : {4, 8, 12})
+	{
+		RegisterEvaluation<dbl>("katsura" + std::to_string(n), Katsura(n));
+		RegisterEvaluation<mpfr>("katsura" + std::to_string(n), Katsura(n));
+	}
+	for (unsigned n : {5, 7})
+	{
+		RegisterEvaluation<dbl>("cyclic" + std::to_string(n), Cyclic(n));
+		RegisterEvaluation<mpfr>("cyclic" + std::to_string(n), Cyclic(n));
+	}
+
+	for (unsigned n : {5, 10, 20})
+	{
+		RegisterLinearSolve<dbl>(n);
+		RegisterLinearSolve<mpfr>(n);
+	}
+
+	RegisterPredictors<dbl>(6);
+	RegisterPredictors<mpfr>(6);
+
+	DefaultPrecision(original_precision);
+
+	return RunBenchmarks(argc, argv);
+}
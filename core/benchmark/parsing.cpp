@@ -0,0 +1,160 @@
+//This file is part of Bertini 2.
+//
+//benchmark/parsing.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/parsing.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/parsing.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/parsing.cpp
+
+\brief Measures the throughput of the Qi system parser against the streaming parser, on generated Bertini Classic input.
+
+Run it as
+
+  b2_benchmark_parsing [repetitions]
+*/
+
+#include "bertini2/system.hpp"
+#include "bertini2/io/parsing/system_parsers.hpp"
+#include "bertini2/io/parsing/streaming_system_parser.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+
+using namespace bertini;
+
+namespace {
+
+	template<typename F>
+	double SecondsPer(F const& f, unsigned repetitions)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii = 0; ii < repetitions; ++ii)
+			f();
+		auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+		return elapsed.count() / repetitions;
+	}
+
+
+	/**
+	The Katsura system with n+1 variables, written out term by term as Bertini Classic input.
+	*/
+	std::string KatsuraInput(unsigned n)
+	{
+		std::stringstream input;
+		input << "variable_group ";
+		for (unsigned ii = 0; ii <= n; ++ii)
+			input << (ii ? ", " : "") << 'x' << ii;
+		input << ";\nfunction ";
+		for (unsigned m = 0; m <= n; ++m)
+			input << (m ? ", " : "") << 'f' << m;
+		input << ";\n";
+
+		for (int m = 0; m < static_cast<int>(n); ++m)
+		{
+			// the -x_m goes last, since the Qi parser would read a leading minus as negating the whole sum
+			input << 'f' << m << " = 0";
+			for (int l = -static_cast<int>(n); l <= static_cast<int>(n); ++l)
+				if (std::abs(m-l) <= static_cast<int>(n))
+					input << " + x" << std::abs(l) << "*x" << std::abs(m-l);
+			input << " - x" << m << ";\n";
+		}
+
+		input << 'f' << n << " = x0 - 1";
+		for (unsigned l = 1; l <= n; ++l)
+			input << " + 2*x" << l;
+		input << ";\n";
+		return input.str();
+	}
+
+
+	/**
+	n dense quadrics in n variables with decimal coefficients, so numbers are as much of the input as names.
+	*/
+	std::string DenseQuadricsInput(unsigned n)
+	{
+		std::stringstream input;
+		input << "variable_group ";
+		for (unsigned ii = 0; ii < n; ++ii)
+			input << (ii ? ", " : "") << 'x' << ii;
+		input << ";\nfunction ";
+		for (unsigned m = 0; m < n; ++m)
+			input << (m ? ", " : "") << 'f' << m;
+		input << ";\n";
+
+		unsigned count = 0;
+		for (unsigned m = 0; m < n; ++m)
+		{
+			input << 'f' << m << " = 1";
+			for (unsigned ii = 0; ii < n; ++ii)
+				for (unsigned jj = ii; jj < n; ++jj)
+				{
+					++count;
+					input << " + " << count % 997 << '.' << count % 89 << "e-2*x" << ii << "*x" << jj;
+				}
+			input << ";\n";
+		}
+		return input.str();
+	}
+
+
+	void Compare(std::string const& name, std::string const& input, unsigned repetitions)
+	{
+		auto qi = SecondsPer([&]{ System sys(input); }, repetitions);
+
+		auto streaming = SecondsPer([&]{
+			std::stringstream ss(input);
+			parsing::classic::ParseSystem(ss);
+		}, repetitions);
+
+		const double mb = input.size() / 1e6;
+		std::cout << std::setw(16) << name
+		          << std::setw(12) << mb
+		          << std::setw(12) << mb/qi << std::setw(12) << mb/streaming
+		          << std::setw(10) << qi/streaming << '\n';
+	}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+	unsigned repetitions = argc > 1 ? std::stoul(argv[1]) : 3;
+
+	std::cout << "throughput in MB/s of input, averaged over " << repetitions << " repetitions\n\n";
+	std::cout << std::setw(16) << "system"
+	          << std::setw(12) << "size MB"
+	          << std::setw(12) << "qi" << std::setw(12) << "streaming"
+	          << std::setw(10) << "speedup" << '\n';
+
+	std::cout << std::fixed << std::setprecision(2);
+	for (unsigned n : {20, 80, 200})
+		Compare("katsura " + std::to_string(n), KatsuraInput(n), repetitions);
+	for (unsigned n : {10, 25, 40})
+		Compare("dense quadric " + std::to_string(n), DenseQuadricsInput(n), repetitions);
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+//This file is part of Bertini 2.
+//
+//benchmark/polynomial_evaluation.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/polynomial_evaluation.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/polynomial_evaluation.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/polynomial_evaluation.cpp
+
+\brief Times evaluation of polynomial systems from their trees, against evaluation from a PolynomialTable.
+
+Each system is evaluated, together with its Jacobian, at a fixed point many times, in double and in multiple precision.  Run it as
+
+  b2_benchmark_polynomial_evaluation [repetitions]
+*/
+
+#include "bertini2/system.hpp"
+#include "systems.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+
+using namespace bertini;
+using namespace bertini::benchmark;
+
+namespace {
+
+	template<typename T>
+	double MicrosecondsPerEvaluation(System const& sys, unsigned repetitions)
+	{
+		Vec<T> x = RandomOfUnits<T>(sys.NumVariables());
+		Vec<T> f(sys.NumTotalFunctions());
+		Mat<T> J(sys.NumTotalFunctions(), sys.NumVariables());
+
+		sys.EvalInPlace(f, x);
+		sys.JacobianInPlace(J, x);
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii = 0; ii < repetitions; ++ii)
+		{
+			x(0) += T(1)/T(repetitions); // move, so nothing is cached
+			sys.EvalInPlace(f, x);
+			sys.JacobianInPlace(J, x);
+		}
+		auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+		return elapsed.count() / repetitions;
+	}
+
+
+	void Compare(std::string const& name, System sys, unsigned repetitions)
+	{
+		sys.Differentiate();
+
+		sys.SetUsePolynomialTable(false);
+		auto tree_d = MicrosecondsPerEvaluation<dbl>(sys, repetitions);
+		auto tree_mp = MicrosecondsPerEvaluation<mpfr>(sys, repetitions/10+1);
+
+		sys.SetUsePolynomialTable(true);
+		if (!sys.UsesPolynomialTable())
+		{
+			std::cout << std::setw(24) << name << "  not expanded into a table\n";
+			return;
+		}
+		auto table_d = MicrosecondsPerEvaluation<dbl>(sys, repetitions);
+		auto table_mp = MicrosecondsPerEvaluation<mpfr>(sys, repetitions/10+1);
+
+		std::cout << std::setw(24) << name
+		          << std::setw(12) << tree_d << std::setw(12) << table_d << std::setw(10) << tree_d/table_d
+		          << std::setw(12) << tree_mp << std::setw(12) << table_mp << std::setw(10) << tree_mp/table_mp << '\n';
+	}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+	unsigned repetitions = argc > 1 ? std::stoul(argv[1]) : 1000;
+
+	DefaultPrecision(30);
+
+	std::cout << "microseconds per evaluation of functions and Jacobian, " << repetitions << " repetitions\n\n";
+	std::cout << std::setw(24) << "system"
+	          << std::setw(12) << "tree dbl" << std::setw(12) << "table dbl" << std::setw(10) << "speedup"
+	          << std::setw(12) << "tree mp" << std::setw(12) << "table mp" << std::setw(10) << "speedup" << '\n';
+
+	std::cout << std::fixed << std::setprecision(2);
+	for (unsigned n : {5, 8, 11})
+		Compare("katsura " + std::to_string(n), Katsura(n), repetitions);
+
+	for (auto nd : {std::make_pair(3u,3u), std::make_pair(4u,4u), std::make_pair(6u,3u)})
+		Compare("product of linears " + std::to_string(nd.first) + "," + std::to_string(nd.second), ProductOfLinears(nd.first, nd.second), repetitions);
+
+	return 0;
+}
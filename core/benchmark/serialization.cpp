@@ -0,0 +1,128 @@
+//This file is part of Bertini 2.
+//
+//benchmark/serialization.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/serialization.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/serialization.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/serialization.cpp
+
+\brief Times saving and loading differentiated systems with Boost text archives, against the binary format of SaveBinary.
+
+Run it as
+
+  b2_benchmark_serialization [repetitions]
+*/
+
+#include "bertini2/system.hpp"
+#include "systems.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+
+using namespace bertini;
+using namespace bertini::benchmark;
+
+namespace {
+
+	template<typename F>
+	double MillisecondsPer(F const& f, unsigned repetitions)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned ii = 0; ii < repetitions; ++ii)
+			f();
+		auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+		return elapsed.count() / repetitions;
+	}
+
+
+	void Compare(std::string const& name, System sys, unsigned repetitions)
+	{
+		sys.Differentiate();
+
+		std::string text;
+		auto text_save = MillisecondsPer([&]{
+			std::stringstream ss;
+			{
+				boost::archive::text_oarchive oa(ss);
+				oa << sys;
+			}
+			text = ss.str();
+		}, repetitions);
+
+		auto text_load = MillisecondsPer([&]{
+			std::stringstream ss(text);
+			System loaded;
+			boost::archive::text_iarchive ia(ss);
+			ia >> loaded;
+		}, repetitions);
+
+		std::string binary;
+		auto binary_save = MillisecondsPer([&]{
+			std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+			SaveBinary(sys, ss);
+			binary = ss.str();
+		}, repetitions);
+
+		auto binary_load = MillisecondsPer([&]{
+			std::stringstream ss(binary, std::ios::in | std::ios::binary);
+			LoadBinary(ss);
+		}, repetitions);
+
+		const std::string filename = "b2_benchmark_serialization.bin";
+		SaveBinary(sys, filename);
+		auto file_load = MillisecondsPer([&]{ LoadBinary(filename); }, repetitions);
+		std::remove(filename.c_str());
+
+		std::cout << std::setw(14) << name
+		          << std::setw(12) << text.size()/1024 << std::setw(12) << binary.size()/1024
+		          << std::setw(12) << text_save << std::setw(12) << binary_save
+		          << std::setw(12) << text_load << std::setw(12) << binary_load << std::setw(12) << file_load
+		          << std::setw(10) << text_load/binary_load << '\n';
+	}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+	unsigned repetitions = argc > 1 ? std::stoul(argv[1]) : 10;
+
+	DefaultPrecision(30);
+
+	std::cout << "sizes in KiB, times in milliseconds, averaged over " << repetitions << " repetitions\n\n";
+	std::cout << std::setw(14) << "system"
+	          << std::setw(12) << "text size" << std::setw(12) << "bin size"
+	          << std::setw(12) << "text save" << std::setw(12) << "bin save"
+	          << std::setw(12) << "text load" << std::setw(12) << "bin load" << std::setw(12) << "file load"
+	          << std::setw(10) << "speedup" << '\n';
+
+	std::cout << std::fixed << std::setprecision(2);
+	for (unsigned n : {10, 20, 40})
+		Compare("katsura " + std::to_string(n), Katsura(n), repetitions);
+
+	return 0;
+}
@@ -0,0 +1,200 @@
+//This file is part of Bertini 2.
+//
+//benchmark/systems.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/systems.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/systems.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/systems.hpp
+
+\brief Families of test systems shared by the benchmarks.
+*/
+
+#ifndef BERTINI_BENCHMARK_SYSTEMS_HPP
+#define BERTINI_BENCHMARK_SYSTEMS_HPP
+
+#include "bertini2/system.hpp"
+
+namespace bertini {
+namespace benchmark {
+
+	/**
+	The Katsura family, a standard sparse test system.  n+1 variables, degree 2.
+	*/
+	inline
+	System Katsura(unsigned n)
+	{
+		VariableGroup x;
+		for (unsigned ii = 0; ii <= n; ++ii)
+			x.push_back(MakeVariable("x" + std::to_string(ii)));
+
+		auto X = [&](int ii) -> std::shared_ptr<node::Node>
+		{
+			ii = std::abs(ii);
+			if (ii > static_cast<int>(n))
+				return MakeInteger(0);
+			return x[ii];
+		};
+
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (int m = 0; m < static_cast<int>(n); ++m)
+		{
+			std::shared_ptr<node::Node> f = -X(m);
+			for (int l = -static_cast<int>(n); l <= static_cast<int>(n); ++l)
+				f = f + X(l)*X(m-l);
+			sys.AddFunction(f);
+		}
+
+		std::shared_ptr<node::Node> last = X(0) - 1;
+		for (unsigned l = 1; l <= n; ++l)
+			last = last + 2*X(l);
+		sys.AddFunction(last);
+
+		return sys;
+	}
+
+
+	/**
+	Each function a product of degree affine linear forms, the structure of a linear product start system.  Dense when expanded.
+	*/
+	inline
+	System ProductOfLinears(unsigned num_variables, unsigned degree)
+	{
+		VariableGroup x;
+		for (unsigned ii = 0; ii < num_variables; ++ii)
+			x.push_back(MakeVariable("x" + std::to_string(ii)));
+
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (unsigned ii = 0; ii < num_variables; ++ii)
+		{
+			std::shared_ptr<node::Node> f = MakeInteger(1);
+			for (unsigned kk = 0; kk < degree; ++kk)
+			{
+				std::shared_ptr<node::Node> linear = MakeRational(mpq_rational(ii+kk+1, num_variables+degree), 0);
+				for (unsigned jj = 0; jj < num_variables; ++jj)
+					linear = linear + MakeRational(mpq_rational((ii*jj+kk)%7+1, 7), 0)*x[jj];
+				f = f*linear;
+			}
+			sys.AddFunction(f);
+		}
+
+		return sys;
+	}
+
+
+	/**
+	The cyclic n-roots problem.  n variables, degrees 1 through n, with many solutions at infinity.
+	*/
+	inline
+	System Cyclic(unsigned n)
+	{
+		VariableGroup x;
+		for (unsigned ii = 0; ii < n; ++ii)
+			x.push_back(MakeVariable("x" + std::to_string(ii)));
+
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (unsigned k = 1; k < n; ++k)
+		{
+			std::shared_ptr<node::Node> f = MakeInteger(0);
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				std::shared_ptr<node::Node> term = x[ii];
+				for (unsigned jj = 1; jj < k; ++jj)
+					term = term*x[(ii+jj)%n];
+				f = f + term;
+			}
+			sys.AddFunction(f);
+		}
+
+		std::shared_ptr<node::Node> last = x[0];
+		for (unsigned ii = 1; ii < n; ++ii)
+			last = last*x[ii];
+		sys.AddFunction(last - 1);
+
+		return sys;
+	}
+
+
+	/**
+	Noon's neural network model.  n variables, degree 3, with 3^n - 2n - 1 finite solutions, all nonsingular.
+	*/
+	inline
+	System Noon(unsigned n)
+	{
+		VariableGroup x;
+		for (unsigned ii = 0; ii < n; ++ii)
+			x.push_back(MakeVariable("x" + std::to_string(ii)));
+
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (unsigned ii = 0; ii < n; ++ii)
+		{
+			std::shared_ptr<node::Node> squares = MakeInteger(0);
+			for (unsigned jj = 0; jj < n; ++jj)
+				if (jj != ii)
+					squares = squares + pow(x[jj], 2);
+			sys.AddFunction(x[ii]*squares - MakeRational(mpq_rational(11,10), 0)*x[ii] + 1);
+		}
+
+		return sys;
+	}
+
+
+	/**
+	Morgan's economics model.  n variables, degree 2, with 2^(n-2) finite solutions.
+	*/
+	inline
+	System Economics(unsigned n)
+	{
+		VariableGroup x;
+		for (unsigned ii = 0; ii < n; ++ii)
+			x.push_back(MakeVariable("x" + std::to_string(ii)));
+
+		System sys;
+		sys.AddVariableGroup(x);
+
+		for (unsigned k = 0; k+1 < n; ++k)
+		{
+			std::shared_ptr<node::Node> f = x[k];
+			for (unsigned ii = 0; ii+k+2 < n; ++ii)
+				f = f + x[ii]*x[ii+k+1];
+			sys.AddFunction(f*x[n-1] - static_cast<int>(k+1));
+		}
+
+		std::shared_ptr<node::Node> last = MakeInteger(1);
+		for (unsigned ii = 0; ii+1 < n; ++ii)
+			last = last + x[ii];
+		sys.AddFunction(last);
+
+		return sys;
+	}
+
+} // namespace benchmark
+} // namespace bertini
+
+#endif
@@ -0,0 +1,106 @@
+//This file is part of Bertini 2.
+//
+//benchmark/zero_dim.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//benchmark/zero_dim.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with benchmark/zero_dim.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file benchmark/zero_dim.cpp
+
+\brief Macro benchmarks: whole ZeroDim solves, by total degree homotopy and the Cauchy endgame, of scalable families of systems.
+
+Each solve is run once, and reported with the work its profile counted: paths, steps, Newton iterations, factorizations, and the time in the endgame.  Benchmarks are named zero_dim/tracker/system.  Run it as
+
+  b2_benchmark_zero_dim [--filter=<substring>] [--json=<file>]
+*/
+
+#include "bertini2/system/precon.hpp"
+#include "bertini2/system/start_systems.hpp"
+#include "bertini2/nag_algorithms/zero_dim_solve.hpp"
+#include "bertini2/endgames.hpp"
+#include "harness.hpp"
+#include "systems.hpp"
+
+
+using namespace bertini;
+using namespace bertini::benchmark;
+
+namespace {
+
+	template<typename TrackerT>
+	void RegisterSolve(std::string const& tracker_name, std::string const& system_name, System const& sys)
+	{
+		Register("zero_dim/" + tracker_name + "/" + system_name, [sys](State & state)
+		{
+			using ZeroDimT = algorithm::ZeroDim<TrackerT, typename endgame::EndgameSelector<TrackerT>::Cauchy, System, start_system::TotalDegree>;
+
+			while (state.KeepRunning())
+			{
+				ZeroDimT zd(sys);
+				zd.DefaultSetup();
+				zd.Solve();
+
+				unsigned long long successes = 0;
+				for (auto const& m : zd.FinalSolutionMetadata())
+					if (m.endgame_success == SuccessCode::Success)
+						++successes;
+
+				auto const& profile = zd.Profile();
+				state.counters["paths"] = zd.FinalSolutions().size();
+				state.counters["successes"] = successes;
+				state.counters["steps"] = profile.counters.steps_accepted + profile.counters.steps_rejected;
+				state.counters["rejected_steps"] = profile.counters.steps_rejected;
+				state.counters["newton_iterations"] = profile.counters.newton_iterations;
+				state.counters["lu_factorizations"] = profile.counters.lu_factorizations;
+				state.counters["precision_changes"] = profile.counters.precision_changes;
+				state.counters["endgame_seconds"] = profile.endgame_seconds + profile.refinement_seconds;
+			}
+		}).Iterations(1).Unit("ms");
+	}
+
+
+	template<typename TrackerT>
+	void RegisterSolves(std::string const& tracker_name)
+	{
+		RegisterSolve<TrackerT>(tracker_name, "griewank_osborn", system::Precon::GriewankOsborn());
+		RegisterSolve<TrackerT>(tracker_name, "crossed_paths", system::Precon::CrossedPaths());
+
+		for (unsigned n : {3, 5, 7})
+			RegisterSolve<TrackerT>(tracker_name, "katsura" + std::to_string(n), Katsura(n));
+		for (unsigned n : {4, 5, 6})
+			RegisterSolve<TrackerT>(tracker_name, "cyclic" + std::to_string(n), Cyclic(n));
+		for (unsigned n : {3, 4, 5})
+			RegisterSolve<TrackerT>(tracker_name, "noon" + std::to_string(n), Noon(n));
+		for (unsigned n : {4, 6, 8})
+			RegisterSolve<TrackerT>(tracker_name, "economics" + std::to_string(n), Economics(n));
+	}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+	RegisterSolves<tracking::DoublePrecisionTracker>("double");
+	RegisterSolves<tracking::AMPTracker>("amp");
+
+	return RunBenchmarks(argc, argv);
+}
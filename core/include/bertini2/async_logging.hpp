@@ -0,0 +1,663 @@
+//This file is part of Bertini 2.
+//
+//async_logging.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//async_logging.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with async_logging.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file async_logging.hpp
+
+\brief Asynchronous logging, with deferred formatting, for diagnostics written from inside tracking loops.
+
+A log statement names a severity, a category, and the pieces of its message:
+
+\code
+BERTINI_LOG_TRACE(async_logging::categories::Tracking(), std::setprecision(p), "t = ", t.CurrentTime(), "\ncurrent x = ", t.CurrentPoint());
+\endcode
+
+The calling thread only copies the pieces, numbers and vectors as they are, onto a queue of its own.  Formatting them, and writing them to Boost.Log, happens on the background thread of an AsyncLogger.  Without an AsyncLogger, messages are formatted and written at once, as BOOST_LOG_TRIVIAL would.
+
+\code
+bertini::LoggingInit init;               // the Boost.Log file sink, as before
+bertini::async_logging::AsyncLogger log; // format and write in the background, from now until log is destroyed
+\endcode
+
+Statements below the compile-time level BERTINI_LOG_LEVEL are removed entirely, arguments and all.  The levels are 0 through 5, for trace, debug, info, warning, error, and fatal, and configure sets it with `--with-log-level`.  Categories may also be rate limited, at run time, to bound the volume of a chatty one.
+*/
+
+#ifndef BERTINI_ASYNC_LOGGING_HPP
+#define BERTINI_ASYNC_LOGGING_HPP
+
+#include "bertini2/config.h"
+#include "bertini2/logging.hpp"
+
+#include <boost/multiprecision/number.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+
+#ifndef BERTINI_LOG_LEVEL
+#define BERTINI_LOG_LEVEL 0
+#endif
+
+
+namespace bertini {
+namespace async_logging {
+
+	using Clock = std::chrono::steady_clock;
+
+
+	/**
+	\brief A named kind of log message, which may be rate limited.
+
+	Categories are shared by all threads, and must outlive logging to them, so make them statics, as those in async_logging::categories are.
+	*/
+	class Category
+	{
+	public:
+		explicit
+		Category(std::string name) : name_(std::move(name))
+		{
+			std::lock_guard<std::mutex> lock(RegistryMutex());
+			Registry().push_back(this);
+		}
+
+		Category(Category const&) = delete;
+		Category& operator=(Category const&) = delete;
+
+		~Category()
+		{
+			std::lock_guard<std::mutex> lock(RegistryMutex());
+			Registry().erase(std::remove(Registry().begin(), Registry().end(), this), Registry().end());
+		}
+
+		std::string const& Name() const
+		{
+			return name_;
+		}
+
+		/**
+		\brief Admit at most records_per_second messages of this category, on average, with bursts of up to burst.  Messages over the limit are counted, not queued.
+		*/
+		void SetRateLimit(double records_per_second, unsigned burst)
+		{
+			if (!(records_per_second > 0) || burst==0)
+				throw std::runtime_error("rate limit of category " + name_ + " must be positive");
+
+			std::lock_guard<std::mutex> lock(refill_mutex_);
+			rate_ = records_per_second;
+			burst_ = burst;
+			last_refill_ = Clock::now();
+			tokens_.store(burst, std::memory_order_relaxed);
+			limited_.store(true, std::memory_order_release);
+		}
+
+		void RemoveRateLimit()
+		{
+			limited_.store(false, std::memory_order_release);
+		}
+
+		/**
+		\brief Whether a message of this category may be logged now.  Takes a token if the category is rate limited.
+		*/
+		bool Admit()
+		{
+			if (!limited_.load(std::memory_order_acquire))
+				return true;
+			if (tokens_.fetch_sub(1, std::memory_order_relaxed) > 0)
+				return true;
+
+			Refill();
+			if (tokens_.fetch_sub(1, std::memory_order_relaxed) > 0)
+				return true;
+
+			suppressed_.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		/**
+		\brief The number of messages suppressed by the rate limit since the last call.
+		*/
+		std::uint64_t TakeSuppressed()
+		{
+			return suppressed_.exchange(0, std::memory_order_relaxed);
+		}
+
+		/**
+		\brief All the categories which exist, for reporting suppressed messages.
+		*/
+		template<typename F>
+		static void ForEach(F const& f)
+		{
+			std::lock_guard<std::mutex> lock(RegistryMutex());
+			for (auto c : Registry())
+				f(*c);
+		}
+
+	private:
+
+		void Refill()
+		{
+			std::lock_guard<std::mutex> lock(refill_mutex_);
+			auto now = Clock::now();
+			auto earned = static_cast<std::int64_t>(rate_ * std::chrono::duration<double>(now - last_refill_).count());
+			if (earned < 1)
+				return; // keep the old mark, so fractions of a token accumulate
+
+			auto current = std::max<std::int64_t>(tokens_.load(std::memory_order_relaxed), 0);
+			if (current + earned >= burst_)
+			{
+				tokens_.store(burst_, std::memory_order_relaxed);
+				last_refill_ = now;
+			}
+			else
+			{
+				tokens_.store(current + earned, std::memory_order_relaxed);
+				last_refill_ += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(earned / rate_));
+			}
+		}
+
+		static std::vector<Category*>& Registry()
+		{
+			static std::vector<Category*> categories;
+			return categories;
+		}
+
+		static std::mutex& RegistryMutex()
+		{
+			static std::mutex m;
+			return m;
+		}
+
+		std::string name_;
+
+		std::atomic<bool> limited_{false};
+		std::atomic<std::int64_t> tokens_{0};
+		std::atomic<std::uint64_t> suppressed_{0};
+
+		std::mutex refill_mutex_; ///< guards the rate, burst, and refill mark
+		double rate_ = 0;
+		std::int64_t burst_ = 0;
+		Clock::time_point last_refill_;
+	};
+
+
+	/**
+	\brief The categories Bertini's own diagnostics are logged to.
+	*/
+	namespace categories {
+
+		inline
+		Category& General()
+		{
+			static Category c("general");
+			return c;
+		}
+
+		inline
+		Category& Tracking()
+		{
+			static Category c("tracking");
+			return c;
+		}
+
+		inline
+		Category& Endgame()
+		{
+			static Category c("endgame");
+			return c;
+		}
+
+	} // namespace categories
+
+
+
+
+	namespace detail {
+
+		template<typename T, typename = void>
+		struct HasPlainObject : std::false_type
+		{};
+
+		template<typename T>
+		struct HasPlainObject<T, typename std::conditional<true, void, typename T::PlainObject>::type> : std::true_type
+		{};
+
+		template<typename T, bool IsEigen = HasPlainObject<T>::value, bool IsMultiprecisionExpression = boost::multiprecision::is_number_expression<T>::value>
+		struct Evaluated
+		{
+			using type = T;
+		};
+
+		template<typename T>
+		struct Evaluated<T, true, false>
+		{
+			using type = typename T::PlainObject;
+		};
+
+		template<typename T>
+		struct Evaluated<T, false, true>
+		{
+			using type = typename T::result_type;
+		};
+
+		/**
+		Whether a piece is a string literal, that is, an array of const char.  Literals live for the whole program, so can be kept by pointer.  A const char array on the stack is indistinguishable from one by type, so copy it into a std::string to log it.
+		*/
+		template<typename T>
+		struct IsStringLiteral : std::false_type
+		{};
+
+		template<std::size_t N>
+		struct IsStringLiteral<char const(&)[N]> : std::true_type
+		{};
+
+		/**
+		How a piece of a message is kept until it is formatted: string literals by pointer, other strings and char arrays by copy, and expressions, of Eigen or Boost.Multiprecision, by the value they evaluate to, since they refer to temporaries.  Other arrays are kept as the pointer they decay to, which is all that streaming them prints.  Everything else is copied as it is.
+		*/
+		template<typename T>
+		using Stored = typename std::conditional<
+			IsStringLiteral<T>::value,
+				char const*,
+			typename std::conditional<
+				std::is_same<typename std::decay<T>::type, char const*>::value || std::is_same<typename std::decay<T>::type, char*>::value,
+					std::string,
+				typename std::conditional<
+					std::is_array<typename std::remove_reference<T>::type>::value,
+						typename std::decay<T>::type,
+					typename Evaluated<typename std::decay<T>::type>::type
+				>::type
+			>::type
+		>::type;
+
+
+		template<typename T>
+		void Put(std::ostream & out, T const& x, std::true_type /*is enum*/)
+		{
+			out << static_cast<typename std::underlying_type<T>::type>(x);
+		}
+
+		template<typename T>
+		void Put(std::ostream & out, T const& x, std::false_type /*is enum*/)
+		{
+			out << x;
+		}
+
+
+		/**
+		The pieces of a message, copied, waiting to be formatted.
+		*/
+		struct Payload
+		{
+			virtual ~Payload() = default;
+			virtual void Format(std::ostream & out) const = 0;
+		};
+
+		template<typename ...Ts>
+		struct PayloadOf : Payload
+		{
+			template<typename ...Args>
+			explicit
+			PayloadOf(Args&& ...args) : pieces(std::forward<Args>(args)...)
+			{}
+
+			void Format(std::ostream & out) const override
+			{
+				FormatPieces(out, std::index_sequence_for<Ts...>());
+			}
+
+			template<std::size_t ...I>
+			void FormatPieces(std::ostream & out, std::index_sequence<I...>) const
+			{
+				(void)std::initializer_list<int>{(Put(out, std::get<I>(pieces), std::is_enum<Ts>()), 0)...};
+			}
+
+			std::tuple<Ts...> pieces;
+		};
+
+		template<typename ...Args>
+		std::unique_ptr<Payload> MakePayload(Args&& ...args)
+		{
+			return std::make_unique<PayloadOf<Stored<Args>...>>(std::forward<Args>(args)...);
+		}
+
+		inline
+		std::string Format(Payload const& p)
+		{
+			std::ostringstream out;
+			p.Format(out);
+			return out.str();
+		}
+
+	} // namespace detail
+
+
+	/**
+	\brief Format a piece of a message now, on the calling thread, for things which are unsafe or expensive to copy, such as a System being tracked on.
+	*/
+	template<typename T>
+	std::string FormatNow(T const& x)
+	{
+		std::ostringstream out;
+		out << x;
+		return out.str();
+	}
+
+
+	/**
+	\brief A message waiting in a queue.
+	*/
+	struct Record
+	{
+		severity_level severity;
+		Clock::time_point time;
+		std::unique_ptr<detail::Payload> payload;
+	};
+
+
+	/**
+	\brief The queue of one logging thread.  Only that thread pushes, and only the logger's background thread takes, so the lock is almost never contended.
+	*/
+	class ThreadQueue
+	{
+	public:
+		explicit
+		ThreadQueue(std::size_t capacity) : capacity_(capacity)
+		{}
+
+		/**
+		\brief Queue a record, or count it as dropped if the queue is full, so a thread logging faster than the background can write never waits.
+		*/
+		void Push(Record&& r)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (records_.size() >= capacity_)
+			{
+				++dropped_;
+				return;
+			}
+			records_.push_back(std::move(r));
+		}
+
+		/**
+		\brief Move the queued records to the end of a vector, and return the number dropped since the last time.
+		*/
+		std::uint64_t Take(std::vector<Record> & into)
+		{
+			std::vector<Record> taken;
+			std::uint64_t dropped;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				taken.swap(records_);
+				dropped = dropped_;
+				dropped_ = 0;
+			}
+			std::move(taken.begin(), taken.end(), std::back_inserter(into));
+			return dropped;
+		}
+
+	private:
+		std::size_t capacity_;
+		std::mutex mutex_;
+		std::vector<Record> records_;
+		std::uint64_t dropped_ = 0;
+	};
+
+
+
+
+	/**
+	\brief Formats and writes queued log messages on a background thread.
+
+	There is at most one at a time.  While it exists, log statements queue their messages rather than writing them; it must outlive all logging done while it exists.  Its destructor writes everything still queued.
+	*/
+	class AsyncLogger
+	{
+	public:
+		using Sink = std::function<void(severity_level, std::string const&)>;
+
+		/**
+		\param queue_capacity The number of messages each thread's queue holds.  Messages logged to a full queue are dropped, and the number dropped is logged.
+		\param flush_interval How often the background thread empties the queues.
+		\param sink Where formatted messages go.  Boost.Log, by default, so the sink set up by LoggingInit receives them.
+		*/
+		explicit
+		AsyncLogger(std::size_t queue_capacity = 1<<16, std::chrono::milliseconds flush_interval = std::chrono::milliseconds(50), Sink sink = BoostLogSink) :
+			queue_capacity_(queue_capacity), flush_interval_(flush_interval), sink_(std::move(sink)), id_(NextId())
+		{
+			AsyncLogger* expected = nullptr;
+			if (!ActivePointer().compare_exchange_strong(expected, this))
+				throw std::runtime_error("there is already an AsyncLogger");
+
+			writer_ = std::thread([this]{ WriteLoop(); });
+		}
+
+		AsyncLogger(AsyncLogger const&) = delete;
+		AsyncLogger& operator=(AsyncLogger const&) = delete;
+
+		~AsyncLogger()
+		{
+			ActivePointer().store(nullptr);
+			{
+				std::lock_guard<std::mutex> lock(wake_mutex_);
+				stop_ = true;
+			}
+			wake_.notify_one();
+			writer_.join();
+			Flush();
+		}
+
+		/**
+		\brief The logger messages are queued to, or null if there is none.
+		*/
+		static AsyncLogger* Active()
+		{
+			return ActivePointer().load(std::memory_order_acquire);
+		}
+
+		/**
+		\brief The queue of the calling thread, made the first time the thread logs.
+		*/
+		ThreadQueue& ThisThreadQueue()
+		{
+			struct Cached
+			{
+				std::uint64_t logger = 0;
+				ThreadQueue* queue = nullptr;
+			};
+			static thread_local Cached cached;
+
+			if (cached.logger != id_)
+			{
+				std::lock_guard<std::mutex> lock(queues_mutex_);
+				queues_.push_back(std::make_shared<ThreadQueue>(queue_capacity_));
+				cached.logger = id_;
+				cached.queue = queues_.back().get();
+			}
+			return *cached.queue;
+		}
+
+		/**
+		\brief Format and write everything queued so far, now, from the calling thread.
+		*/
+		void Flush()
+		{
+			std::lock_guard<std::mutex> lock(write_mutex_);
+
+			std::vector<std::shared_ptr<ThreadQueue>> queues;
+			{
+				std::lock_guard<std::mutex> queues_lock(queues_mutex_);
+				queues = queues_;
+			}
+
+			std::vector<Record> records;
+			std::uint64_t dropped = 0;
+			for (auto& q : queues)
+				dropped += q->Take(records);
+
+			// each queue is in order, but threads interleave
+			std::stable_sort(records.begin(), records.end(), [](Record const& a, Record const& b){ return a.time < b.time; });
+
+			for (auto const& r : records)
+				sink_(r.severity, detail::Format(*r.payload));
+
+			if (dropped)
+				sink_(severity_level::warning, std::to_string(dropped) + " log messages dropped, their queues being full");
+
+			Category::ForEach([this](Category & c)
+			{
+				if (auto suppressed = c.TakeSuppressed())
+					sink_(severity_level::warning, std::to_string(suppressed) + " log messages of category " + c.Name() + " suppressed by its rate limit");
+			});
+		}
+
+		/**
+		\brief Writes to Boost.Log, from whichever thread calls it.
+		*/
+		static void BoostLogSink(severity_level severity, std::string const& message)
+		{
+			BOOST_LOG_SEV(logging::trivial::logger::get(), severity) << message;
+		}
+
+	private:
+
+		void WriteLoop()
+		{
+			std::unique_lock<std::mutex> lock(wake_mutex_);
+			while (!stop_)
+			{
+				wake_.wait_for(lock, flush_interval_);
+				lock.unlock();
+				Flush();
+				lock.lock();
+			}
+		}
+
+		static std::atomic<AsyncLogger*>& ActivePointer()
+		{
+			static std::atomic<AsyncLogger*> active{nullptr};
+			return active;
+		}
+
+		static std::uint64_t NextId()
+		{
+			static std::atomic<std::uint64_t> next{1};
+			return next.fetch_add(1);
+		}
+
+		std::size_t queue_capacity_;
+		std::chrono::milliseconds flush_interval_;
+		Sink sink_;
+		const std::uint64_t id_; ///< distinguishes this logger from earlier ones at the same address, for the threads' cached queues
+
+		std::mutex queues_mutex_; ///< guards the list of queues
+		std::vector<std::shared_ptr<ThreadQueue>> queues_;
+
+		std::mutex write_mutex_; ///< one writer at a time, so messages leave in order
+
+		std::mutex wake_mutex_;
+		std::condition_variable wake_;
+		bool stop_ = false;
+		std::thread writer_;
+	};
+
+
+
+	/**
+	\brief Whether a message would be logged: whether it is at least the MinimumSeverity, which LoggingInit sets to the level of the Boost.Log filter.  Takes a token from a rate limited category.
+	*/
+	inline
+	bool Enabled(severity_level severity, Category & category)
+	{
+		return static_cast<int>(severity) >= MinimumSeverity().load(std::memory_order_relaxed) && category.Admit();
+	}
+
+
+	/**
+	\brief Log a message, made of pieces, without checking whether it is enabled.  Use the BERTINI_LOG_ macros instead, which do.
+	*/
+	template<typename ...Args>
+	void Submit(severity_level severity, Args&& ...args)
+	{
+		auto payload = detail::MakePayload(std::forward<Args>(args)...);
+		if (auto logger = AsyncLogger::Active())
+			logger->ThisThreadQueue().Push(Record{severity, Clock::now(), std::move(payload)});
+		else
+			AsyncLogger::BoostLogSink(severity, detail::Format(*payload));
+	}
+
+} // namespace async_logging
+} // namespace bertini
+
+
+
+#define BERTINI_LOG_AT(severity, category, ...) \
+	do { \
+		if (::bertini::async_logging::Enabled(severity, category)) \
+			::bertini::async_logging::Submit(severity, __VA_ARGS__); \
+	} while (false)
+
+#if BERTINI_LOG_LEVEL <= 0
+#define BERTINI_LOG_TRACE(category, ...) BERTINI_LOG_AT(::bertini::severity_level::trace, category, __VA_ARGS__)
+#else
+#define BERTINI_LOG_TRACE(category, ...) ((void)0)
+#endif
+
+#if BERTINI_LOG_LEVEL <= 1
+#define BERTINI_LOG_DEBUG(category, ...) BERTINI_LOG_AT(::bertini::severity_level::debug, category, __VA_ARGS__)
+#else
+#define BERTINI_LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if BERTINI_LOG_LEVEL <= 2
+#define BERTINI_LOG_INFO(category, ...) BERTINI_LOG_AT(::bertini::severity_level::info, category, __VA_ARGS__)
+#else
+#define BERTINI_LOG_INFO(category, ...) ((void)0)
+#endif
+
+#if BERTINI_LOG_LEVEL <= 3
+#define BERTINI_LOG_WARNING(category, ...) BERTINI_LOG_AT(::bertini::severity_level::warning, category, __VA_ARGS__)
+#else
+#define BERTINI_LOG_WARNING(category, ...) ((void)0)
+#endif
+
+#if BERTINI_LOG_LEVEL <= 4
+#define BERTINI_LOG_ERROR(category, ...) BERTINI_LOG_AT(::bertini::severity_level::error, category, __VA_ARGS__)
+#else
+#define BERTINI_LOG_ERROR(category, ...) ((void)0)
+#endif
+
+#define BERTINI_LOG_FATAL(category, ...) BERTINI_LOG_AT(::bertini::severity_level::fatal, category, __VA_ARGS__)
+
+#endif
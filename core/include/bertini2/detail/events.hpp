@@ -42,8 +42,40 @@
 #ifndef BERTINI_DETAIL_EVENTS_HPP
 #define BERTINI_DETAIL_EVENTS_HPP
 #include <boost/type_index.hpp>
+
+#include <atomic>
+
+#include "bertini2/detail/typelist.hpp"
+
 namespace bertini {
 
+	/**
+	\brief Identifies an event type at run time, for looking up who subscribes to it.
+
+	Ids are handed out in order of first use, so they mean nothing across runs.
+	*/
+	using EventId = std::size_t;
+
+	namespace detail {
+		inline
+		EventId NextEventId()
+		{
+			static std::atomic<EventId> next{0};
+			return next++;
+		}
+	}
+
+	/**
+	\brief The run-time id of an event type.
+	*/
+	template<typename EventT>
+	EventId EventIdOf()
+	{
+		static const EventId id = detail::NextEventId();
+		return id;
+	}
+
+
 	/**
 	\brief Strawman Event type, enabling polymorphism.
 
@@ -53,17 +85,30 @@ namespace bertini {
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
 		virtual ~AnyEvent() = default;
+
+		/**
+		\brief The event type followed by its ancestors, most derived first.  Every event type must declare its own, so observers subscribed to a base type get the derived ones too.
+
+		\see EventLineage
+		*/
+		using Lineage = detail::TypeList<AnyEvent>;
 	};
 
+	/**
+	\brief The Lineage of an event type, given its parent.
+	*/
+	template<class EventT, class ParentT>
+	using EventLineage = typename detail::ListCat<detail::TypeList<EventT>, typename ParentT::Lineage>::type;
+
 	template<class ObsT, bool IsConst = true>
 	class Event;
 
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Observers subscribe to the event types they want, and only those are constructed and delivered; see EventObserver.
 
-	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
+	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers<Event<T>>(*this)`, which constructs the event only if someone subscribes to it.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
 	\tparam ObsT The Observed type.  When emitting an event, you pass in the type of object emitting the event, and the object itself.  Then the observer can `Get` the emitting object, and do (const) stuff to it.
 
@@ -89,7 +134,7 @@ namespace bertini {
 
 		\return The observable who emitted the event.  This permits calls of arbitrary const functions, particularly getters.
 
-		\see AMPPathAccumulator for simple example of filtering using `dynamic_cast`s
+		\see AMPPathAccumulator for a simple example of subscribing to an event
 		*/
 		ObsT const& Get() const
 		{return current_observable_;}
@@ -97,6 +142,7 @@ namespace bertini {
 		Event() = delete;
 
 		using HeldT = const ObsT&;
+		using Lineage = EventLineage<Event, AnyEvent>;
 	protected:
 		const ObsT& current_observable_;
 	};
@@ -105,9 +151,9 @@ namespace bertini {
 	/**
 	\brief For emission of events from observables.
 	
-	An observable object probably wants to emit events to notify observers that things are happening.  The observers filter the events, at this time by dynamic casting (slow, I know, but it works for now.  Premature optimization, etc.)  A better method than dynamic casting would be to filter based on a union of bits or something.  If you, the reader, want to help make this better, please contact a developer!
+	An observable object probably wants to emit events to notify observers that things are happening.  Observers subscribe to the event types they want, and only those are constructed and delivered; see EventObserver.
 
-	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers(Event<T>(*this))`.  Then an Observer can filter based on a heirarchy of event types, etc.  
+	Say I am an observable object, and I want to emit an event.  Events attach the type of object emitting them, and in fact (a refence to) the emitter itself.  So if my type is `T`, I would do something like `NotifyObservers<Event<T>>(*this)`, which constructs the event only if someone subscribes to it.  Then an Observer can filter based on a heirarchy of event types, etc.  
 
 	\tparam ObsT The Observed type.  When emitting an event, you pass in the type of object emitting the event, and the object itself.  Then the observer can `Get` the emitting object, and do (const) stuff to it.
 
@@ -133,7 +179,7 @@ namespace bertini {
 
 		\return The observable who emitted the event.  This permits calls of arbitrary const functions, particularly getters.
 
-		\see AMPPathAccumulator for simple example of filtering using `dynamic_cast`s
+		\see AMPPathAccumulator for a simple example of subscribing to an event
 		*/
 		ObsT & Get()
 		{return current_observable_;}
@@ -141,6 +187,7 @@ namespace bertini {
 		Event() = delete;
 
 		using HeldT = ObsT&;
+		using Lineage = EventLineage<Event, AnyEvent>;
 	protected:
 		ObsT& current_observable_;
 	};
@@ -162,6 +209,7 @@ namespace bertini {
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS \
 	public: \
 		using HeldT = typename event_parenttype<ObservedT>::HeldT; \
+		using Lineage = EventLineage<event_name, event_parenttype<ObservedT>>; \
 		event_name(HeldT obs) : event_parenttype<ObservedT>(obs){} \
 		virtual ~event_name() = default; \
 		event_name() = delete; }
@@ -36,6 +36,11 @@
 #include "bertini2/detail/observer.hpp"
 #include "bertini2/detail/events.hpp"
 
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <vector>
+
 namespace bertini{
 
 	/**
@@ -56,23 +61,69 @@ namespace bertini{
 		void AddObserver(AnyObserver* new_observer) const
 		{
 			if (find(begin(current_watchers_), end(current_watchers_), new_observer)==end(current_watchers_))
+			{
 				current_watchers_.push_back(new_observer);
+				ForgetSubscribers();
+			}
 		}
 
 		/**
 		\brief Remove an observer from this observable.
+
+		An observer may remove itself, or another, while observing.
 		*/
 		void RemoveObserver(AnyObserver* observer) const
 		{
 			current_watchers_.erase(std::remove(current_watchers_.begin(), current_watchers_.end(), observer), current_watchers_.end());
+
+			// don't stop a notification which is underway from reaching the rest of its subscribers
+			for (auto& slot : subscribers_)
+				for (auto& s : slot.subscribers)
+					if (s.observer==observer)
+						s.observer = nullptr;
+			ForgetSubscribers();
 		}
 
 	protected:
 
 		/**
-		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object.
+		\brief Construct an event and send it to the observers who subscribe to its type, or any of its ancestors.  If there are none, the event isn't constructed at all.
+
+		Who subscribes is worked out the first time an event type is emitted after the observers change, and kept in a table indexed by the type's EventId.
 
-		This function could potentially be improved by filtering on the observer's desired event types, if known at compile time.  This could potentially be a performance bottleneck (hopefully not!) since filtering can use `dynamic_cast`ing.  One hopes this cost is overwhelmed by things like linear algebra and system evaluation.
+		\tparam EventT The type of event to emit.  Must be derived from AnyEvent, and declare its Lineage.
+		\param args The arguments to construct the event from, starting with the emitting object.
+		*/
+		template<class EventT, typename... ArgsT>
+		void NotifyObservers(ArgsT&&... args) const
+		{
+			static_assert(std::is_same<typename detail::ListFront<typename EventT::Lineage>::type, EventT>::value, "the event type must declare its own Lineage");
+
+			const auto id = EventIdOf<EventT>();
+			if (id >= subscribers_.size() || !subscribers_[id].known)
+				FindSubscribers(id, LineageIds(static_cast<typename EventT::Lineage*>(nullptr)));
+
+			if (subscribers_[id].subscribers.empty())
+				return;
+
+			const EventT e(std::forward<ArgsT>(args)...);
+
+			++notifying_;
+			// by index, because observers may add or remove observers, or emit, while observing
+			for (std::size_t ii = 0; ii < subscribers_[id].subscribers.size(); ++ii)
+			{
+				auto s = subscribers_[id].subscribers[ii];
+				if (s.observer)
+					s.observer->Deliver(e, s.subscription);
+			}
+			if (--notifying_==0 && stale_)
+				ForgetSubscribers();
+		}
+
+		/**
+		\brief Sends an already-constructed Event (more particularly, AnyEvent) to all watching observers of this object, whatever they subscribe to.
+
+		Prefer the typed NotifyObservers<EventT>, which sends only to subscribers, and constructs the event only if there are any.
 
 		\param e The event to emit.  Its type should be derived from AnyEvent.
 		*/
@@ -94,9 +145,65 @@ namespace bertini{
 
 	private:
 
+		// takes a pointer, so the typelist is never instantiated
+		template<class... EventTs>
+		static
+		std::array<EventId, sizeof...(EventTs)> const& LineageIds(detail::TypeList<EventTs...>*)
+		{
+			static const std::array<EventId, sizeof...(EventTs)> ids{{EventIdOf<EventTs>()...}};
+			return ids;
+		}
+
+		template<std::size_t N>
+		void FindSubscribers(EventId id, std::array<EventId, N> const& lineage) const
+		{
+			if (id >= subscribers_.size())
+				subscribers_.resize(id+1);
+
+			auto& slot = subscribers_[id];
+			slot.subscribers.clear();
+			for (auto obs : current_watchers_)
+			{
+				auto subscription = obs->Subscription(lineage.data(), N);
+				if (subscription!=AnyObserver::NotSubscribed)
+					slot.subscribers.push_back({obs, subscription});
+			}
+			slot.known = true;
+		}
+
+		/**
+		\brief Make every event type look up its subscribers again, when next emitted.  Deferred while a notification is underway.
+		*/
+		void ForgetSubscribers() const
+		{
+			if (notifying_)
+			{
+				stale_ = true;
+				return;
+			}
+			for (auto& slot : subscribers_)
+				slot.known = false;
+			stale_ = false;
+		}
+
 		using ObserverContainer = std::vector<AnyObserver*>;
 
+		struct Subscriber
+		{
+			AnyObserver* observer;
+			int subscription;
+		};
+
+		struct Subscribers
+		{
+			bool known = false;
+			std::vector<Subscriber> subscribers;
+		};
+
 		mutable ObserverContainer current_watchers_;
+		mutable std::vector<Subscribers> subscribers_; // indexed by EventId
+		mutable unsigned notifying_ = 0;
+		mutable bool stale_ = false;
 	};
 
 } // namespace bertini
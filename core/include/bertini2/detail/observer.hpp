@@ -33,6 +33,7 @@
 #ifndef BERTINI_DETAIL_OBSERVER_HPP
 #define BERTINI_DETAIL_OBSERVER_HPP
 
+#include <initializer_list>
 #include <tuple>
 #include <utility>
 
@@ -64,6 +65,35 @@ namespace bertini{
 		\param e The event which was emitted by the observed object.
 		*/
 		virtual void Observe(AnyEvent const& e) = 0;
+
+
+		enum : int
+		{
+			NotSubscribed = -1, ///< The observer doesn't want the event.
+			ObservesAll = -2 ///< The observer takes every event, through Observe.
+		};
+
+		/**
+		\brief Which of this observer's subscriptions an event goes to.  Asked by an Observable once per event type, not once per event.
+
+		Observers which don't declare subscriptions see every event.
+
+		\param lineage The ids of the event type and its ancestors, most derived first.
+		\param length The number of ids in the lineage.
+		\return An index to pass to Deliver, NotSubscribed, or ObservesAll.
+		*/
+		virtual int Subscription(EventId const* lineage, std::size_t length) const
+		{
+			return ObservesAll;
+		}
+
+		/**
+		\brief Deliver an event to the subscription Subscription picked for its type.
+		*/
+		virtual void Deliver(AnyEvent const& e, int subscription)
+		{
+			Observe(e);
+		}
 	};
 
 
@@ -86,6 +116,99 @@ namespace bertini{
 
 
 
+
+	namespace detail {
+		/**
+		\brief The handler for one event type in an EventObserver.
+		*/
+		template<class EventT>
+		class EventHandler
+		{
+		public:
+			virtual ~EventHandler() = default;
+
+			virtual void Observe(EventT const& e) = 0;
+		};
+	}
+
+
+	/**
+	\brief An observer which subscribes to a list of event types, with an Observe overload for each.
+
+	Events are delivered through a table of handlers indexed by subscription, so there is no chain of `dynamic_cast`s, and an observable doesn't even construct events nobody subscribes to.  An event goes to the first subscription in the list which it is an instance of, so subscribing to a base event type, like TrackingEvent, catches everything derived from it which isn't listed before it.
+
+	\code
+	template<class TrackerT>
+	class StepCounter : public EventObserver<TrackerT, detail::TypeList<SuccessfulStep<TrackerT>, FailedStep<TrackerT>>>
+	{
+		void Observe(SuccessfulStep<TrackerT> const& e) override {++succeeded;}
+		void Observe(FailedStep<TrackerT> const& e) override {++failed;}
+		...
+	};
+	\endcode
+
+	\tparam ObservedT The type of object observed.
+	\tparam EventsT A detail::TypeList of the event types to subscribe to.
+	*/
+	template<class ObservedT, class EventsT>
+	class EventObserver;
+
+	template<class ObservedT, class... EventTs>
+	class EventObserver<ObservedT, detail::TypeList<EventTs...>> : public Observer<ObservedT>, public detail::EventHandler<EventTs>...
+	{ BOOST_TYPE_INDEX_REGISTER_CLASS
+	public:
+
+		using Subscriptions = detail::TypeList<EventTs...>;
+
+		virtual ~EventObserver() = default;
+
+		int Subscription(EventId const* lineage, std::size_t length) const override
+		{
+			static const EventId subscribed[] = {EventIdOf<EventTs>()...};
+			for (std::size_t ii = 0; ii < sizeof...(EventTs); ++ii)
+				for (std::size_t jj = 0; jj < length; ++jj)
+					if (subscribed[ii]==lineage[jj])
+						return static_cast<int>(ii);
+			return AnyObserver::NotSubscribed;
+		}
+
+		void Deliver(AnyEvent const& e, int subscription) override
+		{
+			using HandlerT = void (*)(EventObserver&, AnyEvent const&);
+			static const HandlerT handlers[] = {&Handle<EventTs>...};
+			handlers[subscription](*this, e);
+		}
+
+		/**
+		\brief For events sent without their type, such as through a MultiObserver.  Falls back to casting.
+		*/
+		void Observe(AnyEvent const& e) override
+		{
+			bool handled = false;
+			(void) std::initializer_list<int>{(handled = handled || TryHandle<EventTs>(e), 0)...};
+		}
+
+	private:
+
+		template<class EventT>
+		static
+		void Handle(EventObserver& self, AnyEvent const& e)
+		{
+			static_cast<detail::EventHandler<EventT>&>(self).Observe(static_cast<EventT const&>(e));
+		}
+
+		template<class EventT>
+		bool TryHandle(AnyEvent const& e)
+		{
+			auto p = dynamic_cast<EventT const*>(&e);
+			if (p)
+				static_cast<detail::EventHandler<EventT>&>(*this).Observe(*p);
+			return p!=nullptr;
+		}
+	};
+
+
+
 	
 	/**
 	\brief A class which can glob together observer types into a new, single observer type.
@@ -110,8 +233,20 @@ namespace bertini{
 		void Observe(AnyEvent const& e) override
 		{	
 		    using namespace boost::fusion;
-		    auto f = [&e](auto &obs) { obs.Observe(e); };
+		    auto f = [&e](AnyObserver &obs) { obs.Observe(e); };
+		    for_each(observers_, f);
+		}
+
+		/**
+		\brief Subscribes to an event type if any of the glued observers does.
+		*/
+		int Subscription(EventId const* lineage, std::size_t length) const override
+		{
+		    using namespace boost::fusion;
+		    bool wanted = false;
+		    auto f = [&](AnyObserver const& obs) { wanted = wanted || obs.Subscription(lineage, length)!=AnyObserver::NotSubscribed; };
 		    for_each(observers_, f);
+		    return wanted ? AnyObserver::ObservesAll : AnyObserver::NotSubscribed;
 		}
 
 		std::tuple<ObserverTypes<ObservedT>...> observers_;
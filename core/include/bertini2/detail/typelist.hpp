@@ -82,6 +82,20 @@ struct ListCat <TypeList<Ps...>, TypeList<Qs...>, TypeList<Rs...>>
 	using type = TypeList<Ps..., Qs..., Rs...>;
 };
 
+
+
+/**
+\brief The first type in a typelist, get via ::type
+*/
+template <typename ListT>
+struct ListFront {};
+
+template <typename T, typename ... Ts>
+struct ListFront <TypeList<T, Ts...>>
+{
+	using type = T;
+};
+
 }} // close namespaces
 
 
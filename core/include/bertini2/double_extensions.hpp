@@ -33,6 +33,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <random>
 #include <complex>
 
@@ -60,14 +62,31 @@ namespace bertini{
 	}
 
 
+	/**
+	\brief A seed for a thread's random engine, different every call.
+
+	The random engines are thread_local, as trackers on several threads at once draw random numbers at every step.  Seeded by default, they would all draw the same stream.  Instead each is seeded with the next of a sequence of well-mixed values, counted from a fixed base seed, so the threads draw different streams.
+	*/
+	inline
+	std::uint32_t EngineSeed()
+	{
+		static std::atomic<std::uint64_t> num_seeded{0};
+		// splitmix64 of the count, so nearby counts give unrelated seeds
+		std::uint64_t z = 0x5EED5EED5EED5EEDull + 0x9E3779B97F4A7C15ull * (num_seeded++ + 1);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return static_cast<std::uint32_t>(z ^ (z >> 31));
+	}
+
+
 	/**
 	\brief Gets you a random real number between -1 and 1, fwiw
 	*/
 	inline
 	double RandReal()
 	{
-		static std::default_random_engine generator;
-		static std::uniform_real_distribution<double> distribution(-1.0,1.0);
+		thread_local std::default_random_engine generator(EngineSeed());
+		thread_local std::uniform_real_distribution<double> distribution(-1.0,1.0);
 		return distribution(generator);
 	}
 
@@ -440,38 +440,37 @@ namespace bertini {
 	};
 
 	/**
-	\brief Check the diagonal elements of an LU decomposition for small values and large ratios.
+	\brief Check the diagonal of the upper triangular factor of an LU decomposition for small values and large ratios.
 
 	\return Success if things are ok.  LargeChange or SmallValue if one is found.
 
-	This function requires a square non-empty matrix.
+	This function requires a non-empty vector.
 
-	\tparam Derived Matrix type from Eigen.
+	\tparam Derived Vector type from Eigen.
 	*/
 	template <typename Derived>
-	MatrixSuccessCode LUPartialPivotDecompositionSuccessful(Eigen::MatrixBase<Derived> const& LU)
+	MatrixSuccessCode LUDiagonalSuccessful(Eigen::MatrixBase<Derived> const& U_diagonal)
 	{
 		#ifndef BERTINI_DISABLE_ASSERTS
-			assert(LU.rows()==LU.cols() && "non-square matrix in LUPartialPivotDecompositionSuccessful");
-			assert(LU.rows()>0 && "empty matrix in LUPartialPivotDecompositionSuccessful");
+			assert(U_diagonal.size()>0 && "empty diagonal in LUDiagonalSuccessful");
 		#endif
 
-			// this loop won't test entry (0,0).  it's tested separately after.
-		for (unsigned int ii = LU.rows()-1; ii > 0; ii--)
+			// this loop won't test entry 0.  it's tested separately after.
+		for (unsigned int ii = U_diagonal.size()-1; ii > 0; ii--)
 		{
-			if (IsSmallValue(LU(ii,ii)))
+			if (IsSmallValue(U_diagonal(ii)))
 			{
 				return MatrixSuccessCode::SmallValue;
 			}
 
-			if (IsLargeChange(LU(ii-1,ii-1),LU(ii,ii)))
+			if (IsLargeChange(U_diagonal(ii-1),U_diagonal(ii)))
 			{
 				return MatrixSuccessCode::LargeChange;
 			}
 		}
 
-		// this line is the reason for the above assert on non-empty matrix.
-		if (IsSmallValue(LU(0,0)))
+		// this line is the reason for the above assert on non-empty vector.
+		if (IsSmallValue(U_diagonal(0)))
 		{
 			return MatrixSuccessCode::SmallValue;
 		}
@@ -479,6 +478,26 @@ namespace bertini {
 		return MatrixSuccessCode::Success;
 	}
 
+	/**
+	\brief Check the diagonal elements of an LU decomposition for small values and large ratios.
+
+	\return Success if things are ok.  LargeChange or SmallValue if one is found.
+
+	This function requires a square non-empty matrix.
+
+	\tparam Derived Matrix type from Eigen.
+	*/
+	template <typename Derived>
+	MatrixSuccessCode LUPartialPivotDecompositionSuccessful(Eigen::MatrixBase<Derived> const& LU)
+	{
+		#ifndef BERTINI_DISABLE_ASSERTS
+			assert(LU.rows()==LU.cols() && "non-square matrix in LUPartialPivotDecompositionSuccessful");
+			assert(LU.rows()>0 && "empty matrix in LUPartialPivotDecompositionSuccessful");
+		#endif
+
+		return LUDiagonalSuccessful(LU.diagonal());
+	}
+
 	/**
 	\brief Make a Kahan matrix with a given number type.
 	*/
@@ -119,7 +119,7 @@ public:
 			DefaultPrecision(higher_precision);
 			this->GetTracker().ChangePrecision(higher_precision);
 
-			NotifyObservers(PrecisionChanged<EmitterType>(*this, prev_precision, higher_precision));
+			NotifyObservers<PrecisionChanged<EmitterType>>(*this, prev_precision, higher_precision);
 
 			auto next_sample_higher_prec = current_sample;
 			Precision(next_sample_higher_prec, higher_precision);
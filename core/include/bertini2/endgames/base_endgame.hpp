@@ -179,7 +179,7 @@ public:
 				// BOOST_LOG_TRIVIAL(severity_level::trace) << "refining failed, code " << int(refine_success);
 				return refine_success;
 			}
-			NotifyObservers(SampleRefined<EmitterType>(AsFlavor()));
+			this->template NotifyObservers<SampleRefined<EmitterType>>(AsFlavor());
 		}
 
 		if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
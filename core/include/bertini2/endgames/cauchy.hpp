@@ -411,7 +411,7 @@ public:
 				return tracking_success;
 			}
 
-			NotifyObservers(CircleAdvanced<EmitterType>(*this, next_sample, next_time));
+			this->template NotifyObservers<CircleAdvanced<EmitterType>>(*this, next_sample, next_time);
 			
 
 			this->EnsureAtPrecision(next_time,Precision(next_sample)); assert(Precision(next_time)==Precision(next_sample));
@@ -429,7 +429,7 @@ public:
 
 			AddToCauchyData(next_time, next_sample);
 
-			NotifyObservers(SampleRefined<EmitterType>(*this));
+			this->template NotifyObservers<SampleRefined<EmitterType>>(*this);
 		}
 
 		return SuccessCode::Success;
@@ -746,7 +746,7 @@ public:
 				{
 					if (CheckClosedLoop<CT>())
 					{//error is small enough, exit the loop with success. 
-						NotifyObservers(ClosedLoop<EmitterType>(*this));
+						this->template NotifyObservers<ClosedLoop<EmitterType>>(*this);
 						initial_cauchy_loop_success = SuccessCode::Success;
 						loop_hasnt_closed = false;
 						break;
@@ -888,7 +888,7 @@ public:
 
 		}//end while
 
-		NotifyObservers(InEGOperatingZone<EmitterType>(*this));
+		this->template NotifyObservers<InEGOperatingZone<EmitterType>>(*this);
 
 		return SuccessCode::Success;
 	}
@@ -987,7 +987,7 @@ public:
 				return SuccessCode::Success;
 			}
 		} 
-		NotifyObservers(CycleNumTooHigh<EmitterType>(*this));
+		this->template NotifyObservers<CycleNumTooHigh<EmitterType>>(*this);
 		return SuccessCode::CycleNumTooHigh;
 	}//end ComputeCauchySamples
 
@@ -1025,7 +1025,7 @@ public:
 		this->EnsureAtPrecision(next_time,Precision(next_sample));
 		RotateOntoPS(next_time, next_sample);
 
-		NotifyObservers(TimeAdvanced<EmitterType>(*this));
+		this->template NotifyObservers<TimeAdvanced<EmitterType>>(*this);
 		return SuccessCode::Success;
 	}
 
@@ -1101,11 +1101,11 @@ public:
 				return extrapolation_success;
 
 			approx_error = static_cast<NumErrorT>((latest_approx - prev_approx).template lpNorm<Eigen::Infinity>());
-			NotifyObservers(ApproximatedRoot<EmitterType>(*this));
+			this->template NotifyObservers<ApproximatedRoot<EmitterType>>(*this);
 
 			if (approx_error < this->FinalTolerance())
 			{
-				NotifyObservers(Converged<EmitterType>(*this));
+				this->template NotifyObservers<Converged<EmitterType>>(*this);
 				return SuccessCode::Success;
 			}
 
@@ -1116,7 +1116,7 @@ public:
 				if (norm_of_dehom_prev   > this->SecuritySettings().max_norm &&  
 					norm_of_dehom_latest > this->SecuritySettings().max_norm  )
 				{
-					NotifyObservers(SecurityMaxNormReached<EmitterType>(*this));
+					this->template NotifyObservers<SecurityMaxNormReached<EmitterType>>(*this);
 					return SuccessCode::SecurityMaxNormReached;
 				}
 			}
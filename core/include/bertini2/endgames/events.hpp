@@ -92,6 +92,8 @@ namespace bertini {
 	class CircleAdvanced : public EndgameEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<CircleAdvanced, EndgameEvent<ObservedT>>;
+
 
 		using CT = typename ObservedT::BaseComplexType;
 		/**
@@ -152,6 +154,8 @@ namespace bertini {
 	class PrecisionChanged : public EndgameEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<PrecisionChanged, EndgameEvent<ObservedT>>;
+
 		/**
 		\brief The constructor for a PrecisionChanged Event.
 
@@ -32,7 +32,7 @@
 #pragma once
 
 #include "bertini2/endgames/events.hpp"
-#include "bertini2/logging.hpp"
+#include "bertini2/async_logging.hpp"
 #include <boost/type_index.hpp>
 
 namespace bertini {
@@ -46,60 +46,70 @@ namespace bertini {
 \ingroup loggers observers
 */
 template <typename EndgameT>
-struct GoryDetailLogger : public Observer<EndgameT>
+struct GoryDetailLogger : public EventObserver<EndgameT, detail::TypeList<
+								TimeAdvanced<EndgameT>,
+								SampleRefined<EndgameT>,
+								CircleAdvanced<EndgameT>,
+								ClosedLoop<EndgameT>,
+								ApproximatedRoot<EndgameT>,
+								PrecisionChanged<AMPEndgame>,
+								InEGOperatingZone<EndgameT>,
+								Converged<EndgameT>,
+								Initializing<EndgameT>,
+								ConstEvent<EndgameT> > >
 {BOOST_TYPE_INDEX_REGISTER_CLASS
 
 using EmitterT = EndgameT;
 using BCT = typename EndgameT::BaseComplexType;
 
-virtual void Observe(AnyEvent const& e) override
+void Observe(TimeAdvanced<EmitterT> const& e) override
 {
-	if(auto p = dynamic_cast<const TimeAdvanced<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "time advanced " << p->Get().LatestTime();
-	}
-	
-	else if (auto p = dynamic_cast<const SampleRefined<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "refined a sample, huzzah";
-	}
-
-	else if (auto p = dynamic_cast<const CircleAdvanced<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "advanced around the circle, to " << p->NewSample()<< " at time " << p->NewTime();
-	}
-
-	else if (auto p = dynamic_cast<const ClosedLoop<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "closed a loop, cycle number " << p->Get().CycleNumber();
-	}
-	else if (auto p = dynamic_cast<const ApproximatedRoot<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "approximated the target root.  approximation " << p->Get().template FinalApproximation<BCT>() << " with error " << p->Get().ApproximateError();
-	}
-
-	else if (auto p = dynamic_cast<const PrecisionChanged<AMPEndgame>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "precision changed from  " << p->Previous() << " to " << p->Next();
-	}
-
-	else if (auto p = dynamic_cast<const InEGOperatingZone<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "made it to the endgame operating zone at time " << p->Get().LatestTime();
-	}
-
-	else if(auto p = dynamic_cast<const Converged<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "converged at time " << p->Get().LatestTime() << " with result " << p->Get().template FinalApproximation<BCT>() << " and residual " << p->Get().ApproximateError();
-	}
-	else if (auto p = dynamic_cast<const Initializing<EmitterT>*>(&e))
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "starting running " << boost::typeindex::type_id<EmitterT>().pretty_name();
-	}
-	else
-	{
-		BOOST_LOG_TRIVIAL(severity_level::debug) << "unprogrammed response for event of type " << boost::typeindex::type_id_runtime(e).pretty_name();
-	}
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "time advanced ", e.Get().LatestTime());
+}
+
+void Observe(SampleRefined<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "refined a sample, huzzah");
+}
+
+void Observe(CircleAdvanced<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "advanced around the circle, to ", e.NewSample(), " at time ", e.NewTime());
+}
+
+void Observe(ClosedLoop<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "closed a loop, cycle number ", e.Get().CycleNumber());
+}
+
+void Observe(ApproximatedRoot<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "approximated the target root.  approximation ", e.Get().template FinalApproximation<BCT>(), " with error ", e.Get().ApproximateError());
+}
+
+void Observe(PrecisionChanged<AMPEndgame> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "precision changed from  ", e.Previous(), " to ", e.Next());
+}
+
+void Observe(InEGOperatingZone<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "made it to the endgame operating zone at time ", e.Get().LatestTime());
+}
+
+void Observe(Converged<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "converged at time ", e.Get().LatestTime(), " with result ", e.Get().template FinalApproximation<BCT>(), " and residual ", e.Get().ApproximateError());
+}
+
+void Observe(Initializing<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "starting running ", boost::typeindex::type_id<EmitterT>().pretty_name());
+}
+
+void Observe(ConstEvent<EmitterT> const& e) override
+{
+	BERTINI_LOG_DEBUG(async_logging::categories::Endgame(), "unprogrammed response for event of type ", boost::typeindex::type_id_runtime(e).pretty_name());
 }
 
 }; // gory detail
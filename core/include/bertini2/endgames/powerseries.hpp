@@ -576,7 +576,7 @@ public:
 
   		if (abs(next_time - target_time) < this->EndgameSettings().min_track_time) // generalized for target_time not equal to 0.
   		{
-  			NotifyObservers(MinTrackTimeReached<EmitterType>(*this));
+  			this->template NotifyObservers<MinTrackTimeReached<EmitterType>>(*this);
   			return SuccessCode::MinTrackTimeReached;
   		}
 
@@ -584,7 +584,7 @@ public:
 			if (tracking_success != SuccessCode::Success)
 				return tracking_success;
 
-		NotifyObservers(InEGOperatingZone<EmitterType>(*this));
+		this->template NotifyObservers<InEGOperatingZone<EmitterType>>(*this);
 
 		this->EnsureAtPrecision(next_time,Precision(next_sample));
 	
@@ -600,13 +600,13 @@ public:
 										this->EndgameSettings().max_num_newton_iterations);
 		if (refine_success != SuccessCode::Success)
 		{
-			NotifyObservers(RefiningFailed<EmitterType>(*this));
+			this->template NotifyObservers<RefiningFailed<EmitterType>>(*this);
 			return refine_success;
 		}
 		
 		this->EnsureAtPrecision(times.back(),Precision(samples.back()));
 
-		NotifyObservers(SampleRefined<EmitterType>(*this));
+		this->template NotifyObservers<SampleRefined<EmitterType>>(*this);
 
 		// we keep one more samplepoint than needed around, for estimating the cycle number
 		if (times.size() > this->EndgameSettings().num_sample_points+1)
@@ -665,7 +665,7 @@ public:
 
 		if (initial_sample_success!=SuccessCode::Success)
 		{
-			NotifyObservers(EndgameFailure<EmitterType>(*this));
+			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 			return initial_sample_success;
 		}
 
@@ -694,7 +694,7 @@ public:
 	  		auto advance_code = AdvanceTime<CT>(target_time);
 	  		if (advance_code!=SuccessCode::Success)
 	 		{
-	 			NotifyObservers(EndgameFailure<EmitterType>(*this));
+	 			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 	 			return advance_code;
 	 		}
 
@@ -705,12 +705,12 @@ public:
 	 		extrapolation_code = ComputeApproximationOfXAtT0(latest_approx, target_time);
 	 		if (extrapolation_code!=SuccessCode::Success)
 	 		{
-	 			NotifyObservers(EndgameFailure<EmitterType>(*this));
+	 			this->template NotifyObservers<EndgameFailure<EmitterType>>(*this);
 	 			return extrapolation_code;
 	 		}
 
 	 		approx_error = static_cast<NumErrorT>((latest_approx - prev_approx).template lpNorm<Eigen::Infinity>());
-	 		NotifyObservers(ApproximatedRoot<EmitterType>(*this));
+	 		this->template NotifyObservers<ApproximatedRoot<EmitterType>>(*this);
 
 
 	 		if(this->SecuritySettings().level <= 0)
@@ -718,7 +718,7 @@ public:
 	 			norm_of_dehom_of_latest_approx = this->GetSystem().DehomogenizePoint(latest_approx).template lpNorm<Eigen::Infinity>();
 		 		if(norm_of_dehom_of_latest_approx > this->SecuritySettings().max_norm && norm_of_dehom_of_prev_approx > this->SecuritySettings().max_norm)
 		 		{
-		 			NotifyObservers(SecurityMaxNormReached<EmitterType>(*this));
+		 			this->template NotifyObservers<SecurityMaxNormReached<EmitterType>>(*this);
 	 				return SuccessCode::SecurityMaxNormReached;
 		 		}
 	 			norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
@@ -731,7 +731,7 @@ public:
 	 		prev_approx = latest_approx;
 		} //end while	
 
-		NotifyObservers(Converged<EmitterType>(*this));
+		this->template NotifyObservers<Converged<EmitterType>>(*this);
 		return SuccessCode::Success;
 
 	} //end PSEG
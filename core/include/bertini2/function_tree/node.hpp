@@ -43,9 +43,12 @@
 
 #include "bertini2/config.h"
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <tuple>
+#include <unordered_set>
 
 #include <boost/type_index.hpp>
 
@@ -54,6 +57,8 @@
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
@@ -123,6 +128,78 @@ namespace detail{
 
 	};
 }
+
+
+/**
+\brief The register holding the precision in which expression trees are evaluated in multiple precision, on this thread.
+
+Zero means there is no working precision, and each node evaluates in whatever precision it has.  Otherwise, each node compares its own precision to this one when it is evaluated, and adjusts itself if they differ.  So a change of precision costs nothing up front, and reaches only the nodes which are evaluated afterwards.
+
+\see WorkingPrecisionGuard
+*/
+inline
+unsigned& WorkingPrecision()
+{
+	static thread_local unsigned working_precision = 0;
+	return working_precision;
+}
+
+/**
+\brief Sets the working precision of expression trees on this thread for as long as it lives, and puts back the previous one after.
+
+System sets one of these around each evaluation, in the system's precision.
+*/
+class WorkingPrecisionGuard
+{
+public:
+	explicit
+	WorkingPrecisionGuard(unsigned prec) : previous_(WorkingPrecision())
+	{
+		WorkingPrecision() = prec;
+	}
+
+	~WorkingPrecisionGuard()
+	{
+		WorkingPrecision() = previous_;
+	}
+
+	WorkingPrecisionGuard(WorkingPrecisionGuard const&) = delete;
+	WorkingPrecisionGuard& operator=(WorkingPrecisionGuard const&) = delete;
+
+private:
+	unsigned previous_;
+};
+
+
+/**
+\brief What the value of a node depends on.
+
+Used to reset only those nodes whose values may have changed.  Combine with |.
+*/
+enum class Dependency : std::uint8_t
+{
+	None = 0, ///< constant
+	Space = 1, ///< any variable other than the path variable, including implicit parameters
+	Time = 2, ///< the path variable
+	All = 3
+};
+
+inline
+Dependency operator|(Dependency a, Dependency b)
+{
+	return static_cast<Dependency>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+}
+
+/**
+\brief Whether two dependencies have anything in common.
+*/
+inline
+bool Intersects(Dependency a, Dependency b)
+{
+	return (static_cast<std::uint8_t>(a) & static_cast<std::uint8_t>(b)) != 0;
+}
+
+
 /**
 An interface for all nodes in a function tree, and for a function object as well.  Almost all
  methods that will be called on a node must be declared in this class.  The main evaluation method is
@@ -218,6 +295,46 @@ public:
 	*/
 	virtual unsigned ReduceDepth();
 
+
+	/**
+	\brief Replace each child of this node with the result of a function applied to it.
+
+	Used by transforms which act on whole trees at once, such as merging common subexpressions.
+
+	\note The default implementation, for nodes without children, does nothing.
+	*/
+	virtual void TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f);
+
+
+	/**
+	\brief Get the data, other than its type and its children, which determine the value of this node.
+
+	Two nodes of the same type, with the same children and the same local data, are interchangeable.  Nodes which must never be interchanged with another, such as variables, give something unique to themselves.
+
+	\note The default implementation gives the empty string.
+	*/
+	virtual std::string LocalData() const;
+
+
+
+	/**
+	\brief Get what the value of this node depends on, as last tagged by TagDependencies.  Nodes which have never been tagged depend on everything.
+	*/
+	Dependency GetDependency() const
+	{
+		return dependency_;
+	}
+
+
+	/**
+	\brief Reset the stored values of this node and the nodes below it, skipping those which do not depend on what changed.
+
+	\param changed What has changed since the last reset.
+
+	\note The default implementation, for nodes without children, calls Reset() if this node depends on what changed.
+	*/
+	virtual void ResetDependentOn(Dependency changed) const;
+
 	/**
 	Virtual method for printing Nodes to arbitrary output streams.
 	*/
@@ -282,7 +399,9 @@ public:
 	
 	
 	/**
-	 Change the precision of this variable-precision tree node.
+	 Change the precision of this variable-precision tree node, and everything below it.
+
+	 There is usually no need to call this.  Nodes evaluated while a WorkingPrecision is set adjust themselves.
 	 
 	 \param prec the number of digits to change precision to.
 	 */
@@ -317,6 +436,9 @@ protected:
 	//We must hard code in all types that we want here.
 	//TODO: Initialize this to some default value, second = false
 	mutable std::tuple< std::pair<dbl,bool>, std::pair<mpfr,bool> > current_value_;
+
+
+	mutable Dependency dependency_ = Dependency::All; ///< what the value of this node depends on.  Computed by TagDependencies.
 	
 	
 	
@@ -362,15 +484,30 @@ protected:
 	*/
 	void ResetStoredValues() const;
 
+	/**
+	\brief Adjust this node alone, not the nodes below it, to a new precision.
+
+	Stored values are invalidated, and temporaries put in the new precision.  Called during evaluation when the node's precision differs from the WorkingPrecision.
+	*/
+	virtual void MatchPrecision(unsigned prec) const;
+
+	/**
+	\brief If there is a WorkingPrecision, and this node isn't in it, adjust this node to it.
+	*/
+	void MatchWorkingPrecision() const;
+
 	Node();
 
 private:
 	friend std::ostream& operator<<(std::ostream & out, const Node& N);
 
+	friend Dependency TagDependencies(std::shared_ptr<Node> const& n, std::shared_ptr<Variable> const& path_variable, std::unordered_set<Node const*> & visited);
+
 	friend class boost::serialization::access;
 
 	template <typename Archive>
 	void serialize(Archive& ar, const unsigned version) {
+		ar & dependency_;
 	}
 
 }; // re: class node
@@ -390,6 +527,20 @@ private:
 		return out;
 	}
 
+
+
+	/**
+	\brief Tag a tree with what the values of its nodes depend on, so that it can be reset selectively with ResetDependentOn.
+
+	Nodes are tagged from their children.  Variables depend on Time if they are the path variable, and on Space otherwise.  Differentials depend on everything.  Other nodes without children are constant.
+
+	\param n The root of the tree to tag.
+	\param path_variable The path variable, or nullptr if there is none.
+	\param visited Nodes already tagged, which are not tagged again.  Share it between trees with nodes in common.
+	\return What the root depends on.
+	*/
+	Dependency TagDependencies(std::shared_ptr<Node> const& n, std::shared_ptr<Variable> const& path_variable, std::unordered_set<Node const*> & visited);
+
 	} // re: namespace node
 } // re: namespace bertini
 
@@ -87,6 +87,19 @@ namespace node{
 		unsigned ReduceSubSums();
 		unsigned ReduceSubMults();
 
+		/**
+		The signs of the children, one character each.
+		*/
+		std::string LocalData() const override;
+
+		/**
+		\brief The signs of the children.  true means add, false means subtract.
+		*/
+		std::vector<bool> const& children_signs() const
+		{
+			return children_sign_;
+		}
+
 		SumOperator(const std::shared_ptr<Node> & s, bool add_or_sub)
 		{
 			AddChild(s, add_or_sub);
@@ -356,6 +369,19 @@ namespace node{
 		unsigned ReduceSubSums();
 		unsigned ReduceSubMults();
 
+		/**
+		Whether each child multiplies or divides, one character each.
+		*/
+		std::string LocalData() const override;
+
+		/**
+		\brief Whether each child multiplies or divides.  true means multiply, false means divide.
+		*/
+		std::vector<bool> const& children_mult_or_div() const
+		{
+			return children_mult_or_div_;
+		}
+
 		/**
 		 single-node instantiation.  
 		
@@ -503,6 +529,10 @@ namespace node{
 		unsigned EliminateZeros() override;
 		unsigned EliminateOnes() override;
 
+		void TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f) override;
+
+		void ResetDependentOn(Dependency changed) const override;
+
 		PowerOperator(const std::shared_ptr<Node> & new_base, const std::shared_ptr<Node> & new_exponent) : base_(new_base), exponent_(new_exponent)
 		{
 		}
@@ -518,6 +548,17 @@ namespace node{
 		{
 			exponent_ = new_exponent;
 		}
+
+
+		std::shared_ptr<Node> const& base() const
+		{
+			return base_;
+		}
+
+		std::shared_ptr<Node> const& exponent() const
+		{
+			return exponent_;
+		}
 		
 		
 		void Reset() const override;
@@ -567,6 +608,7 @@ namespace node{
 		{
 			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
 			val_pair.first.precision(prec);
+			val_pair.second = false;
 
 			base_->precision(prec);
 			exponent_->precision(prec);
@@ -633,6 +675,11 @@ namespace node{
 		
 		unsigned EliminateZeros() override;
 		unsigned EliminateOnes() override;
+
+		/**
+		The exponent.
+		*/
+		std::string LocalData() const override;
 		
 		/**
 		 polymorphic method for printing to an arbitrary stream.
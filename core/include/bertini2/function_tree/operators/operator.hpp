@@ -94,9 +94,15 @@ namespace node{
 		
 		
 		void Reset() const override;
+
+
+		void ResetDependentOn(Dependency changed) const override;
 		
 		
 		void SetChild(std::shared_ptr<Node> new_child);
+
+
+		void TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f) override;
 		
 		
 		
@@ -174,12 +180,27 @@ namespace node{
 		
 		
 		void Reset() const override;
+
+
+		void ResetDependentOn(Dependency changed) const override;
 		
 		// Add a child onto the container for this operator
 		virtual void AddChild(std::shared_ptr<Node> child);
 		
 		
 		size_t children_size() const;
+
+
+		/**
+		\brief Get the children of this operator, in order.
+		*/
+		std::vector< std::shared_ptr<Node> > const& children() const
+		{
+			return children_;
+		}
+
+
+		void TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f) override;
 		
 		std::shared_ptr<Node> first_child() const;
 		
@@ -203,6 +224,11 @@ namespace node{
 
 		// constructor is protected to help prevent instantiating empty operators
 		NaryOperator(){}
+
+		/**
+		\brief Adjust this node alone to a new precision, including any temporaries.
+		*/
+		void MatchPrecision(unsigned prec) const override;
 		
 	private:
 
@@ -92,12 +92,28 @@ namespace node{
 		 The function which flips the fresh eval bit back to fresh.
 		 */
 		void Reset() const override;
+
+
+		void ResetDependentOn(Dependency changed) const override;
 		
 		
 		/**
 		 Add a child onto the container for this operator
 		 */
 		void SetRoot(std::shared_ptr<Node> const& entry);
+
+
+
+		/**
+		 Replaces the entry node.
+		 */
+		void TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f) override;
+
+
+		/**
+		 Functions are named, and kept track of by the System, so they are only interchangeable with themselves.  This is the address of this one.
+		 */
+		std::string LocalData() const override;
 		
 		
 		/**
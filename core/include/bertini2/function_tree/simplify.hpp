@@ -37,10 +37,173 @@
 
 #include "bertini2/function_tree/node.hpp"
 
+#include <typeindex>
+#include <unordered_map>
+
 namespace bertini {
 
 unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n);
 
+
+
+/**
+\brief The number of distinct nodes in some trees, before and after merging their common subexpressions.
+
+A node reachable from several places counts once.
+*/
+struct NodeCounts
+{
+	std::size_t before = 0;
+	std::size_t after = 0;
+};
+
+
+
+/**
+\brief Merges structurally identical subtrees of function trees, so that each distinct subexpression is stored, and evaluated, once.
+
+Give it all the trees which should share subexpressions -- say, all the functions and all the derivatives of a system.  Nodes are merged bottom-up: two nodes are merged if they have the same type, the same LocalData(), and children which have already been merged.  Each node is looked up in a hash table once, so the cost is linear in the number of nodes.
+
+Merged trees are directed acyclic graphs.  Evaluation, resetting, precision changes, and serialization all work on these.  Transforms which rewrite a node to fit the context it appears in, like homogenization, do not, so merge after homogenizing.
+*/
+class SubexpressionMerger
+{
+public:
+
+	/**
+	\brief Merge the subexpressions of a tree, and replace the tree with its representative.
+	*/
+	void Merge(std::shared_ptr<node::Node> & root);
+
+	/**
+	\brief Merge the subexpressions below a root, keeping the root itself.
+
+	For Functions and Jacobians, which the System holds on to by their type.
+	*/
+	void MergeBelow(std::shared_ptr<node::Node> const& root);
+
+	/**
+	\brief The numbers of distinct nodes given to this merger so far, before and after merging.
+	*/
+	NodeCounts Counts() const
+	{
+		return NodeCounts{seen_.size(), unique_.size() + num_kept_roots_};
+	}
+
+private:
+
+	struct Key
+	{
+		std::type_index type;
+		std::string local_data;
+		std::vector<node::Node const*> children;
+
+		bool operator==(Key const& other) const
+		{
+			return type==other.type && local_data==other.local_data && children==other.children;
+		}
+	};
+
+	struct KeyHash
+	{
+		std::size_t operator()(Key const& k) const;
+	};
+
+	std::shared_ptr<node::Node> Representative(std::shared_ptr<node::Node> const& n);
+
+	std::unordered_map<Key, std::shared_ptr<node::Node>, KeyHash> unique_; ///< the representative for each distinct subexpression.
+	std::unordered_map<node::Node const*, std::shared_ptr<node::Node>> seen_; ///< the representative for every node visited, so shared nodes are only visited once.
+	std::size_t num_kept_roots_ = 0;
+};
+
+
+/**
+\brief Merge the common subexpressions of some trees, replacing each with its representative.
+
+\return The numbers of distinct nodes before and after.
+*/
+NodeCounts MergeCommonSubexpressions(std::vector<std::shared_ptr<node::Node>> & roots);
+
+
+
+
+/**
+\brief Replaces subtrees made only of integers and rationals, combined by arithmetic, with a single exact number.
+
+Sums, differences, products, quotients, negations, and integer powers of exact numbers are computed exactly, in complex rational arithmetic, and the subtree is replaced by a Rational, or an Integer if the value is one.  The replacement is evaluated once for each precision it is asked for, rather than the whole subtree being evaluated again.  Subtrees with a Float, a special number like pi, or any other function in them are left alone, since they are not exact.  Like SubexpressionMerger, each node is visited once, so shared subtrees are folded once.
+*/
+class ConstantFolder
+{
+public:
+
+	/**
+	\brief Fold the constants of a tree, replacing the root too if it is constant.
+	*/
+	void Fold(std::shared_ptr<node::Node> & root);
+
+	/**
+	\brief Fold the constants below a root, keeping the root itself.
+	*/
+	void FoldBelow(std::shared_ptr<node::Node> const& root);
+
+	/**
+	\brief The number of subtrees replaced so far.
+	*/
+	unsigned NumFolded() const
+	{
+		return num_folded_;
+	}
+
+	/**
+	\brief The largest magnitude of an integer exponent which is applied exactly.  Beyond it, the exact value gets too long to be worth it.
+	*/
+	static
+	int MaxExactExponent()
+	{
+		return 64;
+	}
+
+private:
+
+	struct Exact
+	{
+		mpq_rational real, imag;
+	};
+
+	std::shared_ptr<node::Node> Folded(std::shared_ptr<node::Node> const& n);
+
+	/**
+	\brief Compute the exact value of a node whose children have already been folded, if it has one.
+	*/
+	bool ExactValue(std::shared_ptr<node::Node> const& n, Exact & value) const;
+
+	static Exact Times(Exact const& a, Exact const& b);
+
+	/**
+	\brief Invert in place.  Fails for zero.
+	*/
+	static bool Invert(Exact & a);
+
+	/**
+	\brief Raise to an integer power in place.  Fails for negative powers of zero, and powers larger than MaxExactExponent().
+	*/
+	static bool RaiseTo(Exact & a, int exponent);
+
+	std::unordered_map<node::Node const*, std::shared_ptr<node::Node>> seen_; ///< the replacement for every node visited
+	std::unordered_map<node::Node const*, Exact> exact_; ///< the value of every exact node among the replacements
+	unsigned num_folded_ = 0;
+};
+
+
+/**
+\brief Fold the constant subtrees below a node.
+
+\return The number of subtrees replaced.
+
+\see ConstantFolder
+*/
+unsigned FoldConstants(std::shared_ptr<node::Node> const& n);
+
 } // namespace bertini
 
 
@@ -79,6 +79,11 @@ namespace node{
 
 		void print(std::ostream & target) const override;
 
+		/**
+		Differentials of the same variable are interchangeable, so this identifies the variable.
+		*/
+		std::string LocalData() const override;
+
 
 
 		/**
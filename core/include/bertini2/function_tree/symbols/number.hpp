@@ -151,7 +151,32 @@ namespace node{
 		
 	protected:
 
+		/**
+		\brief Get the value of this number in a precision, rounding it only if it isn't among the last few precisions asked for.
+
+		Rounding an exact or long value is much more costly than copying one, and evaluation goes back and forth between a few precisions, so the last few roundings are kept.
+
+		\param prec The precision wanted.
+		\param round Makes the value in a precision, given the precision.
+		*/
+		template<typename RoundT>
+		mpfr const& RoundedTo(unsigned prec, RoundT const& round) const
+		{
+			for (auto const& r : rounded_)
+				if (r.precision() == prec)
+					return r;
+
+			if (rounded_.size() >= MaxRoundings)
+				rounded_.erase(rounded_.begin());
+			rounded_.push_back(round(prec));
+			return rounded_.back();
+		}
+
 	private:
+
+		static constexpr std::size_t MaxRoundings = 4;
+		mutable std::vector<mpfr> rounded_; ///< the value, in each of the last few precisions used.  not serialized
+
 		friend class boost::serialization::access;
 
 		template <typename Archive>
@@ -194,6 +219,19 @@ namespace node{
 
 		void print(std::ostream & target) const override;
 
+		/**
+		The value, in base ten.
+		*/
+		std::string LocalData() const override;
+
+		/**
+		\brief The exact value.
+		*/
+		mpz_int const& value() const
+		{
+			return true_value_;
+		}
+
 
 	private:
 
@@ -257,6 +295,11 @@ namespace node{
 
 		void print(std::ostream & target) const override;
 
+		/**
+		The real and imaginary parts of the stored value, with all their digits.
+		*/
+		std::string LocalData() const override;
+
 
 
 
@@ -272,6 +315,11 @@ namespace node{
 		
 		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
 
+		/**
+		\brief The stored value, rounded to a precision.
+		*/
+		mpfr Round(unsigned prec) const;
+
 
 		mpfr highest_precision_value_;
 
@@ -354,6 +402,27 @@ namespace node{
 
 		void print(std::ostream & target) const override;
 
+		/**
+		The exact real and imaginary parts.
+		*/
+		std::string LocalData() const override;
+
+		/**
+		\brief The exact real part.
+		*/
+		mpq_rational const& real_value() const
+		{
+			return true_value_real_;
+		}
+
+		/**
+		\brief The exact imaginary part.
+		*/
+		mpq_rational const& imag_value() const
+		{
+			return true_value_imag_;
+		}
+
 
 
 
@@ -371,6 +440,11 @@ namespace node{
 		
 		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
 
+		/**
+		\brief The exact value, rounded to a precision.
+		*/
+		mpfr Round(unsigned prec) const;
+
 
 		mpq_rational true_value_real_, true_value_imag_;
 		Rational() = default;
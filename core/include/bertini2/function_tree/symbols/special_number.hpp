@@ -81,6 +81,11 @@ namespace node{
 			
 			void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
 
+			/**
+			\brief The value, computed in a precision.
+			*/
+			mpfr Round(unsigned prec) const;
+
 
 			friend class boost::serialization::access;
 
@@ -118,6 +123,11 @@ namespace node{
 			
 			void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override;
 
+			/**
+			\brief The value, computed in a precision.
+			*/
+			mpfr Round(unsigned prec) const;
+
 
 			friend class boost::serialization::access;
 
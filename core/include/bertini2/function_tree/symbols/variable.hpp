@@ -104,6 +104,11 @@ namespace node{
 		
 		void Reset() const override;
 
+		/**
+		Variables are only interchangeable with themselves, so this is the address of this one.
+		*/
+		std::string LocalData() const override;
+
 		/**
 		Compute the degree with respect to a single variable.
 
@@ -0,0 +1,445 @@
+//This file is part of Bertini 2.
+//
+//bertini2/io/binary.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/io/binary.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/io/binary.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/io/binary.hpp
+
+\brief Provides low-level binary encoding of Bertini2 number types, and the files they are written to.
+
+Numbers are written in native byte order.  Doubles are written as raw IEEE words, and `mpfr_float`s are written as their precision in bits, kind, exponent, and raw limb data, so that the round trip is exact at any precision.
+
+The files are plain POSIX file descriptors, so that appending can be synced to disk in batches, and reading can be done through a single `mmap`.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/common/config.hpp"
+#include "bertini2/io/file_utilities.hpp"
+
+namespace bertini{
+	namespace binary{
+
+		/**
+		\brief Tags for the number type stored in a binary file, so that a reader can refuse a file written with a different one.
+		*/
+		enum class NumberType : std::uint32_t
+		{
+			Double = 0,
+			MultiplePrecision = 1
+		};
+
+		template<typename T>
+		struct NumberTypeTag
+		{};
+
+		template<>
+		struct NumberTypeTag<dbl>
+		{
+			static constexpr NumberType value = NumberType::Double;
+		};
+
+		template<>
+		struct NumberTypeTag<mpfr>
+		{
+			static constexpr NumberType value = NumberType::MultiplePrecision;
+		};
+
+		/**
+		\brief A value written at the front of binary files, used to detect files written on a machine with different byte order.
+		*/
+		constexpr std::uint32_t ByteOrderMark = 0x01020304u;
+
+
+
+
+
+		/**
+		\brief An append-only buffer of bytes, into which things are encoded before being written to a file.
+		*/
+		using Buffer = std::vector<char>;
+
+		/**
+		\brief Decodes things from a contiguous range of bytes, which may well be a memory-mapped file.
+
+		\throws std::runtime_error, if asked to read past the end of the range.
+		*/
+		class Reader
+		{
+		public:
+			Reader(char const* begin, char const* end) : pos_(begin), end_(end)
+			{}
+
+			/**
+			\brief Get a pointer to the next `num_bytes` bytes, and advance past them.
+			*/
+			char const* Take(std::size_t num_bytes)
+			{
+				if (Remaining() < num_bytes)
+					throw std::runtime_error("attempting to read past end of binary data");
+				auto here = pos_;
+				pos_ += num_bytes;
+				return here;
+			}
+
+			std::size_t Remaining() const
+			{
+				return static_cast<std::size_t>(end_ - pos_);
+			}
+
+			char const* Position() const
+			{
+				return pos_;
+			}
+
+		private:
+			char const* pos_;
+			char const* end_;
+		};
+
+
+
+		/**
+		\brief Write a trivially copyable value to a buffer.
+		*/
+		template<typename T>
+		void Write(Buffer & buf, T const& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "generic binary Write requires a trivially copyable type.  provide an overload for other types.");
+			auto const p = reinterpret_cast<char const*>(&value);
+			buf.insert(buf.end(), p, p+sizeof(T));
+		}
+
+		/**
+		\brief Read a trivially copyable value.
+		*/
+		template<typename T>
+		void Read(Reader & in, T & value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "generic binary Read requires a trivially copyable type.  provide an overload for other types.");
+			std::memcpy(&value, in.Take(sizeof(T)), sizeof(T));
+		}
+
+
+
+		inline
+		void Write(Buffer & buf, SuccessCode const& code)
+		{
+			Write(buf, static_cast<std::int32_t>(code));
+		}
+
+		inline
+		void Read(Reader & in, SuccessCode & code)
+		{
+			std::int32_t c;
+			Read(in, c);
+			code = static_cast<SuccessCode>(c);
+		}
+
+
+
+		inline
+		void Write(Buffer & buf, std::string const& s)
+		{
+			Write(buf, static_cast<std::uint64_t>(s.size()));
+			buf.insert(buf.end(), s.begin(), s.end());
+		}
+
+		inline
+		void Read(Reader & in, std::string & s)
+		{
+			std::uint64_t n;
+			Read(in, n);
+			auto p = in.Take(n);
+			s.assign(p, p+n);
+		}
+
+
+
+		inline
+		void Write(Buffer & buf, dbl const& z)
+		{
+			Write(buf, z.real());
+			Write(buf, z.imag());
+		}
+
+		inline
+		void Read(Reader & in, dbl & z)
+		{
+			double r, i;
+			Read(in, r);
+			Read(in, i);
+			z = dbl(r,i);
+		}
+
+
+
+		/**
+		\brief Write an mpfr_float exactly, as precision in bits, kind, exponent, and limbs.
+		*/
+		inline
+		void Write(Buffer & buf, mpfr_float const& x)
+		{
+			mpfr_srcptr raw = x.backend().data();
+			const auto prec_bits = mpfr_get_prec(raw);
+			const auto kind = mpfr_custom_get_kind(raw);
+
+			Write(buf, static_cast<std::uint64_t>(prec_bits));
+			Write(buf, static_cast<std::int32_t>(kind));
+			Write(buf, static_cast<std::int64_t>(mpfr_regular_p(raw) ? mpfr_custom_get_exp(raw) : 0));
+
+			const auto num_bytes = mpfr_custom_get_size(prec_bits);
+			auto const p = static_cast<char const*>(mpfr_custom_get_significand(raw));
+			buf.insert(buf.end(), p, p+num_bytes);
+		}
+
+		/**
+		\brief Read an mpfr_float written by Write.  The number comes back in the precision at which it was written, regardless of the current default precision.
+		*/
+		inline
+		void Read(Reader & in, mpfr_float & x)
+		{
+			std::uint64_t prec_bits;
+			std::int32_t kind;
+			std::int64_t exponent;
+			Read(in, prec_bits);
+			Read(in, kind);
+			Read(in, exponent);
+
+			const auto num_bytes = mpfr_custom_get_size(prec_bits);
+			// copy into limb-aligned storage, since the source may be an unaligned spot in a mapped file
+			std::vector<mp_limb_t> limbs((num_bytes + sizeof(mp_limb_t) - 1)/sizeof(mp_limb_t));
+			std::memcpy(limbs.data(), in.Take(num_bytes), num_bytes);
+
+			mpfr_t view;
+			mpfr_custom_init_set(view, kind, static_cast<mpfr_exp_t>(exponent), static_cast<mpfr_prec_t>(prec_bits), limbs.data());
+
+			mpfr_set_prec(x.backend().data(), static_cast<mpfr_prec_t>(prec_bits));
+			mpfr_set(x.backend().data(), view, MPFR_RNDN); // exact, precisions agree
+		}
+
+
+
+		inline
+		void Write(Buffer & buf, mpfr const& z)
+		{
+			Write(buf, z.real());
+			Write(buf, z.imag());
+		}
+
+		inline
+		void Read(Reader & in, mpfr & z)
+		{
+			mpfr_float r, i;
+			Read(in, r);
+			Read(in, i);
+			z.precision(Precision(r));
+			z.real(r);
+			z.imag(i);
+		}
+
+
+
+		template<typename T>
+		void Write(Buffer & buf, Vec<T> const& v)
+		{
+			Write(buf, static_cast<std::uint64_t>(v.size()));
+			for (int ii = 0; ii < v.size(); ++ii)
+				Write(buf, v(ii));
+		}
+
+		template<typename T>
+		void Read(Reader & in, Vec<T> & v)
+		{
+			std::uint64_t n;
+			Read(in, n);
+			v.resize(n);
+			for (int ii = 0; ii < v.size(); ++ii)
+				Read(in, v(ii));
+		}
+
+
+
+
+
+
+		/**
+		\brief A file opened for appending, whose writes are pushed to disk only on request.
+
+		Appending is a single `write` call, so it's cheap.  Syncing calls `fsync`, which is not, so callers should batch up their calls to Sync.
+		*/
+		class AppendFile
+		{
+		public:
+
+			AppendFile() = default;
+
+			/**
+			\param filename The file to open.
+			\param truncate Whether to discard the current contents of the file, if it exists.
+			*/
+			AppendFile(Path const& filename, bool truncate)
+			{
+				int flags = O_WRONLY | O_CREAT | O_APPEND;
+				if (truncate)
+					flags |= O_TRUNC;
+
+				fd_ = ::open(filename.c_str(), flags, 0644);
+				if (fd_ < 0)
+					throw std::runtime_error("unable to open binary file '" + filename.string() + "' for appending");
+			}
+
+			AppendFile(AppendFile const&) = delete;
+			AppendFile& operator=(AppendFile const&) = delete;
+
+			~AppendFile()
+			{
+				if (fd_ >= 0)
+				{
+					::fsync(fd_);
+					::close(fd_);
+				}
+			}
+
+			void Append(char const* data, std::size_t num_bytes)
+			{
+				while (num_bytes > 0)
+				{
+					auto written = ::write(fd_, data, num_bytes);
+					if (written < 0)
+						throw std::runtime_error("failed to append to binary file");
+					data += written;
+					num_bytes -= static_cast<std::size_t>(written);
+				}
+			}
+
+			void Append(Buffer const& buf)
+			{
+				Append(buf.data(), buf.size());
+			}
+
+			/**
+			\brief Chop the file to a given length, discarding whatever comes after.  Used to remove partial records left by a crash.
+			*/
+			void Truncate(std::uint64_t length)
+			{
+				if (::ftruncate(fd_, static_cast<off_t>(length)) != 0)
+					throw std::runtime_error("failed to truncate binary file");
+			}
+
+			/**
+			\brief Push everything appended so far to disk.
+
+			\throws std::runtime_error, if `fsync` fails, in which case the appended data may not have reached the disk.
+			*/
+			void Sync()
+			{
+				if (::fsync(fd_) != 0)
+					throw std::runtime_error("failed to sync binary file to disk");
+			}
+
+		private:
+			int fd_ = -1;
+		};
+
+
+
+		/**
+		\brief A read-only, memory-mapped view of an entire file.
+		*/
+		class MappedFile
+		{
+		public:
+
+			explicit
+			MappedFile(Path const& filename)
+			{
+				fd_ = ::open(filename.c_str(), O_RDONLY);
+				if (fd_ < 0)
+					throw std::runtime_error("unable to open binary file '" + filename.string() + "' for reading");
+
+				struct stat info;
+				if (::fstat(fd_, &info) != 0)
+				{
+					::close(fd_);
+					throw std::runtime_error("unable to stat binary file '" + filename.string() + "'");
+				}
+
+				size_ = static_cast<std::size_t>(info.st_size);
+				if (size_ > 0)
+				{
+					auto p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+					if (p == MAP_FAILED)
+					{
+						::close(fd_);
+						throw std::runtime_error("unable to memory map binary file '" + filename.string() + "'");
+					}
+					data_ = static_cast<char const*>(p);
+				}
+			}
+
+			MappedFile(MappedFile const&) = delete;
+			MappedFile& operator=(MappedFile const&) = delete;
+
+			~MappedFile()
+			{
+				if (data_)
+					::munmap(const_cast<char*>(data_), size_);
+				if (fd_ >= 0)
+					::close(fd_);
+			}
+
+			char const* begin() const
+			{
+				return data_;
+			}
+
+			char const* end() const
+			{
+				return data_ + size_;
+			}
+
+			std::size_t size() const
+			{
+				return size_;
+			}
+
+		private:
+			int fd_ = -1;
+			char const* data_ = nullptr;
+			std::size_t size_ = 0;
+		};
+
+	} // namespace binary
+} // namespace bertini
@@ -32,5 +32,6 @@
 #include "bertini2/io/parsing/function_parsers.hpp"
 #include "bertini2/io/parsing/number_parsers.hpp"
 #include "bertini2/io/parsing/settings_parsers.hpp"
+#include "bertini2/io/parsing/streaming_system_parser.hpp"
 #include "bertini2/io/parsing/system_parsers.hpp"
 
@@ -196,10 +196,11 @@ namespace bertini {
 					
 					exp_elem_.name("exp_elem_");
 					exp_elem_ =
-					(symbol_  >> !qi::alnum) [_val = _1]
+					(lit('-') >> &(number_ >> '^') > factor_ [_val = -_1]) // a number raised to a power doesn't carry the sign, so -2^2 is -(2^2), like -x^2
+					|   (symbol_  >> !qi::alnum) [_val = _1]
 					|   ( '(' > expression_  [_val = _1] > ')'  ) // using the > expectation here.
-					|   (lit('-') > expression_  [_val = -_1])
-					|   (lit('+') > expression_  [_val = _1])
+					|   (lit('-') > factor_  [_val = -_1]) // a sign binds tighter than + and -, so -x+y is (-x)+y, and looser than ^, so -x^2 is -(x^2)
+					|   (lit('+') > factor_  [_val = _1])
 					|   (lit("sin") > '(' > expression_ [_val = sin_lazy(_1)] > ')' )
 					|   (lit("cos") > '(' > expression_ [_val = cos_lazy(_1)] > ')' )
 					|   (lit("tan") > '(' > expression_ [_val = tan_lazy(_1)] > ')' )
@@ -772,6 +772,9 @@ namespace bertini {
 								   ^ endpoint_finite_[phx::bind( [this](algorithm::PostProcessingConfig & S, T num)
 															 {
 																 S.endpoint_finite_threshold = num;
+																 // a bound on the norm of finite endpoints, so its reciprocal bounds their homogenizing ratio
+																 if (num > 0)
+																	 S.endpoint_finite_ratio = T(1)/num;
 															 }, _val, _1 )]
 								   ^ same_point_[phx::bind( [this](algorithm::PostProcessingConfig & S, T num)
 															 {
@@ -0,0 +1,632 @@
+//This file is part of Bertini 2.
+//
+//streaming_system_parser.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//streaming_system_parser.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with streaming_system_parser.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+ \file streaming_system_parser.hpp
+
+ \brief A hand-written parser for Bertini Classic input, which reads from a stream a buffer at a time.
+
+ The Qi parser in system_rules.hpp needs the whole input in memory, with comments already stripped, and is slow for systems with hundreds of thousands of terms.  This one tokenizes as it reads, and builds the same nodes through the same System::Add* calls.
+ */
+
+#pragma once
+
+#include "bertini2/system/system.hpp"
+#include "bertini2/io/file_utilities.hpp"
+
+#include <cctype>
+#include <fstream>
+#include <istream>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace bertini {
+	namespace parsing {
+		namespace classic {
+
+			/**
+			\brief Splits a stream of Bertini Classic input into tokens.
+
+			Reads a fixed-size buffer at a time, so the input never needs to be in memory all at once.  Whitespace and comments, which run from a % to the end of the line, are dropped.  Any character which isn't part of a name or number is a token by itself, and it is up to the parser to decide whether it makes sense.
+			*/
+			class InputTokenizer
+			{
+			public:
+
+				enum class Kind
+				{
+					Name, ///< A letter followed by letters, digits, and any of []_
+					Integer, ///< Digits only
+					Decimal, ///< Digits with a decimal point, an exponent, or both
+					Character, ///< Any other single character
+					End ///< The end of the input
+				};
+
+				struct Token
+				{
+					Kind kind = Kind::End;
+					std::string text;
+					unsigned line = 1;
+
+					bool Is(char c) const
+					{
+						return kind==Kind::Character && text[0]==c;
+					}
+
+					bool Is(Kind k, std::string const& t) const
+					{
+						return kind==k && text==t;
+					}
+				};
+
+
+				explicit
+				InputTokenizer(std::istream & in, std::size_t buffer_size = 1<<16) : in_(in), buffer_(buffer_size)
+				{
+					Advance();
+				}
+
+
+				/**
+				\brief The current token, without consuming it.
+				*/
+				Token const& Peek() const
+				{
+					return current_;
+				}
+
+				/**
+				\brief Consume the current token, and return it.
+				*/
+				Token Next()
+				{
+					Token t = std::move(current_);
+					Advance();
+					return t;
+				}
+
+			private:
+
+				/**
+				\brief The next character, or EOF.  Refills the buffer when it runs out.
+				*/
+				int PeekChar()
+				{
+					if (pos_==end_)
+					{
+						in_.read(buffer_.data(), buffer_.size());
+						end_ = static_cast<std::size_t>(in_.gcount());
+						pos_ = 0;
+						if (end_==0)
+							return EOF;
+					}
+					return static_cast<unsigned char>(buffer_[pos_]);
+				}
+
+				int GetChar()
+				{
+					int c = PeekChar();
+					if (c!=EOF)
+					{
+						++pos_;
+						if (c=='\n')
+							++line_;
+					}
+					return c;
+				}
+
+				void TakeDigits(std::string & text)
+				{
+					while (std::isdigit(PeekChar()))
+						text.push_back(static_cast<char>(GetChar()));
+				}
+
+				void Advance()
+				{
+					int c;
+					for (;;)
+					{
+						c = PeekChar();
+						if (c=='%')
+							while (c!=EOF && c!='\n')
+								c = GetChar();
+						else if (c!=EOF && std::isspace(c))
+							GetChar();
+						else
+							break;
+					}
+
+					current_.text.clear();
+					current_.line = line_;
+
+					if (c==EOF)
+					{
+						current_.kind = Kind::End;
+					}
+					else if (std::isalpha(c))
+					{
+						current_.kind = Kind::Name;
+						do
+							current_.text.push_back(static_cast<char>(GetChar()));
+						while (std::isalnum(c = PeekChar()) || c=='_' || c=='[' || c==']');
+					}
+					else if (std::isdigit(c) || c=='.')
+					{
+						ReadNumber();
+					}
+					else
+					{
+						current_.kind = Kind::Character;
+						current_.text.push_back(static_cast<char>(GetChar()));
+					}
+				}
+
+				/**
+				Numbers are digits, an optional decimal point with more digits, and an optional exponent.  An e which isn't followed by digits isn't an exponent, and is left for the next token.
+				*/
+				void ReadNumber()
+				{
+					current_.kind = Kind::Integer;
+					TakeDigits(current_.text);
+
+					if (PeekChar()=='.')
+					{
+						current_.kind = Kind::Decimal;
+						current_.text.push_back(static_cast<char>(GetChar()));
+						TakeDigits(current_.text);
+						if (current_.text=="." )
+							throw std::runtime_error("line " + std::to_string(line_) + ": a decimal point must have digits next to it");
+					}
+
+					if (PeekChar()=='e' || PeekChar()=='E')
+					{
+						// at most one character of lookahead is available across a refill, so commit to the exponent, and give back the e if there are no digits after it
+						std::string exponent("e");
+						GetChar();
+						if (PeekChar()=='-' || PeekChar()=='+')
+							exponent.push_back(static_cast<char>(GetChar()));
+						TakeDigits(exponent);
+
+						if (std::isdigit(static_cast<unsigned char>(exponent.back())))
+						{
+							current_.kind = Kind::Decimal;
+							current_.text += exponent;
+						}
+						else
+							PutBack(exponent);
+					}
+				}
+
+				/**
+				Un-read characters taken while looking for an exponent, which turned out to be something else, like the e in 2e or 3*e+1.
+				*/
+				void PutBack(std::string const& chars)
+				{
+					// the last pos_ of them are still in the buffer.  any before that were in the previous buffer, and go back in front.
+					const auto in_buffer = std::min(pos_, chars.size());
+					pos_ -= in_buffer;
+					buffer_.insert(buffer_.begin() + pos_, chars.begin(), chars.end() - in_buffer);
+					end_ += chars.size() - in_buffer;
+				}
+
+				std::istream & in_;
+				std::vector<char> buffer_;
+				std::size_t pos_ = 0, end_ = 0;
+				unsigned line_ = 1;
+				Token current_;
+			};
+
+
+
+
+			/**
+			\brief A recursive descent parser for Bertini Classic input, reading from a stream.
+
+			Accepts the same declarations, definitions, and subfunctions as the Qi SystemParser, and builds the same nodes with the same operators, so the systems it produces evaluate, differentiate, and serialize the same.  Beyond the Qi parser, it
+
+			- strips comments as it goes,
+			- skips a CONFIG section, ignores INPUT, and stops at the END; after the input, so a whole Bertini Classic input file can be read,
+			- reports the line of the first error.
+
+			\code
+			std::ifstream fin("input");
+			System sys = bertini::parsing::classic::ParseSystem(fin);
+			\endcode
+			*/
+			class StreamingSystemParser
+			{
+				using Function = node::Function;
+				using Variable = node::Variable;
+				using Node = node::Node;
+
+				using Fn = std::shared_ptr<Function>;
+				using Var = std::shared_ptr<Variable>;
+				using Nd = std::shared_ptr<Node>;
+
+				using Kind = InputTokenizer::Kind;
+				using Token = InputTokenizer::Token;
+
+			public:
+
+				explicit
+				StreamingSystemParser(std::istream & in) : tokens_(in)
+				{
+					for (auto const& name : {"variable_group", "hom_variable_group", "variable", "function", "constant", "parameter", "implicit_parameter", "pathvariable", "random", "random_real"})
+						reserved_.insert(name);
+
+					const auto pi = node::Pi(), e = node::E(), i = node::I();
+					symbols_.emplace("pi", pi); symbols_.emplace("Pi", pi);
+					symbols_.emplace("e", e); symbols_.emplace("E", e);
+					symbols_.emplace("i", i); symbols_.emplace("I", i);
+				}
+
+
+				/**
+				\brief Read statements until the end of the input, or an END; after the input.
+
+				\throws std::runtime_error at the first thing which isn't valid input, naming its line.
+				*/
+				System Parse()
+				{
+					System sys;
+					while (tokens_.Peek().kind!=Kind::End)
+					{
+						auto const& t = tokens_.Peek();
+						if (t.kind!=Kind::Name)
+							Fail("a declaration or definition");
+
+						if (t.text=="CONFIG")
+							SkipConfig();
+						else if (t.text=="INPUT")
+							tokens_.Next();
+						else if (t.text=="END")
+						{
+							tokens_.Next();
+							Expect(';');
+							break;
+						}
+						else if (t.text=="variable_group")
+							sys.AddVariableGroup(VariableDeclaration());
+						else if (t.text=="hom_variable_group")
+							sys.AddHomVariableGroup(VariableDeclaration());
+						else if (t.text=="variable")
+							sys.AddUngroupedVariables(VariableDeclaration());
+						else if (t.text=="implicit_parameter")
+							sys.AddImplicitParameters(VariableDeclaration());
+						else if (t.text=="pathvariable")
+						{
+							const auto line = t.line;
+							auto v = VariableDeclaration();
+							if (v.size()!=1)
+								throw std::runtime_error("line " + std::to_string(line) + ": only one pathvariable may be declared");
+							sys.AddPathVariable(v[0]);
+						}
+						else if (t.text=="function")
+							sys.AddFunctions(FunctionDeclaration());
+						else if (t.text=="constant")
+							sys.AddConstants(FunctionDeclaration());
+						else if (t.text=="parameter")
+							sys.AddParameters(FunctionDeclaration());
+						else if (t.text=="random" || t.text=="random_real")
+							throw std::runtime_error("line " + std::to_string(t.line) + ": " + t.text + " is not supported");
+						else
+						{
+							auto f = functions_.find(t.text);
+							if (f!=functions_.end())
+								Definition(f->second);
+							else
+								sys.AddSubfunction(Subfunction());
+						}
+					}
+					return sys;
+				}
+
+			private:
+
+				[[noreturn]]
+				void Fail(std::string const& expected) const
+				{
+					auto const& t = tokens_.Peek();
+					throw std::runtime_error("line " + std::to_string(t.line) + ": expecting " + expected + ", found " + (t.kind==Kind::End ? std::string("end of input") : "'" + t.text + "'"));
+				}
+
+				void Expect(char c)
+				{
+					if (!tokens_.Peek().Is(c))
+						Fail(std::string("'") + c + "'");
+					tokens_.Next();
+				}
+
+				bool Accept(char c)
+				{
+					if (!tokens_.Peek().Is(c))
+						return false;
+					tokens_.Next();
+					return true;
+				}
+
+				/**
+				Skip everything through the END; closing a CONFIG section.  Settings are read by the settings parsers, not here.
+				*/
+				void SkipConfig()
+				{
+					tokens_.Next();
+					for (;;)
+					{
+						auto t = tokens_.Next();
+						if (t.kind==Kind::End)
+							throw std::runtime_error("CONFIG section is missing its END;");
+						if (t.Is(Kind::Name, "END") && tokens_.Peek().Is(';'))
+						{
+							tokens_.Next();
+							return;
+						}
+					}
+				}
+
+				/**
+				A name which is neither a keyword nor already in use.
+				*/
+				std::string NewName()
+				{
+					auto const& t = tokens_.Peek();
+					if (t.kind!=Kind::Name)
+						Fail("a name");
+					if (reserved_.count(t.text) || symbols_.count(t.text))
+						Fail("a name not already in use");
+					return tokens_.Next().text;
+				}
+
+				template<typename ContainerT, typename MakeT>
+				ContainerT NameList(MakeT const& make)
+				{
+					tokens_.Next(); // the keyword
+					ContainerT made;
+					do
+						made.push_back(make(NewName()));
+					while (Accept(','));
+					Expect(';');
+					return made;
+				}
+
+				VariableGroup VariableDeclaration()
+				{
+					return NameList<VariableGroup>([this](std::string const& name)
+					{
+						auto v = MakeVariable(name);
+						symbols_.emplace(name, v);
+						return v;
+					});
+				}
+
+				std::vector<Fn> FunctionDeclaration()
+				{
+					return NameList<std::vector<Fn>>([this](std::string const& name)
+					{
+						return MakeAndAddFunction(name);
+					});
+				}
+
+				Fn MakeAndAddFunction(std::string const& name)
+				{
+					auto f = MakeFunction(name);
+					symbols_.emplace(name, f);
+					functions_.emplace(name, f);
+					return f;
+				}
+
+				void Definition(Fn const& f)
+				{
+					tokens_.Next();
+					Expect('=');
+					f->SetRoot(Body());
+				}
+
+				Fn Subfunction()
+				{
+					auto f = MakeAndAddFunction(NewName());
+					Expect('=');
+					f->SetRoot(Body());
+					return f;
+				}
+
+				/**
+				The right side of a definition, through its semicolon.  Wrapped in a Function, as the Qi FunctionParser does, so the trees are identical.
+				*/
+				Nd Body()
+				{
+					auto n = Expression();
+					Expect(';');
+					return MakeFunction(n);
+				}
+
+
+				// expression := term (('+' | '-') term)*
+				Nd Expression()
+				{
+					auto n = Term();
+					for (;;)
+					{
+						if (Accept('+'))
+							n += Term();
+						else if (Accept('-'))
+							n -= Term();
+						else
+							return n;
+					}
+				}
+
+				// term := factor (('*' | '/') factor)*
+				Nd Term()
+				{
+					auto n = Factor();
+					for (;;)
+					{
+						if (Accept('*'))
+							n *= Factor();
+						else if (Accept('/'))
+							n /= Factor();
+						else
+							return n;
+					}
+				}
+
+				// factor := element ('^' element)*, left associative like the Qi parser, so x^2^3 is (x^2)^3
+				Nd Factor()
+				{
+					return Powers(Element());
+				}
+
+				// the ('^' element)* of a factor, raising an element already read
+				Nd Powers(Nd n)
+				{
+					while (Accept('^'))
+						n = node::pow(n, Element());
+					return n;
+				}
+
+				// element := '-' number | ('-' | '+') factor | primary, as the exp_elem_ rule of the Qi parser.
+				// a sign binds tighter than + and -, so -x+y is (-x)+y, and looser than ^, so -x^2 is -(x^2) and -2^2 is -(2^2).
+				// a minus directly in front of a number not raised to a power makes a negative number, as the Qi number rules do.
+				Nd Element()
+				{
+					if (Accept('+'))
+						return Factor();
+					if (Accept('-'))
+					{
+						if (!IsNumber(tokens_.Peek()))
+							return -Factor();
+
+						auto number = tokens_.Next();
+						if (tokens_.Peek().Is('^'))
+							return -Powers(Number("", number));
+						return Number("-", number);
+					}
+					return Primary();
+				}
+
+				// primary := number | symbol | name '(' expression ')' | '(' expression ')'
+				Nd Primary()
+				{
+					auto const& t = tokens_.Peek();
+					if (IsNumber(t))
+						return Number("", tokens_.Next());
+
+					if (Accept('('))
+					{
+						auto n = Expression();
+						Expect(')');
+						return n;
+					}
+
+					if (t.kind!=Kind::Name)
+						Fail("a number, symbol, or parenthesized expression");
+
+					auto s = symbols_.find(t.text);
+					if (s!=symbols_.end())
+					{
+						tokens_.Next();
+						return s->second;
+					}
+
+					auto name = tokens_.Next().text;
+					if (!tokens_.Peek().Is('('))
+						throw std::runtime_error("line " + std::to_string(tokens_.Peek().line) + ": unknown symbol '" + name + "'");
+					return Call(name);
+				}
+
+				Nd Call(std::string const& name)
+				{
+					Expect('(');
+					auto arg = Expression();
+					Expect(')');
+
+					if (name=="sin") return node::sin(arg);
+					if (name=="cos") return node::cos(arg);
+					if (name=="tan") return node::tan(arg);
+					if (name=="exp") return node::exp(arg);
+					if (name=="log") return node::log(arg);
+					if (name=="sqrt") return node::sqrt(arg);
+					throw std::runtime_error("line " + std::to_string(tokens_.Peek().line) + ": unknown function '" + name + "'");
+				}
+
+				static
+				bool IsNumber(Token const& t)
+				{
+					return t.kind==Kind::Integer || t.kind==Kind::Decimal;
+				}
+
+				/**
+				Integers become exact Integer nodes, and anything with a point or an exponent a Float, from the text, so no digits are lost.
+				*/
+				static
+				Nd Number(std::string const& sign, Token const& t)
+				{
+					if (t.kind==Kind::Integer)
+						return MakeInteger(sign + t.text);
+					return MakeFloat(sign + t.text);
+				}
+
+				InputTokenizer tokens_;
+
+				std::unordered_map<std::string, Nd> symbols_; // variables, functions, and the special numbers
+				std::unordered_map<std::string, Fn> functions_; // the names which may appear on the left of an =
+				std::unordered_set<std::string> reserved_; // the declarative keywords
+			};
+
+
+
+
+			/**
+			\brief Parse a system from Bertini Classic input in a stream, without reading it all into memory first.
+
+			\throws std::runtime_error if the input isn't valid, naming the line of the first error.
+			*/
+			inline
+			System ParseSystem(std::istream & in)
+			{
+				return StreamingSystemParser(in).Parse();
+			}
+
+
+			/**
+			\brief Parse a system from a Bertini Classic input file.  A CONFIG section in the file is skipped.
+
+			\throws std::runtime_error if the file can't be opened or isn't valid.
+			*/
+			inline
+			System ParseSystemFile(Path const& input_file)
+			{
+				std::ifstream fin(input_file.string());
+				if (!fin)
+					throw std::runtime_error("unable to open input file " + input_file.string());
+				return ParseSystem(fin);
+			}
+
+		} // re: namespace classic
+
+	} // re: namespace parsing
+
+} // re: namespace bertini
@@ -0,0 +1,471 @@
+//This file is part of Bertini 2.
+//
+//path_trace.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_trace.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_trace.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file path_trace.hpp
+
+\brief Provides binary traces of path tracking: fixed-size records, per-thread ring buffers, the writer which flushes them to a file in the background, and readers and converters for the files.
+
+A trace file is a small header followed by records, each exactly sizeof(trace::Record) bytes, in native byte order.  The records of one thread are in the order they happened.  Records of different threads are interleaved in the order they were flushed; sort by Record::nanoseconds to put them in time order.
+
+Traces are written by tracking::TraceRecorder, and checked against a re-run by tracking::TraceReplayer.  The b2_trace program converts them to CSV or Chrome trace format.
+
+Records hold the tracker's state at each event, but not the start point of the path, nor the homotopy it was tracked on.  To replay a path, keep those yourself, for example with SaveBinary and the checkpoint log of ZeroDim.
+*/
+
+#pragma once
+
+#include "bertini2/io/binary.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+
+namespace bertini{
+	namespace trace{
+
+		/**
+		\brief What happened, for a trace record.
+		*/
+		enum class EventCode : std::uint8_t
+		{
+			PathStarted = 0,
+			SuccessfulStep = 1,
+			FailedStep = 2,
+			PrecisionChanged = 3, ///< the record's precision is the new one
+			HigherPrecisionNecessary = 4,
+			MatrixSolveFailure = 5,
+			SingularStartPoint = 6,
+			InfinitePathTruncation = 7,
+			PathEnded = 8
+		};
+
+		inline
+		char const* Name(EventCode e)
+		{
+			switch (e)
+			{
+				case EventCode::PathStarted: return "path_started";
+				case EventCode::SuccessfulStep: return "successful_step";
+				case EventCode::FailedStep: return "failed_step";
+				case EventCode::PrecisionChanged: return "precision_changed";
+				case EventCode::HigherPrecisionNecessary: return "higher_precision_necessary";
+				case EventCode::MatrixSolveFailure: return "matrix_solve_failure";
+				case EventCode::SingularStartPoint: return "singular_start_point";
+				case EventCode::InfinitePathTruncation: return "infinite_path_truncation";
+				case EventCode::PathEnded: return "path_ended";
+			}
+			return "unknown";
+		}
+
+
+		/**
+		\brief One event in the tracking of a path.  64 bytes, one cache line.
+
+		The tracker's state is as of the event: for a step, the time and stepsize are those the step was taken from and with.
+		*/
+		struct Record
+		{
+			std::uint64_t path; ///< the index of the path, from tracking::ThisThreadPathIndex()
+			std::int64_t nanoseconds; ///< wall time since the trace began
+			double time_real;
+			double time_imag;
+			double stepsize;
+			double residual; ///< the norm of the latest Newton step
+			double condition_number; ///< the latest estimate of the condition number of the Jacobian
+			std::uint32_t step; ///< the number of steps taken on the path so far, successful or not
+			std::uint16_t precision; ///< in digits
+			EventCode event;
+			std::uint8_t thread; ///< the ring buffer the record passed through, one per tracking thread, modulo 256
+		};
+		static_assert(sizeof(Record)==64, "trace records must be 64 bytes");
+		static_assert(std::is_trivially_copyable<Record>::value, "trace records are written as raw bytes");
+
+
+		/**
+		\brief Constants describing the layout of trace files.
+		*/
+		struct TraceFileLayout
+		{
+			static char const* Magic()
+			{
+				return "B2TRACE"; // eight bytes, counting the terminating null
+			}
+			static constexpr std::size_t MagicSize = 8;
+			static constexpr std::uint32_t Version = 1;
+			static constexpr std::size_t HeaderSize = MagicSize + 3*sizeof(std::uint32_t) + sizeof(std::uint32_t); // magic, byte order, version, record size, unused
+		};
+
+
+
+		/**
+		\brief A single-producer, single-consumer ring buffer of records.
+
+		The producer is the thread doing the tracking, the consumer the Writer's flushing thread.  Neither ever takes a lock.  If the ring fills, the producer waits for the consumer to drain it, so records are never dropped while the Writer lives; make the ring big enough that this is rare.  Once the Writer is destroyed it closes its rings, and records pushed after that are dropped, since there is no file left to write them to.
+		*/
+		class Ring
+		{
+		public:
+			using Clock = std::chrono::steady_clock;
+
+			/**
+			\param capacity The number of records the ring holds.  Rounded up to a power of two.
+			\param thread The number of the ring, stamped on its records.
+			\param epoch When the trace began.
+			*/
+			Ring(std::size_t capacity, std::uint8_t thread, Clock::time_point epoch) : thread_(thread), epoch_(epoch)
+			{
+				std::size_t c = 1;
+				while (c < capacity)
+					c <<= 1;
+				records_.resize(c);
+				mask_ = c-1;
+			}
+
+			Ring(Ring const&) = delete;
+			Ring& operator=(Ring const&) = delete;
+
+			std::uint8_t Thread() const
+			{
+				return thread_;
+			}
+
+			std::size_t Capacity() const
+			{
+				return records_.size();
+			}
+
+			/**
+			\brief Wall time since the trace began.  Kept by the ring, so producers need not refer to the Writer.
+			*/
+			std::int64_t Nanoseconds() const
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count();
+			}
+
+			/**
+			\brief Stop accepting records, releasing a producer waiting on a full ring.  Called by the Writer when it is destroyed.
+			*/
+			void Close()
+			{
+				closed_.store(true, std::memory_order_release);
+			}
+
+			bool Closed() const
+			{
+				return closed_.load(std::memory_order_acquire);
+			}
+
+			/**
+			\brief Add a record.  Call only from the producing thread.  Dropped if the ring is closed.
+			*/
+			void Push(Record const& r)
+			{
+				const auto head = head_.load(std::memory_order_relaxed);
+				while (head - tail_.load(std::memory_order_acquire) >= records_.size())
+				{
+					if (Closed())
+						return;
+					std::this_thread::yield();
+				}
+				if (Closed())
+					return;
+
+				records_[head & mask_] = r;
+				records_[head & mask_].thread = thread_;
+				head_.store(head+1, std::memory_order_release);
+			}
+
+			/**
+			\brief Hand all records pushed so far to a function, in at most two contiguous runs, then release their space.  Call from one consumer at a time.
+
+			\param f Called as f(Record const* first, std::size_t count).
+			*/
+			template<typename F>
+			void Drain(F && f)
+			{
+				const auto tail = tail_.load(std::memory_order_relaxed);
+				const auto head = head_.load(std::memory_order_acquire);
+				if (head==tail)
+					return;
+
+				const auto begin = tail & mask_;
+				const auto count = static_cast<std::size_t>(head - tail);
+				const auto first_run = std::min(count, records_.size() - begin);
+				f(records_.data() + begin, first_run);
+				if (first_run < count)
+					f(records_.data(), count - first_run);
+
+				tail_.store(head, std::memory_order_release);
+			}
+
+		private:
+			std::vector<Record> records_;
+			std::size_t mask_;
+			std::uint8_t thread_;
+			Clock::time_point epoch_;
+			std::atomic<bool> closed_{false};
+			std::atomic<std::uint64_t> head_{0}; ///< written by the producer only
+			char padding_[64]; ///< keeps head_ and tail_ on different cache lines
+			std::atomic<std::uint64_t> tail_{0}; ///< written by the consumer only
+		};
+
+
+
+		/**
+		\brief Writes a trace file, flushing the rings of any number of tracking threads from a background thread.
+
+		Each tracking thread gets its own ring from NewRing.  The background thread wakes every flush interval and appends whatever the rings hold to the file, so tracking threads never wait on the disk.  Destroying the writer closes the rings, flushes everything, and closes the file.
+		*/
+		class Writer
+		{
+		public:
+			using Clock = std::chrono::steady_clock;
+
+			/**
+			\param filename The trace file.  Replaced if it exists.
+			\param ring_capacity The number of records in each thread's ring.
+			\param flush_interval How often the background thread empties the rings.
+			*/
+			explicit
+			Writer(Path const& filename, std::size_t ring_capacity = 1<<14, std::chrono::milliseconds flush_interval = std::chrono::milliseconds(50)) :
+				file_(filename, true), ring_capacity_(ring_capacity), flush_interval_(flush_interval), epoch_(Clock::now())
+			{
+				binary::Buffer header;
+				header.insert(header.end(), TraceFileLayout::Magic(), TraceFileLayout::Magic() + TraceFileLayout::MagicSize);
+				binary::Write(header, binary::ByteOrderMark);
+				binary::Write(header, std::uint32_t{TraceFileLayout::Version});
+				binary::Write(header, static_cast<std::uint32_t>(sizeof(Record)));
+				binary::Write(header, std::uint32_t(0));
+				file_.Append(header);
+
+				flusher_ = std::thread([this]{ FlushLoop(); });
+			}
+
+			Writer(Writer const&) = delete;
+			Writer& operator=(Writer const&) = delete;
+
+			~Writer()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					stop_ = true;
+				}
+				wake_.notify_one();
+				flusher_.join();
+
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					for (auto& r : rings_)
+						r->Close();
+				}
+				FlushNow();
+			}
+
+			/**
+			\brief Make a ring for a tracking thread to push to.  The ring may outlive the writer, but is closed when the writer is destroyed.
+			*/
+			std::shared_ptr<Ring> NewRing()
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				rings_.push_back(std::make_shared<Ring>(ring_capacity_, static_cast<std::uint8_t>(rings_.size()), epoch_));
+				return rings_.back();
+			}
+
+			/**
+			\brief Wall time since the trace began.
+			*/
+			std::int64_t Nanoseconds() const
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count();
+			}
+
+			/**
+			\brief Write out everything pushed so far, now, from the calling thread.
+			*/
+			void Flush()
+			{
+				FlushNow();
+			}
+
+		private:
+
+			void FlushNow()
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				for (auto& r : rings_)
+					r->Drain([this](Record const* first, std::size_t count)
+						{ file_.Append(reinterpret_cast<char const*>(first), count*sizeof(Record)); });
+			}
+
+			void FlushLoop()
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				while (!stop_)
+				{
+					wake_.wait_for(lock, flush_interval_);
+					for (auto& r : rings_)
+						r->Drain([this](Record const* first, std::size_t count)
+							{ file_.Append(reinterpret_cast<char const*>(first), count*sizeof(Record)); });
+				}
+			}
+
+			binary::AppendFile file_;
+			std::size_t ring_capacity_;
+			std::chrono::milliseconds flush_interval_;
+			Clock::time_point epoch_;
+
+			std::mutex mutex_; ///< guards the list of rings and the file, so there is only ever one consumer
+			std::condition_variable wake_;
+			bool stop_ = false;
+			std::vector<std::shared_ptr<Ring>> rings_;
+			std::thread flusher_;
+		};
+
+
+
+		/**
+		\brief Read all the records of a trace file.
+
+		\throws std::runtime_error if the file is not a trace file, or was written with a different byte order or record layout.
+		*/
+		inline
+		std::vector<Record> ReadTrace(Path const& filename)
+		{
+			binary::MappedFile mapped(filename);
+			binary::Reader in(mapped.begin(), mapped.end());
+
+			if (in.Remaining() < TraceFileLayout::HeaderSize || std::memcmp(in.Take(TraceFileLayout::MagicSize), TraceFileLayout::Magic(), TraceFileLayout::MagicSize)!=0)
+				throw std::runtime_error("file '" + filename.string() + "' is not a Bertini2 trace file");
+
+			std::uint32_t bom, version, record_size, unused;
+			binary::Read(in, bom);
+			binary::Read(in, version);
+			binary::Read(in, record_size);
+			binary::Read(in, unused);
+
+			if (bom != binary::ByteOrderMark)
+				throw std::runtime_error("trace file '" + filename.string() + "' was written with a different byte order");
+			if (version != TraceFileLayout::Version || record_size != sizeof(Record))
+				throw std::runtime_error("trace file '" + filename.string() + "' has unsupported version " + std::to_string(version));
+
+			// a partial record at the end is from a run that died mid-flush, and is dropped
+			std::vector<Record> records(in.Remaining() / sizeof(Record));
+			if (!records.empty())
+				std::memcpy(records.data(), in.Take(records.size()*sizeof(Record)), records.size()*sizeof(Record));
+			return records;
+		}
+
+
+		/**
+		\brief The records of one path, in the order they happened.
+		*/
+		inline
+		std::vector<Record> PathRecords(std::vector<Record> const& records, std::uint64_t path)
+		{
+			std::vector<Record> result;
+			std::copy_if(records.begin(), records.end(), std::back_inserter(result), [path](Record const& r){ return r.path==path; });
+			std::stable_sort(result.begin(), result.end(), [](Record const& a, Record const& b){ return a.nanoseconds < b.nanoseconds; });
+			return result;
+		}
+
+
+		/**
+		\brief Write records as CSV, one per line, with a header line.
+		*/
+		inline
+		void WriteCSV(std::ostream & out, std::vector<Record> const& records)
+		{
+			out << "path,thread,nanoseconds,event,step,time_real,time_imag,stepsize,precision,residual,condition_number\n";
+			out.precision(17);
+			for (auto const& r : records)
+				out << r.path << ',' << unsigned(r.thread) << ',' << r.nanoseconds << ',' << Name(r.event) << ',' << r.step << ','
+					<< r.time_real << ',' << r.time_imag << ',' << r.stepsize << ',' << r.precision << ','
+					<< r.residual << ',' << r.condition_number << '\n';
+		}
+
+
+		namespace detail {
+			/**
+			JSON has no infinities or NaNs, which an untouched condition number estimate may well be.
+			*/
+			struct JSONNumber
+			{
+				double value;
+
+				friend
+				std::ostream& operator<<(std::ostream & out, JSONNumber const& n)
+				{
+					if (std::isfinite(n.value))
+						return out << n.value;
+					return out << "null";
+				}
+			};
+		} // namespace detail
+
+
+		/**
+		\brief Write records in the Chrome trace event format, for chrome://tracing or Perfetto.
+
+		Each path is a span on the thread which tracked it, from its PathStarted to its PathEnded record, and every other record is an instant event inside it, with the tracker state as arguments.
+		*/
+		inline
+		void WriteChromeTrace(std::ostream & out, std::vector<Record> const& records)
+		{
+			out << "{\"traceEvents\":[\n";
+			out.precision(17);
+			bool first = true;
+			for (auto const& r : records)
+			{
+				if (!first)
+					out << ",\n";
+				first = false;
+
+				const char* phase = r.event==EventCode::PathStarted ? "B" : (r.event==EventCode::PathEnded ? "E" : "i");
+				out << "{\"name\":\"";
+				if (r.event==EventCode::PathStarted || r.event==EventCode::PathEnded)
+					out << "path " << r.path;
+				else
+					out << Name(r.event);
+				out << "\",\"ph\":\"" << phase << "\",\"ts\":" << r.nanoseconds/1000.0
+					<< ",\"pid\":0,\"tid\":" << unsigned(r.thread);
+				if (*phase=='i')
+					out << ",\"s\":\"t\"";
+				out << ",\"args\":{\"path\":" << r.path << ",\"step\":" << r.step
+					<< ",\"t\":\"" << r.time_real << (r.time_imag<0 ? "" : "+") << r.time_imag << "i\""
+					<< ",\"stepsize\":" << detail::JSONNumber{r.stepsize} << ",\"precision\":" << r.precision
+					<< ",\"residual\":" << detail::JSONNumber{r.residual} << ",\"condition_number\":" << detail::JSONNumber{r.condition_number} << "}}";
+			}
+			out << "\n]}\n";
+		}
+
+	} // namespace trace
+} // namespace bertini
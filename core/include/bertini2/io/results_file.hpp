@@ -0,0 +1,329 @@
+//This file is part of Bertini 2.
+//
+//bertini2/io/results_file.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/io/results_file.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/io/results_file.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/io/results_file.hpp
+
+\brief Provides a compact, columnar, binary file format for the results of a solve, and a memory-mapped reader for it.
+
+The file is a header, a directory of columns, and then the columns themselves.  The header records the number type, the number of points, and the variable ordering.  Each entry of the directory gives a column's name, element type, and location in the file.  Every column starts on an eight-byte boundary, so fixed-width columns can be used in place, straight out of the mapped file.
+
+Points computed in double precision are stored in a single column of complex doubles, one point after the other.  Points computed in multiple precision are stored as exact mpfr data in a column of bytes, with a second column giving where each point starts.
+
+The writer for zero dim solves is output::Binary, in bertini2/nag_algorithms/output.hpp.
+*/
+
+#pragma once
+
+#include "bertini2/io/binary.hpp"
+
+namespace bertini{
+	namespace binary{
+
+		/**
+		\brief The element types a column of a results file can have.
+		*/
+		enum class ColumnType : std::uint32_t
+		{
+			Int8 = 0,
+			Int32 = 1,
+			Int64 = 2,
+			Float64 = 3,
+			Complex128 = 4, ///< pairs of doubles, real then imaginary.
+			Bytes = 5 ///< variable-length data, such as multiple precision points.
+		};
+
+		template<typename T>
+		struct ColumnTypeOf
+		{};
+
+		template<> struct ColumnTypeOf<std::int8_t> { static constexpr ColumnType value = ColumnType::Int8; };
+		template<> struct ColumnTypeOf<std::int32_t> { static constexpr ColumnType value = ColumnType::Int32; };
+		template<> struct ColumnTypeOf<std::int64_t> { static constexpr ColumnType value = ColumnType::Int64; };
+		template<> struct ColumnTypeOf<double> { static constexpr ColumnType value = ColumnType::Float64; };
+		template<> struct ColumnTypeOf<dbl> { static constexpr ColumnType value = ColumnType::Complex128; };
+		template<> struct ColumnTypeOf<char> { static constexpr ColumnType value = ColumnType::Bytes; };
+
+		/**
+		\brief Get the width in bytes of one element of a column.  Bytes columns have width 1.
+		*/
+		inline
+		std::size_t ColumnWidth(ColumnType t)
+		{
+			switch (t)
+			{
+				case ColumnType::Int8: return 1;
+				case ColumnType::Int32: return 4;
+				case ColumnType::Int64: return 8;
+				case ColumnType::Float64: return 8;
+				case ColumnType::Complex128: return 16;
+				case ColumnType::Bytes: return 1;
+			}
+			throw std::runtime_error("unknown column type in results file");
+		}
+
+
+		/**
+		\brief The names of the columns in a results file.
+		*/
+		namespace columns{
+			constexpr char const* Points = "points"; ///< Complex128, NumPoints()*NumVariables() of them.  double precision files only.
+			constexpr char const* PointsMP = "points_mp"; ///< Bytes, exact mpfr data.  multiple precision files only.
+			constexpr char const* PointOffsets = "point_offsets"; ///< Int64, where each point starts in PointsMP.  multiple precision files only.
+			constexpr char const* Precision = "precision"; ///< Int64, the precision of each point, in digits.
+		}
+
+
+		/**
+		\brief Constants describing the layout of results files.
+		*/
+		struct ResultsFileLayout
+		{
+			static char const* Magic()
+			{
+				return "B2RSLT\0"; // eight bytes, counting the terminating null
+			}
+			static constexpr std::size_t MagicSize = 8;
+			static constexpr std::uint32_t Version = 1;
+			static constexpr std::size_t Alignment = 8;
+
+			static
+			std::uint64_t Padded(std::uint64_t n)
+			{
+				return (n + Alignment - 1) / Alignment * Alignment;
+			}
+		};
+
+
+
+		/**
+		\brief Describes one column of a results file.
+		*/
+		struct ColumnInfo
+		{
+			std::string name;
+			ColumnType type;
+			std::uint64_t offset; ///< from the start of the file, in bytes
+			std::uint64_t size; ///< in bytes
+		};
+
+
+
+		/**
+		\brief A read-only, memory-mapped results file.
+
+		Fixed-width columns are given out as pointers into the mapped file, so reading even a very large file costs nothing up front.  The pointers are valid as long as this object is.
+
+		\throws std::runtime_error from the constructor, if the file is not a results file, or was written on a machine with different byte order.
+		*/
+		class ResultsFile
+		{
+		public:
+
+			explicit
+			ResultsFile(Path const& filename) : mapped_(filename)
+			{
+				using Layout = ResultsFileLayout;
+				Reader in(mapped_.begin(), mapped_.end());
+
+				if (in.Remaining() < Layout::MagicSize || std::memcmp(in.Take(Layout::MagicSize), Layout::Magic(), Layout::MagicSize)!=0)
+					throw std::runtime_error("file '" + filename.string() + "' is not a Bertini2 results file");
+
+				std::uint32_t bom, version, number_type, num_columns;
+				Read(in, bom);
+				Read(in, version);
+				Read(in, number_type);
+				Read(in, num_columns);
+
+				if (bom != ByteOrderMark)
+					throw std::runtime_error("results file '" + filename.string() + "' was written with a different byte order");
+				if (version != Layout::Version)
+					throw std::runtime_error("results file '" + filename.string() + "' has unsupported version " + std::to_string(version));
+
+				number_type_ = static_cast<NumberType>(number_type);
+
+				Read(in, num_points_);
+				std::uint64_t num_variables;
+				Read(in, num_variables);
+
+				variables_.resize(num_variables);
+				for (auto& v : variables_)
+					Read(in, v);
+
+				columns_.resize(num_columns);
+				for (auto& c : columns_)
+				{
+					std::uint32_t type, unused;
+					Read(in, c.name);
+					Read(in, type);
+					Read(in, unused);
+					Read(in, c.offset);
+					Read(in, c.size);
+					c.type = static_cast<ColumnType>(type);
+
+					if (c.offset + c.size > mapped_.size())
+						throw std::runtime_error("column '" + c.name + "' of results file '" + filename.string() + "' extends past end of file.  was it truncated?");
+				}
+			}
+
+			NumberType NumType() const
+			{
+				return number_type_;
+			}
+
+			std::uint64_t NumPoints() const
+			{
+				return num_points_;
+			}
+
+			std::uint64_t NumVariables() const
+			{
+				return variables_.size();
+			}
+
+			/**
+			\brief The names of the variables, in the order the coordinates of the points are in.
+			*/
+			std::vector<std::string> const& Variables() const
+			{
+				return variables_;
+			}
+
+			std::vector<ColumnInfo> const& Columns() const
+			{
+				return columns_;
+			}
+
+			bool HasColumn(std::string const& name) const
+			{
+				return Find(name) != nullptr;
+			}
+
+			ColumnInfo const& Column(std::string const& name) const
+			{
+				auto c = Find(name);
+				if (!c)
+					throw std::runtime_error("results file has no column named '" + name + "'");
+				return *c;
+			}
+
+			/**
+			\brief Get a pointer to the first element of a column, directly in the mapped file.  No copying.
+
+			\tparam T The element type.  Must match the type the column was written with.
+
+			\throws std::runtime_error, if there is no such column, or it has a different type.
+			*/
+			template<typename T>
+			T const* ColumnData(std::string const& name) const
+			{
+				auto const& c = Column(name);
+				if (c.type != ColumnTypeOf<T>::value)
+					throw std::runtime_error("column '" + name + "' of results file has a different type than requested");
+				return reinterpret_cast<T const*>(mapped_.begin() + c.offset);
+			}
+
+			/**
+			\brief Get the raw bytes of a column, for handing out views of it.
+			*/
+			char const* RawColumnData(std::string const& name) const
+			{
+				return mapped_.begin() + Column(name).offset;
+			}
+
+			/**
+			\brief Get the number of elements in a column.
+			*/
+			std::uint64_t ColumnLength(std::string const& name) const
+			{
+				auto const& c = Column(name);
+				return c.size / ColumnWidth(c.type);
+			}
+
+			/**
+			\brief Decode a point into a vector.
+
+			Double points may be read into multiple precision vectors, and vice versa.  Multiple precision points come back in the precision in which they were written.
+			*/
+			template<typename ComplexT>
+			Vec<ComplexT> Point(std::uint64_t index) const
+			{
+				if (index >= num_points_)
+					throw std::out_of_range("index of point in results file out of range");
+
+				const auto n = static_cast<int>(NumVariables());
+
+				if (number_type_ == NumberType::Double)
+				{
+					auto p = ColumnData<dbl>(columns::Points) + index*NumVariables();
+					Vec<ComplexT> v(n);
+					for (int ii = 0; ii < n; ++ii)
+						v(ii) = static_cast<ComplexT>(p[ii]);
+					return v;
+				}
+
+				auto offsets = ColumnData<std::int64_t>(columns::PointOffsets);
+				auto const& blob = Column(columns::PointsMP);
+				auto begin = mapped_.begin() + blob.offset;
+				Reader in(begin + offsets[index], begin + blob.size);
+
+				Vec<mpfr> v;
+				Read(in, v);
+				return ConvertTo<ComplexT>(v);
+			}
+
+		private:
+
+			template<typename ComplexT>
+			static
+			std::enable_if_t<std::is_same<ComplexT, mpfr>::value, Vec<mpfr>> ConvertTo(Vec<mpfr> const& v)
+			{
+				return v;
+			}
+
+			template<typename ComplexT>
+			static
+			std::enable_if_t<!std::is_same<ComplexT, mpfr>::value, Vec<ComplexT>> ConvertTo(Vec<mpfr> const& v)
+			{
+				Vec<ComplexT> w(v.size());
+				for (int ii = 0; ii < v.size(); ++ii)
+					w(ii) = static_cast<ComplexT>(v(ii));
+				return w;
+			}
+
+			ColumnInfo const* Find(std::string const& name) const
+			{
+				for (auto const& c : columns_)
+					if (c.name == name)
+						return &c;
+				return nullptr;
+			}
+
+			MappedFile mapped_;
+			NumberType number_type_;
+			std::uint64_t num_points_;
+			std::vector<std::string> variables_;
+			std::vector<ColumnInfo> columns_;
+		};
+
+	} // namespace binary
+} // namespace bertini
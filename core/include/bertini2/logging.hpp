@@ -44,6 +44,8 @@
 #include <boost/log/sources/severity_logger.hpp>
 #include <boost/log/sources/record_ostream.hpp>
 
+#include <atomic>
+
 namespace bertini
 {
 
@@ -65,6 +67,27 @@ namespace bertini
 	}
 
 
+	namespace async_logging {
+
+		/**
+		\brief Below this severity, messages logged with the BERTINI_LOG_ macros are discarded as they are logged, before their pieces are copied.  Trace, by default.  LoggingInit sets it to the level it filters Boost.Log at, so messages the sink would drop aren't copied and queued first.
+		*/
+		inline
+		std::atomic<int>& MinimumSeverity()
+		{
+			static std::atomic<int> level{static_cast<int>(logging::trivial::severity_level::trace)};
+			return level;
+		}
+
+		inline
+		void SetMinimumSeverity(logging::trivial::severity_level level)
+		{
+			MinimumSeverity().store(static_cast<int>(level), std::memory_order_relaxed);
+		}
+
+	} // namespace async_logging
+
+
 	struct LoggingInit
 	{
 		
@@ -84,6 +107,7 @@ namespace bertini
 			(
 			    logging::trivial::severity >= desired_level
 			);
+			async_logging::SetMinimumSeverity(desired_level);
 
 			BOOST_LOG_TRIVIAL(trace) << "initialized logging";
 
@@ -76,6 +76,30 @@ namespace bertini{
 		mpfr_float::default_precision(prec);
 	}
 
+	/**
+	\brief Sets the default precision for as long as it lives, and puts back the previous one after, even if an exception is thrown.
+	*/
+	class DefaultPrecisionGuard
+	{
+	public:
+		explicit
+		DefaultPrecisionGuard(unsigned prec) : previous_(DefaultPrecision())
+		{
+			DefaultPrecision(prec);
+		}
+
+		~DefaultPrecisionGuard()
+		{
+			DefaultPrecision(previous_);
+		}
+
+		DefaultPrecisionGuard(DefaultPrecisionGuard const&) = delete;
+		DefaultPrecisionGuard& operator=(DefaultPrecisionGuard const&) = delete;
+
+	private:
+		unsigned previous_;
+	};
+
 	/** 
 	\brief Get the precision of a number.
 
@@ -205,8 +229,8 @@ namespace bertini
 	mpz_int RandomInt()
 	{
 		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
+   		thread_local mt19937 mt(EngineSeed());
+	    thread_local uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
 	    return ui(mt);
 	}
 	
@@ -218,8 +242,8 @@ namespace bertini
 	mpq_rational RandomRat()
 	{
    		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
+   		thread_local mt19937 mt(EngineSeed());
+	    thread_local uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
 	    return mpq_rational(ui(mt),ui(mt));
 	}
 
@@ -236,8 +260,8 @@ namespace bertini
 		using namespace boost::multiprecision;
    		using namespace boost::random;
 
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
+   		thread_local uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
+   		thread_local independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen(EngineSeed());
 
 		return ur(gen);
 	}
@@ -254,8 +278,8 @@ namespace bertini
 		using namespace boost::multiprecision;
    		using namespace boost::random;
 
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
+   		thread_local uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
+   		thread_local independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen(EngineSeed());
 
 		a = ur(gen);
 	}
@@ -0,0 +1,270 @@
+//This file is part of Bertini 2.
+//
+//bertini2/nag_algorithms/checkpoint.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/nag_algorithms/checkpoint.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/nag_algorithms/checkpoint.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/nag_algorithms/checkpoint.hpp
+
+\brief Provides an append-only binary log of completed paths, so that a long-running algorithm can be resumed after being killed.
+
+The log is a header, followed by a sequence of records.  The header carries an identity supplied by the writing algorithm, describing the problem being solved, so that a log is never resumed against a different one.  Each record is framed by a kind, a sequence number, the index of the path it pertains to, and the length of its payload.  What goes in the payload is up to the algorithm writing the log.
+
+A record which was only partially written when the program died is detected by its framing, and chopped off when the log is re-opened.  If the same path appears more than once, the record with the largest sequence number is the one which counts, so replaying the records in order gives the right answer.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "bertini2/io/binary.hpp"
+
+namespace bertini{
+	namespace algorithm{
+
+		/**
+		\brief The kinds of records which can appear in a checkpoint log.
+		*/
+		enum class CheckpointRecordKind : std::uint32_t
+		{
+			EndgameBoundary = 1, ///< the result of tracking a path to the endgame boundary
+			PostEndgame = 2 ///< the result of running the endgame on a path
+		};
+
+
+		/**
+		\brief A single record from a checkpoint log.  The payload points into the memory-mapped log, so is valid only during replay.
+		*/
+		struct CheckpointRecord
+		{
+			CheckpointRecordKind kind;
+			std::uint64_t sequence_number;
+			std::uint64_t path_index;
+			char const* payload;
+			std::uint64_t payload_size;
+		};
+
+
+
+		/**
+		\brief An append-only, binary, checkpoint log.
+
+		Appending a record costs one `write`.  Every `sync_batch_size` records, the log is `fsync`ed, so that tracking is not throttled by the disk.  At most that many records can be lost in a crash, and they are simply recomputed on resume.
+		*/
+		class CheckpointLog
+		{
+			static char const* Magic()
+			{
+				return "B2CKPT\0"; // eight bytes, counting the terminating null
+			}
+			static constexpr std::size_t MagicSize = 8;
+			static constexpr std::uint32_t Version = 2;
+
+			// magic, byte order mark, version, number type, identity size.  the identity follows.
+			static constexpr std::size_t HeaderSize = MagicSize + 3*sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+			// kind, sequence number, path index, payload size
+			static constexpr std::size_t FrameSize = sizeof(std::uint32_t) + 3*sizeof(std::uint64_t);
+
+		public:
+
+			/**
+			\brief Open a checkpoint log.
+
+			\param filename The log file.
+			\param number_type The number type the payloads are written in.  Resuming from a log written with a different one is an error.
+			\param sync_batch_size The number of records to append between calls to fsync.
+			\param keep_existing Whether to keep the records already in the file.  If false, any existing file is emptied.
+			\param identity Bytes describing the problem the records are for, written into the header of a new log.  When keeping existing records, the identity is instead read from the file, and it is up to the caller to compare it with Identity().
+
+			\throws std::runtime_error, if keeping the existing records, and the file is not a checkpoint log for the same number type.
+			*/
+			CheckpointLog(Path const& filename, binary::NumberType number_type, unsigned sync_batch_size, bool keep_existing, std::string const& identity = std::string()) :
+				filename_(filename), number_type_(number_type), sync_batch_size_(sync_batch_size), identity_(identity)
+			{
+				bool have_records = keep_existing && fs::exists(filename) && fs::file_size(filename) > 0;
+
+				if (have_records)
+				{
+					std::uint64_t valid_length = Scan([](CheckpointRecord const&){});
+					file_ = std::make_unique<binary::AppendFile>(filename, false);
+					file_->Truncate(valid_length);
+				}
+				else
+				{
+					file_ = std::make_unique<binary::AppendFile>(filename, true);
+					binary::Buffer header;
+					header.insert(header.end(), Magic(), Magic()+MagicSize);
+					binary::Write(header, binary::ByteOrderMark);
+					binary::Write(header, std::uint32_t{Version});
+					binary::Write(header, static_cast<std::uint32_t>(number_type_));
+					binary::Write(header, identity_);
+					file_->Append(header);
+					file_->Sync();
+				}
+			}
+
+			~CheckpointLog()
+			{
+				// a destructor can't throw.  a failure here loses at most the last batch, which is recomputed on resume.
+				try
+				{
+					Sync();
+				}
+				catch (std::exception const&)
+				{}
+			}
+
+			/**
+			\brief Call a function on each complete record in the log, in the order in which they were written.
+
+			\param f A function taking a `CheckpointRecord const&`.
+			*/
+			template<typename F>
+			void Replay(F && f) const
+			{
+				Scan(std::forward<F>(f));
+			}
+
+			/**
+			\brief Append a record to the log.  The sequence number is assigned automatically.
+			*/
+			void Append(CheckpointRecordKind kind, std::uint64_t path_index, binary::Buffer const& payload)
+			{
+				binary::Buffer record;
+				record.reserve(FrameSize + payload.size());
+				binary::Write(record, static_cast<std::uint32_t>(kind));
+				binary::Write(record, next_sequence_number_++);
+				binary::Write(record, path_index);
+				binary::Write(record, static_cast<std::uint64_t>(payload.size()));
+				record.insert(record.end(), payload.begin(), payload.end());
+
+				file_->Append(record);
+
+				if (++num_unsynced_ >= sync_batch_size_)
+					Sync();
+			}
+
+			/**
+			\brief Push all appended records to disk.
+
+			\throws std::runtime_error, if they could not be.
+			*/
+			void Sync()
+			{
+				if (num_unsynced_ == 0)
+					return;
+				file_->Sync();
+				num_unsynced_ = 0;
+			}
+
+			/**
+			\brief Get the identity of the problem the log is for, as read from its header, or as given when the log was made.
+			*/
+			std::string const& Identity() const
+			{
+				return identity_;
+			}
+
+			/**
+			\brief Get the number of records in the log.
+			*/
+			std::uint64_t NumRecords() const
+			{
+				return next_sequence_number_;
+			}
+
+		private:
+
+			/**
+			\brief Memory map the log, check the header, and run over the complete records.
+
+			Sets the next sequence number as a side effect.
+
+			\return The length of the valid part of the file, in bytes.
+			*/
+			template<typename F>
+			std::uint64_t Scan(F && f) const
+			{
+				binary::MappedFile mapped(filename_);
+				binary::Reader in(mapped.begin(), mapped.end());
+
+				if (in.Remaining() < HeaderSize || std::memcmp(in.Take(MagicSize), Magic(), MagicSize)!=0)
+					throw std::runtime_error("file '" + filename_.string() + "' is not a Bertini2 checkpoint log");
+
+				std::uint32_t bom, version, number_type;
+				binary::Read(in, bom);
+				binary::Read(in, version);
+				binary::Read(in, number_type);
+
+				if (bom != binary::ByteOrderMark)
+					throw std::runtime_error("checkpoint log '" + filename_.string() + "' was written with a different byte order");
+				if (version != Version)
+					throw std::runtime_error("checkpoint log '" + filename_.string() + "' has unsupported version " + std::to_string(version));
+				if (number_type != static_cast<std::uint32_t>(number_type_))
+					throw std::runtime_error("checkpoint log '" + filename_.string() + "' was written using a different number type");
+
+				std::uint64_t identity_size;
+				binary::Read(in, identity_size);
+				if (in.Remaining() < identity_size)
+					throw std::runtime_error("checkpoint log '" + filename_.string() + "' has a truncated header");
+				auto identity = in.Take(identity_size);
+				identity_.assign(identity, identity+identity_size);
+
+				while (in.Remaining() >= FrameSize)
+				{
+					CheckpointRecord r;
+					std::uint32_t kind;
+					binary::Read(in, kind);
+					binary::Read(in, r.sequence_number);
+					binary::Read(in, r.path_index);
+					binary::Read(in, r.payload_size);
+
+					if (in.Remaining() < r.payload_size)
+					{
+						// partially written record.  back up to its start, so it gets chopped off
+						in = binary::Reader(in.Position() - FrameSize, mapped.end());
+						break;
+					}
+
+					r.kind = static_cast<CheckpointRecordKind>(kind);
+					r.payload = in.Take(r.payload_size);
+					f(static_cast<CheckpointRecord const&>(r));
+
+					next_sequence_number_ = r.sequence_number+1;
+				}
+
+				return static_cast<std::uint64_t>(in.Position() - mapped.begin());
+			}
+
+
+			Path filename_;
+			binary::NumberType number_type_;
+			unsigned sync_batch_size_;
+
+			std::unique_ptr<binary::AppendFile> file_;
+			mutable std::string identity_;
+			mutable std::uint64_t next_sequence_number_ = 0;
+			unsigned num_unsynced_ = 0;
+		};
+
+	} // namespace algorithm
+} // namespace bertini
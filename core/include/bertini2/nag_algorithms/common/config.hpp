@@ -124,6 +124,8 @@ struct PostProcessingConfig{
 
 	T endpoint_finite_threshold = T(1)/T(100000);  ///< The threshold on norm of endpoints being considered infinite.  There is another setting in Tolerances, `path_truncation_threshold`, which tells the path tracker to die if exceeded.  Another related setting is in Security, `max_norm` -- the endgame dies if the norm of the computed approximation exceeds this twice.
 
+	T endpoint_finite_ratio = T(1)/T(100000); ///< The threshold on the homogenizing ratio of endpoints (see System::HomogenizingRatio), below which they are considered infinite.  The ratio is between 0 and 1, and for large points is about the reciprocal of the norm of the dehomogenized point, so this default corresponds to a norm of 1e5.
+
 	T same_point_tolerance {T(1)/T(10000000000)}; ///< The tolerance for whether two points are the same.  This should be *lower* than the accuracy to which you request your solutions be computed.  Perhaps by at least two orders of magnitude, but the default value is a factor of 10 less stringent.  This also depends on the norm being used to tell whether two points are the same, and the norm used for the convergence condition to terminate tracking.
 };
 
@@ -140,6 +142,58 @@ struct ZeroDimConfig
 	std::string path_variable_name = "ZERO_DIM_PATH_VARIABLE";
 };
 
+/**
+\brief Settings for the checkpoint log, which records completed paths so that a killed run can be resumed.
+*/
+struct CheckpointConfig
+{
+	bool enabled = false; ///< Whether to write a checkpoint log at all.
+	std::string filename = "checkpoint.b2ck"; ///< The file into which to write the log.
+	unsigned sync_batch_size = 64; ///< The number of records written between calls to fsync.  Larger is faster, but more paths are recomputed after a crash.
+	bool resume = true; ///< Whether to skip paths found in an already-existing log.  If false, an existing log is discarded.
+};
+
+/**
+\brief Settings for starting each path with the step size and precision learned from the paths already tracked.  See PathStatistics.
+*/
+struct WarmStartConfig
+{
+	bool enabled = false; ///< Whether to learn from completed paths, and start new paths from what was learned.
+	unsigned min_num_paths = 8; ///< How many paths must be completed before new paths are started from them.
+	unsigned num_bins = 20; ///< How many pieces of equal length the path is divided into, for the step size and precision profiles.  New paths start from the first.
+	double step_size_quantile = 0.25; ///< Which quantile of the early step sizes of completed paths to start new paths with.  Lower is more cautious.
+	double precision_quorum = 0.5; ///< The fraction of completed paths which must have used a precision early, for new paths to start in it.  Only for adaptive precision.
+};
+
+/**
+\brief Settings for tracking the paths of a ZeroDim solve cheapest first, each through the endgame before the next, so that solutions come out early.
+*/
+struct PathSchedulingConfig
+{
+	bool enabled = false; ///< Whether to probe the paths, and track them in order of their estimated cost.  Warm starting does not apply to scheduled paths.
+	double probe_fraction = 0.05; ///< How far along from the start time to the endgame boundary each path is probed, to estimate its cost.
+	unsigned num_dedicated_workers = 0; ///< The number of threads tracking the most expensive paths, alongside the cheap ones.  0 means none, so the expensive paths are tracked last.
+	double dedicated_fraction = 0.1; ///< The fraction of the paths, the most expensive, given to the dedicated workers.
+};
+
+/**
+\brief Settings for retracking the paths which failed or crossed, on a second homotopy with a fresh random gamma.
+*/
+struct GammaRetrackConfig
+{
+	bool enabled = false; ///< Whether to retrack failed and crossed paths after the endgame.
+	unsigned max_num_attempts = 1; ///< How many fresh homotopies to retrack paths which still fail on.
+	unsigned num_threads = 0; ///< The number of threads to retrack with.  0 means one per hardware thread.
+};
+
+/**
+\brief Settings for running many parameter points through a parameter homotopy.
+*/
+struct ParameterHomotopyConfig
+{
+	unsigned num_threads = 0; ///< The number of threads to track with.  0 means one per hardware thread.
+};
+
 struct MetaConfig
 {
 	classic::AlgoChoice tracktype = classic::AlgoChoice::ZeroDim;
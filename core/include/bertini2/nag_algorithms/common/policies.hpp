@@ -30,6 +30,7 @@ You can also provide your own, that's the point of these policies.
 
 #pragma once
 
+#include "bertini2/system/homotopy_cache.hpp"
 
 namespace bertini {
 
@@ -250,6 +251,85 @@ public:
 		};
 
 
+		/**
+		\brief Like CloneGiven, but keeps prepared homotopies in a HomotopyCache, so a run on a system already solved the same way skips homogenizing, patching, forming the start system, and differentiating.
+
+		The key is a hash of the target system as given to the constructor, with its settings, and of everything the preparation depends on: this policy, which fixes how the target is homogenized and patched, the type of the start system, and the name of the path variable.  On a hit, the target, start system, and homotopy are loaded from the cache, differentiated already; on a miss they are made as by CloneGiven, the homotopy is differentiated, and all three are stored.
+
+		The random gamma of the homotopy is stored with it, so runs which hit the cache track the same paths.  The cache directory is HomotopyCache::DefaultDirectory() unless another is given.
+
+		\see CloneGiven, HomotopyCache
+		*/
+		template<typename SystemType, typename StartSystemType>
+		struct CachedCloneGiven : public CloneGiven<SystemType, StartSystemType>
+		{
+			using Base = CloneGiven<SystemType, StartSystemType>;
+
+			using Base::TargetSystem;
+			using Base::StartSystem;
+			using Base::Homotopy;
+
+			/**
+			\brief Clone the target, and remember its key before it is prepared.
+
+			\param target The system to solve.
+			\param cache_directory The directory of the HomotopyCache to use.
+			*/
+			CachedCloneGiven(SystemType const& target, std::string cache_directory = HomotopyCache::DefaultDirectory()) : Base(target), given_key_(HomotopyCache::Key(TargetSystem(), "")), cache_directory_(std::move(cache_directory))
+			{}
+
+			/**
+			\brief Load the homotopy from the cache, or set it up as CloneGiven does, and store it.
+
+			The key is made from the target as given to the constructor, so setting up again, after the target was prepared, finds the same entry.
+			*/
+			void SystemSetup(std::string const& path_variable_name)
+			{
+				HomotopyCache cache(cache_directory_);
+				const auto key = HomotopyCache::Key(given_key_, Preparation(path_variable_name));
+
+				if (cache.Load(key, TargetSystem(), StartSystem(), Homotopy()))
+					return;
+
+				Base::SystemSetup(path_variable_name);
+				Homotopy().Differentiate();
+				cache.Store(key, TargetSystem(), StartSystem(), Homotopy());
+			}
+
+			/**
+			\brief The directory of the cache.
+			*/
+			std::string const& CacheDirectory() const
+			{
+				return cache_directory_;
+			}
+
+			/**
+			\brief Use another cache directory, from the next SystemSetup on.
+			*/
+			void CacheDirectory(std::string const& directory)
+			{
+				cache_directory_ = directory;
+			}
+
+		private:
+
+			/**
+			\brief Describe everything besides the target which the prepared systems depend on.
+			*/
+			static
+			std::string Preparation(std::string const& path_variable_name)
+			{
+				return boost::typeindex::type_id<CachedCloneGiven>().pretty_name() + " homogenized and patched"
+				     + " start " + boost::typeindex::type_id<StartSystemType>().pretty_name()
+				     + " path variable " + path_variable_name;
+			}
+
+			std::string given_key_; ///< HomotopyCache::Key of the target as given, before it was prepared.
+			std::string cache_directory_; ///< Where the cache lives.
+		};
+
+
 		/**
 		This system management policy allows the user to prevent the zero dim algorithm from making clones, and instead the burden of supplying the target system, start system, and homotopy are entirely up to the user.
 
@@ -313,6 +393,17 @@ public:
 			void SystemSetup(std::string const& path_variable_name) const
 			{ }
 
+			/**
+			\brief The homotopy is the user's, so this policy can't form another between the target and start systems.
+
+			\throws std::runtime_error, always.
+			*/
+			static
+			void FormHomotopy(SystemType &, SystemType const&, StartSystemType const&, std::string const&)
+			{
+				throw std::runtime_error("unable to form a homotopy from systems given by reference -- the homotopy was given too.");
+			}
+
 		};
 	} // ns policy
 } // ns bertini
\ No newline at end of file
@@ -32,6 +32,9 @@ You can also provide your own, that's the point of these policies.
 
 #include "bertini2/nag_algorithms/zero_dim_solve.hpp"
 #include "bertini2/io/generators.hpp"
+#include "bertini2/io/results_file.hpp"
+
+#include <functional>
 
 
 namespace bertini {
@@ -65,6 +68,44 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 
 		out << "\n\n\n RAWDATA \n\n\n";
 		RawData(out, zd);
+
+		out << "\n\n\n PROFILE \n\n\n";
+		Profile(out, zd);
+	}
+
+
+	/**
+	\brief Write the tracking profile of the solve: the totals, then one line per path, in columns.
+
+	Times are wall times in seconds.  The precisions column lists precision:seconds pairs, precisions in digits.
+	*/
+	template <typename OutT>
+	static
+	void Profile(OutT & out, ZDT const& zd)
+	{
+		out << "path accepted rejected newton_its func_evals jac_evals dt_evals LUs prec_changes pre_eg_s eg_s refine_s precisions\n";
+
+		ProfileLine(out, "total", zd.Profile());
+		const auto& p = zd.PathProfiles();
+		for (decltype(p.size()) ii{0}; ii<p.size(); ++ii)
+			ProfileLine(out, ii, p[ii]);
+	}
+
+
+	template <typename LabelT, typename OutT>
+	static
+	void ProfileLine(OutT & out, LabelT const& label, typename ZDT::PathProfile const& p)
+	{
+		const auto& c = p.counters;
+		out << label << ' '
+			<< c.steps_accepted << ' ' << c.steps_rejected << ' '
+			<< c.newton_iterations << ' '
+			<< c.function_evaluations << ' ' << c.jacobian_evaluations << ' ' << c.time_derivative_evaluations << ' '
+			<< c.lu_factorizations << ' ' << c.precision_changes << ' '
+			<< p.pre_endgame_seconds << ' ' << p.endgame_seconds << ' ' << p.refinement_seconds;
+		for (auto const& s : c.seconds_at_precision)
+			out << ' ' << s.first << ':' << s.second;
+		out << '\n';
 	}
 
 	
@@ -201,11 +242,34 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 	static
 	void EndPointMDRaw(IndexT const& ind, OutT & out, ZDT const& zd, std::string const& additional = "\n")
 	{
-		const auto& pt = zd.FinalSolutions()[ind];
-		const auto& data = zd.FinalSolutionMetadata()[ind];
+		RawRecord(out, zd.FinalSolutions()[ind], zd.FinalSolutionMetadata()[ind], additional);
+	}
+
+
+	/**
+	\brief A callback for ZeroDim::SetSolutionCallback, writing each solution as it comes out of the endgame, as a record of the raw data.
+
+	A path which is passed again is written again; the later record supersedes the earlier.  The stream must outlive the solve.
+	*/
+	template <typename OutT>
+	static
+	typename ZDT::SolutionCallback Streamer(OutT & out)
+	{
+		return [&out](typename ZDT::SolnIndT, auto const& pt, auto const& data)
+		{
+			RawRecord(out, pt, data, "\n");
+			out << std::flush;
+		};
+	}
+
+
+	template <typename PointT, typename MetaDataT, typename OutT>
+	static
+	void RawRecord(OutT & out, PointT const& pt, MetaDataT const& data, std::string const& additional = "\n")
+	{
 		out << data.path_index << '\n'
 			<< Precision(pt) << '\n';
-		EndPoint(ind, out, zd);
+		generators::Classic::generate(boost::spirit::ostream_iterator(out), pt);
 		out << data.function_residual << '\n'
 			<< data.condition_number << '\n'
 			<< data.newton_residual << '\n';
@@ -221,6 +285,208 @@ struct Classic <ZeroDim<A,B,C,D,E>>
 };
 
 
+/**
+\brief Writes the results of an algorithm to the compact binary results file format.
+
+Much faster and smaller than Classic, for large numbers of solutions.  Read the files back with binary::ResultsFile.
+
+\see bertini2/io/results_file.hpp
+*/
+template <typename ...T>
+struct Binary
+{};
+
+
+template <typename A, typename B, typename C, typename D, template<typename, typename> class E>
+struct Binary <ZeroDim<A,B,C,D,E>>
+{
+	using ZDT = ZeroDim<A,B,C,D,E>;
+	using BCT = typename AlgoTraits<ZDT>::BaseComplexType;
+	using SolutionMetaData = typename ZDT::SolutionMetaData;
+	using IndT = typename SolnCont<BCT>::size_type;
+
+	/**
+	\brief A column waiting to be written.  The size must be known before writing, so the directory can be written first.
+	*/
+	struct PendingColumn
+	{
+		std::string name;
+		binary::ColumnType type;
+		std::uint64_t size;
+		std::function<void(binary::AppendFile &)> write;
+	};
+
+
+	/**
+	\brief Write the solutions and their metadata to a file.  Paths which were never started are omitted, as in Classic.
+
+	\param filename The file to write.  Overwritten if it exists.
+	\param zd The algorithm whose results to write.
+	*/
+	static
+	void All(Path const& filename, ZDT const& zd)
+	{
+		using Layout = binary::ResultsFileLayout;
+
+		const auto& m = zd.FinalSolutionMetadata();
+		std::vector<IndT> which;
+		for (IndT ii{0}; ii<m.size(); ++ii)
+			if (m[ii].endgame_success != SuccessCode::NeverStarted)
+				which.push_back(ii);
+
+		std::vector<std::string> variables;
+		for (const auto& x : zd.TargetSystem().VariableOrdering())
+		{
+			std::stringstream name;
+			name << *x;
+			variables.push_back(name.str());
+		}
+
+		std::vector<PendingColumn> columns;
+		PointColumns(columns, which, zd, variables.size(), std::is_same<BCT, dbl>());
+		MetadataColumns(columns, which, zd);
+
+		// everything up to the end of the directory
+		std::uint64_t header_size = Layout::MagicSize + 4*sizeof(std::uint32_t) + 2*sizeof(std::uint64_t);
+		for (const auto& v : variables)
+			header_size += sizeof(std::uint64_t) + v.size();
+		for (const auto& c : columns)
+			header_size += sizeof(std::uint64_t) + c.name.size() + 2*sizeof(std::uint32_t) + 2*sizeof(std::uint64_t);
+
+		binary::Buffer header;
+		header.insert(header.end(), Layout::Magic(), Layout::Magic()+Layout::MagicSize);
+		binary::Write(header, binary::ByteOrderMark);
+		binary::Write(header, std::uint32_t{Layout::Version});
+		binary::Write(header, static_cast<std::uint32_t>(binary::NumberTypeTag<BCT>::value));
+		binary::Write(header, static_cast<std::uint32_t>(columns.size()));
+		binary::Write(header, static_cast<std::uint64_t>(which.size()));
+		binary::Write(header, static_cast<std::uint64_t>(variables.size()));
+		for (const auto& v : variables)
+			binary::Write(header, v);
+
+		auto offset = Layout::Padded(header_size);
+		for (const auto& c : columns)
+		{
+			binary::Write(header, c.name);
+			binary::Write(header, static_cast<std::uint32_t>(c.type));
+			binary::Write(header, std::uint32_t{0});
+			binary::Write(header, offset);
+			binary::Write(header, c.size);
+			offset = Layout::Padded(offset + c.size);
+		}
+		header.resize(Layout::Padded(header.size()), 0);
+
+		binary::AppendFile file(filename, true);
+		file.Append(header);
+
+		const char zeros[Layout::Alignment] = {};
+		for (const auto& c : columns)
+		{
+			c.write(file);
+			file.Append(zeros, Layout::Padded(c.size) - c.size);
+		}
+	}
+
+private:
+
+	/**
+	\brief Make a fixed-width column of metadata, by applying a function to the metadata of each solution.
+	*/
+	template <typename T, typename F>
+	static
+	PendingColumn MakeColumn(std::string const& name, std::vector<IndT> const& which, ZDT const& zd, F && f)
+	{
+		auto data = std::make_shared<std::vector<T>>();
+		data->reserve(which.size());
+		for (auto ii : which)
+			data->push_back(static_cast<T>(f(zd.FinalSolutionMetadata()[ii])));
+
+		const auto size = data->size()*sizeof(T);
+		return {name, binary::ColumnTypeOf<T>::value, size,
+				[data, size](binary::AppendFile & file){ file.Append(reinterpret_cast<char const*>(data->data()), size); }};
+	}
+
+
+	static
+	void MetadataColumns(std::vector<PendingColumn> & c, std::vector<IndT> const& which, ZDT const& zd)
+	{
+		using I8 = std::int8_t;
+		using I32 = std::int32_t;
+		using I64 = std::int64_t;
+
+		c.push_back(MakeColumn<I64>("path_index", which, zd, [](SolutionMetaData const& d){ return d.path_index; }));
+		c.push_back(MakeColumn<I64>("solution_index", which, zd, [](SolutionMetaData const& d){ return d.solution_index; }));
+		c.push_back(MakeColumn<I8>("precision_changed", which, zd, [](SolutionMetaData const& d){ return d.precision_changed; }));
+		c.push_back(MakeColumn<dbl>("time_of_first_prec_increase", which, zd, [](SolutionMetaData const& d){ return static_cast<dbl>(d.time_of_first_prec_increase); }));
+		c.push_back(MakeColumn<I64>("max_precision_used", which, zd, [](SolutionMetaData const& d){ return d.max_precision_used; }));
+		c.push_back(MakeColumn<I32>("pre_endgame_success", which, zd, [](SolutionMetaData const& d){ return d.pre_endgame_success; }));
+		c.push_back(MakeColumn<double>("condition_number", which, zd, [](SolutionMetaData const& d){ return d.condition_number; }));
+		c.push_back(MakeColumn<double>("newton_residual", which, zd, [](SolutionMetaData const& d){ return d.newton_residual; }));
+		c.push_back(MakeColumn<dbl>("final_time_used", which, zd, [](SolutionMetaData const& d){ return static_cast<dbl>(d.final_time_used); }));
+		c.push_back(MakeColumn<double>("accuracy_estimate", which, zd, [](SolutionMetaData const& d){ return d.accuracy_estimate; }));
+		c.push_back(MakeColumn<double>("accuracy_estimate_user_coords", which, zd, [](SolutionMetaData const& d){ return d.accuracy_estimate_user_coords; }));
+		c.push_back(MakeColumn<I64>("cycle_num", which, zd, [](SolutionMetaData const& d){ return d.cycle_num; }));
+		c.push_back(MakeColumn<I32>("endgame_success", which, zd, [](SolutionMetaData const& d){ return d.endgame_success; }));
+		c.push_back(MakeColumn<double>("function_residual", which, zd, [](SolutionMetaData const& d){ return d.function_residual; }));
+		c.push_back(MakeColumn<I64>("multiplicity", which, zd, [](SolutionMetaData const& d){ return d.multiplicity; }));
+		c.push_back(MakeColumn<I8>("is_real", which, zd, [](SolutionMetaData const& d){ return d.is_real; }));
+		c.push_back(MakeColumn<I8>("is_finite", which, zd, [](SolutionMetaData const& d){ return d.is_finite; }));
+		c.push_back(MakeColumn<I8>("is_singular", which, zd, [](SolutionMetaData const& d){ return d.is_singular; }));
+	}
+
+
+	/**
+	\brief Double precision points are written directly from the solutions, one after the other.
+	*/
+	static
+	void PointColumns(std::vector<PendingColumn> & c, std::vector<IndT> const& which, ZDT const& zd, std::uint64_t num_vars, std::true_type)
+	{
+		const auto& s = zd.FinalSolutions();
+
+		c.push_back({binary::columns::Points, binary::ColumnType::Complex128, which.size()*num_vars*sizeof(dbl),
+				[&s, &which, num_vars](binary::AppendFile & file)
+				{
+					for (auto ii : which)
+					{
+						if (static_cast<std::uint64_t>(s[ii].size()) != num_vars)
+							throw std::runtime_error("solution has wrong number of coordinates for binary output");
+						file.Append(reinterpret_cast<char const*>(s[ii].data()), num_vars*sizeof(dbl));
+					}
+				}});
+
+		c.push_back(MakeColumn<std::int64_t>(binary::columns::Precision, which, zd, [](SolutionMetaData const&){ return DoublePrecision(); }));
+	}
+
+
+	/**
+	\brief Multiple precision points are encoded exactly, each in its own precision.
+	*/
+	static
+	void PointColumns(std::vector<PendingColumn> & c, std::vector<IndT> const& which, ZDT const& zd, std::uint64_t, std::false_type)
+	{
+		const auto& s = zd.FinalSolutions();
+
+		auto blob = std::make_shared<binary::Buffer>();
+		auto offsets = std::make_shared<std::vector<std::int64_t>>();
+		auto precisions = std::make_shared<std::vector<std::int64_t>>();
+		for (auto ii : which)
+		{
+			offsets->push_back(static_cast<std::int64_t>(blob->size()));
+			precisions->push_back(static_cast<std::int64_t>(Precision(s[ii])));
+			binary::Write(*blob, s[ii]);
+		}
+
+		c.push_back({binary::columns::PointsMP, binary::ColumnType::Bytes, blob->size(),
+				[blob](binary::AppendFile & file){ file.Append(*blob); }});
+		c.push_back({binary::columns::PointOffsets, binary::ColumnType::Int64, offsets->size()*sizeof(std::int64_t),
+				[offsets](binary::AppendFile & file){ file.Append(reinterpret_cast<char const*>(offsets->data()), offsets->size()*sizeof(std::int64_t)); }});
+		c.push_back({binary::columns::Precision, binary::ColumnType::Int64, precisions->size()*sizeof(std::int64_t),
+				[precisions](binary::AppendFile & file){ file.Append(reinterpret_cast<char const*>(precisions->data()), precisions->size()*sizeof(std::int64_t)); }});
+	}
+};
+
+
+
 struct NonsingularSolutions
 {
 
@@ -0,0 +1,534 @@
+//This file is part of Bertini 2.
+//
+//bertini2/nag_algorithms/parameter_homotopy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/nag_algorithms/parameter_homotopy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/nag_algorithms/parameter_homotopy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/nag_algorithms/parameter_homotopy.hpp
+
+\brief Provides the second step of a parameter homotopy: tracking solutions at generic parameter values to solutions at many other parameter values.
+
+The first step, solving at generic parameter values, is just a ZeroDim solve.
+*/
+
+#pragma once
+
+#include "bertini2/num_traits.hpp"
+#include "bertini2/tracking.hpp"
+#include "bertini2/detail/configured.hpp"
+#include "bertini2/nag_algorithms/common/algorithm_base.hpp"
+#include "bertini2/nag_algorithms/common/config.hpp"
+
+#include <atomic>
+#include <limits>
+#include <thread>
+
+
+namespace bertini {
+
+	namespace algorithm {
+
+
+/**
+forward declare of ParameterHomotopy algorithm
+*/
+template<typename TrackerType, typename EndgameType>
+struct ParameterHomotopy;
+
+
+
+/**
+specify the traits for the algorithm.  this is why we need the forward declare
+*/
+template<typename TrackerType, typename EndgameType>
+struct AlgoTraits <ParameterHomotopy<TrackerType, EndgameType>>
+{
+	using BaseRealType = typename tracking::TrackerTraits<TrackerType>::BaseRealType;
+	using BaseComplexType = typename tracking::TrackerTraits<TrackerType>::BaseComplexType;
+
+	using NeededConfigs = detail::TypeList<
+								TolerancesConfig,
+								ZeroDimConfig<BaseComplexType>,
+								ParameterHomotopyConfig
+								>;
+};
+
+
+
+/**
+\brief Tracks the solutions of a parametrized system at generic parameter values, to solutions at as many other parameter values as you like.
+
+The homotopy is given once, and differentiated once.  Its parameters must be Variables added to it as implicit parameters, via System::AddImplicitParameters.  At the start time, the homotopy must agree with the system at the generic parameter values, and at the target time, with the system at the values of the implicit parameters.  For example,
+
+\code
+auto t = MakeVariable("t");
+auto p = MakeVariable("p");
+auto p_generic = MakeFloat(RandomComplex(30));
+
+System homotopy;
+homotopy.AddFunction(x*x - ((1-t)*p + t*p_generic));
+homotopy.AddVariableGroup(VariableGroup{x});
+homotopy.AddPathVariable(t);
+homotopy.AddImplicitParameters(VariableGroup{p});
+
+ParameterHomotopy<TrackerT, EndgameT> ph(homotopy, generic_solutions);
+auto results = ph.Solve(many_parameter_values);
+\endcode
+
+Tracking is done by a pool of workers, each with its own deep copy of the homotopy, tracker, and endgame, made once and kept for subsequent calls to Solve.  So, between runs, only the parameter values change.  Configure the tracker and endgame returned by GetTracker and GetEndgame; each worker is set up like them at the start of each Solve.
+
+Observers attached to the tracker or endgame of this object are not notified of tracking done by the workers.
+*/
+template<typename TrackerType, typename EndgameType>
+struct ParameterHomotopy :
+				public virtual AnyAlgorithm,
+				public detail::Configured<
+					typename AlgoTraits< ParameterHomotopy<TrackerType, EndgameType>>::NeededConfigs>
+{
+
+/// a bunch of using statements to reduce typing.
+	using BaseComplexType 	= typename tracking::TrackerTraits<TrackerType>::BaseComplexType;
+	using BaseRealType    	= typename tracking::TrackerTraits<TrackerType>::BaseRealType;
+
+	using PrecisionConfig 	= typename tracking::TrackerTraits<TrackerType>::PrecisionConfig;
+
+	using SolnIndT 			= typename SolnCont<BaseComplexType>::size_type;
+
+	using Config = detail::Configured<
+						typename AlgoTraits<ParameterHomotopy<TrackerType, EndgameType>>::NeededConfigs>;
+	using Config::Get;
+
+	using Tolerances = TolerancesConfig;
+	using ZeroDimConf = ZeroDimConfig<BaseComplexType>;
+	using ParamHomConf = ParameterHomotopyConfig;
+
+
+/// metadata structs
+
+	struct SolutionMetaData
+	{
+		SuccessCode pre_endgame_success = SuccessCode::NeverStarted;
+		SuccessCode endgame_success = SuccessCode::NeverStarted;
+
+		NumErrorT condition_number; 		// the latest estimate on the condition number
+		BaseComplexType final_time_used;   	// the final value of time tracked to
+		NumErrorT accuracy_estimate; 		// accuracy estimate between extrapolations
+		unsigned cycle_num;    				// cycle number used in extrapolations
+	};
+
+
+	/**
+	\brief The results of tracking to one set of parameter values.
+	*/
+	struct Result
+	{
+		Vec<BaseComplexType> parameter_values;
+		SolnCont<Vec<BaseComplexType>> solutions; ///< one per generic solution, in the same order
+		SolnCont<SolutionMetaData> metadata;
+	};
+
+
+/// constructors
+
+	/**
+	\param homotopy The parameter homotopy.  Must have a path variable, and its parameters as implicit parameters.  It is cloned, so your copy is left alone.
+	\param generic_solutions The solutions at the generic parameter values, the start points for every run.
+	*/
+	ParameterHomotopy(System const& homotopy, SolnCont<Vec<BaseComplexType>> const& generic_solutions) :
+		homotopy_(Clone(homotopy)), generic_solutions_(generic_solutions), tracker_(homotopy_), endgame_(tracker_)
+	{
+		ConsistencyCheck();
+		DefaultSetup();
+	}
+
+	ParameterHomotopy(ParameterHomotopy const&) = delete;
+	ParameterHomotopy& operator=(ParameterHomotopy const&) = delete;
+
+	virtual ~ParameterHomotopy() = default;
+
+
+	/**
+	\brief Main Run() function provided for calling from the blackbox mode.  Tracks to the parameter values set by SetTargetParameterValues, and keeps the results for Results.
+	*/
+	void Run() override
+	{
+		results_ = Solve(target_parameter_values_);
+	}
+
+
+/// setup functions
+
+	/**
+	\brief Check that the homotopy is a parameter homotopy we can work with.
+	*/
+	void ConsistencyCheck() const
+	{
+		if (!homotopy_.HavePathVariable())
+			throw std::runtime_error("unable to run parameter homotopy -- homotopy has no path variable.");
+
+		if (homotopy_.NumImplicitParameters()==0)
+			throw std::runtime_error("unable to run parameter homotopy -- homotopy has no implicit parameters to vary.  add them using AddImplicitParameters.");
+
+		for (const auto& s : generic_solutions_)
+			if (static_cast<unsigned long long>(s.size()) != homotopy_.NumVariables())
+				throw std::runtime_error("unable to run parameter homotopy -- a generic solution has the wrong number of coordinates for the homotopy.");
+	}
+
+
+	void DefaultSetup()
+	{
+		DefaultSettingsSetup();
+		DefaultSystemSetup();
+		DefaultTrackerSetup();
+	}
+
+
+	/**
+	Fills the settings from default values.
+	*/
+	void DefaultSettingsSetup()
+	{
+		this->template Set<Tolerances>(Tolerances());
+		this->template Set<ZeroDimConf>(ZeroDimConf());
+		this->template Set<ParamHomConf>(ParamHomConf());
+	}
+
+
+	/**
+	\brief Differentiate the homotopy, once and for all.  Every worker gets a copy of the differentiated homotopy.
+	*/
+	void DefaultSystemSetup()
+	{
+		homotopy_.Differentiate();
+		workers_.clear();
+	}
+
+
+	void DefaultTrackerSetup()
+	{
+		tracker_.Setup(tracking::predict::DefaultPredictor(),
+		              	this->template Get<Tolerances>().newton_before_endgame,
+		              	this->template Get<Tolerances>().path_truncation_threshold,
+						tracking::SteppingConfig(), tracking::NewtonConfig());
+
+		tracker_.PrecisionSetup(PrecisionConfig(homotopy_));
+	}
+
+
+	const TrackerType & GetTracker() const
+	{
+		return tracker_;
+	}
+
+	/**
+	\brief Gets the tracker, whose settings are copied to the workers at the start of each Solve.
+	*/
+	TrackerType & GetTracker()
+	{
+		return tracker_;
+	}
+
+	const EndgameType & GetEndgame() const
+	{
+		return endgame_;
+	}
+
+	/**
+	\brief Gets the endgame, whose settings are copied to the workers at the start of each Solve.
+	*/
+	EndgameType & GetEndgame()
+	{
+		return endgame_;
+	}
+
+	template<typename T>
+	const T & GetFromEndgame() const
+	{
+		return endgame_.template Get<T>();
+	}
+
+	template<typename T>
+	void SetToEndgame(T const& t)
+	{
+		endgame_.Set(t);
+	}
+
+
+	const System& Homotopy() const
+	{
+		return homotopy_;
+	}
+
+	const SolnCont<Vec<BaseComplexType>>& GenericSolutions() const
+	{
+		return generic_solutions_;
+	}
+
+	/**
+	\brief Set the parameter values which Run tracks to.  Each entry is values for the implicit parameters of the homotopy, in the order they were added to it.
+	*/
+	void SetTargetParameterValues(std::vector<Vec<BaseComplexType>> const& parameter_values)
+	{
+		target_parameter_values_ = parameter_values;
+	}
+
+	const std::vector<Vec<BaseComplexType>>& TargetParameterValues() const
+	{
+		return target_parameter_values_;
+	}
+
+	/**
+	\brief Get the results of the latest Run, one per set of target parameter values.
+	*/
+	const std::vector<Result>& Results() const
+	{
+		return results_;
+	}
+
+
+/// the main functions
+
+	/**
+	\brief Track the generic solutions to one set of parameter values.
+
+	\param parameter_values Values for the implicit parameters of the homotopy, in the order they were added to it.
+	*/
+	Result Solve(Vec<BaseComplexType> const& parameter_values)
+	{
+		return std::move(Solve(std::vector<Vec<BaseComplexType>>{parameter_values}).front());
+	}
+
+
+	/**
+	\brief Track the generic solutions to each of many sets of parameter values.
+
+	All paths for all parameter values go into a single queue, from which the workers take paths in order.  So the workers are kept busy even if there are few paths per parameter value, and each worker changes its parameter values only when it moves on to the next set.
+
+	\param parameter_values Each entry is values for the implicit parameters of the homotopy, in the order they were added to it.
+	\return One Result per set of parameter values, in the same order.
+	*/
+	std::vector<Result> Solve(std::vector<Vec<BaseComplexType>> const& parameter_values)
+	{
+		const auto num_params = homotopy_.NumImplicitParameters();
+		for (const auto& p : parameter_values)
+			if (static_cast<decltype(num_params)>(p.size()) != num_params)
+				throw std::runtime_error("parameter values have size " + std::to_string(p.size()) + ", but the homotopy has " + std::to_string(num_params) + " implicit parameters.");
+
+		std::vector<Result> results(parameter_values.size());
+		for (decltype(results.size()) ii{0}; ii<results.size(); ++ii)
+		{
+			results[ii].parameter_values = parameter_values[ii];
+			results[ii].solutions.resize(generic_solutions_.size());
+			results[ii].metadata.resize(generic_solutions_.size());
+		}
+
+		const auto num_paths = generic_solutions_.size();
+		const auto total_work = num_paths * parameter_values.size();
+		if (total_work==0)
+			return results;
+
+		PrepareWorkers(total_work);
+
+		std::atomic<decltype(total_work)> next{0};
+		std::vector<std::exception_ptr> errors(workers_.size());
+		const auto precision = DefaultPrecision();
+
+		auto work = [&](SolnIndT worker_index)
+		{
+			try
+			{
+				DefaultPrecision(precision);
+				auto& w = *workers_[worker_index];
+				w.current_parameter_set = std::numeric_limits<SolnIndT>::max();
+
+				for (auto ii = next++; ii < total_work; ii = next++)
+				{
+					const auto param_ind = ii / num_paths;
+					const auto path_ind = ii % num_paths;
+
+					if (w.current_parameter_set != param_ind)
+					{
+						SetParameterValues(w.homotopy, parameter_values[param_ind]);
+						w.current_parameter_set = param_ind;
+					}
+
+					auto& r = results[param_ind];
+					TrackSinglePath(w, generic_solutions_[path_ind], r.solutions[path_ind], r.metadata[path_ind]);
+				}
+			}
+			catch (...)
+			{
+				errors[worker_index] = std::current_exception();
+			}
+		};
+
+		if (workers_.size()==1)
+			work(0);
+		else
+		{
+			std::vector<std::thread> threads;
+			for (SolnIndT ii{0}; ii<workers_.size(); ++ii)
+				threads.emplace_back(work, ii);
+			for (auto& t : threads)
+				t.join();
+		}
+
+		for (auto const& e : errors)
+			if (e)
+				std::rethrow_exception(e);
+
+		return results;
+	}
+
+
+private:
+
+	/**
+	\brief All the things needed to track paths independently of the other workers.
+
+	Not movable, since the tracker refers to the homotopy, and the endgame to the tracker.
+	*/
+	struct Worker
+	{
+		Worker(System const& h, EndgameType const& eg) : homotopy(Clone(h)), tracker(homotopy), endgame(eg)
+		{
+			endgame.SetTracker(tracker);
+		}
+
+		Worker(Worker const&) = delete;
+		Worker& operator=(Worker const&) = delete;
+
+		System homotopy;
+		TrackerType tracker;
+		EndgameType endgame;
+		SolnIndT current_parameter_set;
+	};
+
+
+	/**
+	\brief Make sure there are exactly as many workers as threads to be used, and set them up like the tracker and endgame of this object.
+	*/
+	void PrepareWorkers(std::size_t total_work)
+	{
+		auto num_threads = static_cast<std::size_t>(this->template Get<ParamHomConf>().num_threads);
+		if (num_threads==0)
+			num_threads = std::max(1u, std::thread::hardware_concurrency());
+		num_threads = std::min(num_threads, total_work);
+
+		while (workers_.size() < num_threads)
+			workers_.push_back(std::make_unique<Worker>(homotopy_, endgame_));
+		workers_.resize(num_threads);
+
+		for (auto& w : workers_)
+		{
+			w->tracker.SetupLike(tracker_);
+			w->endgame.configuration_ = endgame_.configuration_;
+		}
+	}
+
+
+	/**
+	\brief Set the values of the implicit parameters of a homotopy.  For multiple precision, the double values are set too, so the adaptive tracker can use either.
+	*/
+	static
+	void SetParameterValues(System const& homotopy, Vec<BaseComplexType> const& values)
+	{
+		homotopy.SetImplicitParameters(values);
+		SetDoubleParameterValues(homotopy, values, std::is_same<BaseComplexType, mpfr>());
+	}
+
+	static
+	void SetDoubleParameterValues(System const& homotopy, Vec<BaseComplexType> const& values, std::true_type)
+	{
+		Vec<dbl> as_dbl(values.size());
+		for (int ii = 0; ii < values.size(); ++ii)
+			as_dbl(ii) = static_cast<dbl>(values(ii));
+		homotopy.SetImplicitParameters(as_dbl);
+	}
+
+	static
+	void SetDoubleParameterValues(System const&, Vec<BaseComplexType> const&, std::false_type)
+	{}
+
+
+	/**
+	\brief Track one path, to the endgame boundary and then through the endgame.
+	*/
+	void TrackSinglePath(Worker & w, Vec<BaseComplexType> const& start_point, Vec<BaseComplexType> & solution, SolutionMetaData & smd) const
+	{
+		const auto& zd_conf = this->template Get<ZeroDimConf>();
+		const auto& tols = this->template Get<Tolerances>();
+
+		DefaultPrecision(zd_conf.initial_ambient_precision);
+
+		BaseComplexType t_start = zd_conf.start_time;
+		BaseComplexType t_endgame_boundary = zd_conf.endgame_boundary;
+
+		w.tracker.SetTrackingTolerance(tols.newton_before_endgame);
+		w.tracker.ReinitializeInitialStepSize(true);
+
+		Vec<BaseComplexType> bdry_point;
+		smd.pre_endgame_success = w.tracker.TrackPath(bdry_point, t_start, t_endgame_boundary, start_point);
+
+		if (smd.pre_endgame_success != SuccessCode::Success)
+		{
+			solution = bdry_point;
+			return;
+		}
+
+		// pick up in the endgame with the stepsize we left off with
+		w.tracker.SetTrackingTolerance(tols.newton_during_endgame);
+		w.tracker.ReinitializeInitialStepSize(false);
+
+		DefaultPrecision(Precision(bdry_point));
+		// we make these fresh so they are in the correct precision to start.
+		BaseComplexType t_end = zd_conf.target_time;
+		t_endgame_boundary = zd_conf.endgame_boundary;
+
+		smd.endgame_success = w.endgame.Run(t_endgame_boundary, bdry_point, t_end);
+
+		solution = w.endgame.template FinalApproximation<BaseComplexType>();
+		smd.final_time_used = w.endgame.LatestTime();
+		smd.condition_number = w.tracker.LatestConditionNumber();
+		smd.accuracy_estimate = w.endgame.template ApproximateError();
+		smd.cycle_num = w.endgame.CycleNumber();
+	}
+
+
+///////
+//	private data members
+///////
+
+	System homotopy_;
+	SolnCont<Vec<BaseComplexType>> generic_solutions_;
+
+	TrackerType tracker_; ///< not used for tracking, only as the settings for the workers' trackers.
+	EndgameType endgame_; ///< not used for tracking, only as the settings for the workers' endgames.
+
+	std::vector<std::unique_ptr<Worker>> workers_;
+
+	std::vector<Vec<BaseComplexType>> target_parameter_values_; ///< what Run tracks to
+	std::vector<Result> results_; ///< the results of the latest Run
+
+}; // struct ParameterHomotopy
+
+	} // ns algorithm
+
+} // ns bertini
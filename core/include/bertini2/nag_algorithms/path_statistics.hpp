@@ -0,0 +1,276 @@
+//This file is part of Bertini 2.
+//
+//bertini2/nag_algorithms/path_statistics.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/nag_algorithms/path_statistics.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/nag_algorithms/path_statistics.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/nag_algorithms/path_statistics.hpp
+
+\brief Provides a model of how the paths of a homotopy behave, learned from the paths already tracked, for starting new paths with a step size and precision which suit them.
+
+Paths from the start points of one start system, such as a total degree start system, behave much alike over the early part of the homotopy.  A tracker starting each path from its default step size rediscovers the right step size by failing steps, path after path.  The model records, over equal pieces of the path from start time to end time, the step sizes taken and the precision used, and from the first piece suggests where the next path should start.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "bertini2/trackers/observers.hpp"
+
+namespace bertini{
+	namespace algorithm{
+
+		/**
+		\brief The step size and precision profile of completed paths of a homotopy.
+
+		Paths are divided into bins of equal length in time, from start time to end time.  The model keeps, for each bin, the geometric mean step size, and the highest precision used, over the paths folded into it.
+
+		\code
+		PathStatistics stats(20);
+		stats.BeginPath();
+		stats.RecordStep(0.01, 0.01, 16); // for each successful step
+		stats.EndPath(true);
+		if (stats.NumPaths() >= 8)
+			tracker.SetStepSize(stats.InitialStepSize(0.25));
+		\endcode
+		*/
+		class PathStatistics
+		{
+		public:
+
+			explicit
+			PathStatistics(unsigned num_bins = 20) : num_bins_(std::max(num_bins, 1u))
+			{
+				Reset();
+			}
+
+			/**
+			\brief Forget every path, keeping the number of bins.
+			*/
+			void Reset()
+			{
+				num_paths_ = 0;
+				log_step_sums_.assign(num_bins_, 0);
+				step_counts_.assign(num_bins_, 0);
+				max_precisions_.assign(num_bins_, 0);
+				early_step_sizes_.clear();
+				early_precisions_.clear();
+				BeginPath();
+			}
+
+			/**
+			\brief Start recording a new path.  A path which is begun, but not ended, is forgotten.
+			*/
+			void BeginPath()
+			{
+				path_log_step_sums_.assign(num_bins_, 0);
+				path_step_counts_.assign(num_bins_, 0);
+				path_max_precisions_.assign(num_bins_, 0);
+			}
+
+			/**
+			\brief Record a successful step of the current path.
+
+			\param fraction How far along the path the step ended, from 0 at the start time to 1 at the end time.
+			\param step_size The length in time of the step.
+			\param precision The precision the step was taken in.
+			*/
+			void RecordStep(double fraction, double step_size, unsigned precision)
+			{
+				if (!(step_size > 0) || !std::isfinite(step_size))
+					return;
+
+				auto bin = Bin(fraction);
+				path_log_step_sums_[bin] += std::log(step_size);
+				++path_step_counts_[bin];
+				path_max_precisions_[bin] = std::max(path_max_precisions_[bin], precision);
+			}
+
+			/**
+			\brief Finish recording the current path, folding it into the model if it was tracked successfully.  Failed paths say little about how their neighbors should start.
+			*/
+			void EndPath(bool success)
+			{
+				if (success && path_step_counts_[0] > 0)
+				{
+					for (unsigned ii = 0; ii < num_bins_; ++ii)
+					{
+						log_step_sums_[ii] += path_log_step_sums_[ii];
+						step_counts_[ii] += path_step_counts_[ii];
+						max_precisions_[ii] = std::max(max_precisions_[ii], path_max_precisions_[ii]);
+					}
+					early_step_sizes_.push_back(std::exp(path_log_step_sums_[0]/path_step_counts_[0]));
+					early_precisions_.push_back(path_max_precisions_[0]);
+					++num_paths_;
+				}
+				BeginPath();
+			}
+
+
+			/**
+			\brief The number of paths folded into the model.
+			*/
+			std::size_t NumPaths() const
+			{
+				return num_paths_;
+			}
+
+			unsigned NumBins() const
+			{
+				return num_bins_;
+			}
+
+			/**
+			\brief The geometric mean of the step sizes taken in a bin, over all paths, or 0 if none were.
+			*/
+			double StepSizeProfile(unsigned bin) const
+			{
+				return step_counts_.at(bin) ? std::exp(log_step_sums_[bin]/step_counts_[bin]) : 0;
+			}
+
+			/**
+			\brief The highest precision used in a bin by any path, or 0 if no path took a step in it.
+			*/
+			unsigned PrecisionProfile(unsigned bin) const
+			{
+				return max_precisions_.at(bin);
+			}
+
+			/**
+			\brief The step size to start a new path with: a quantile, over the paths, of the geometric mean step size each took in the first bin.
+
+			\param quantile Between 0 and 1.  Lower is more cautious.
+			\throws std::runtime_error, if there are no paths in the model.
+			*/
+			double InitialStepSize(double quantile) const
+			{
+				if (early_step_sizes_.empty())
+					throw std::runtime_error("asking for an initial step size from path statistics with no paths");
+
+				auto sizes = early_step_sizes_;
+				auto nth = sizes.begin() + static_cast<std::ptrdiff_t>(std::floor(Clamp(quantile)*(sizes.size()-1)));
+				std::nth_element(sizes.begin(), nth, sizes.end());
+				return *nth;
+			}
+
+			/**
+			\brief The precision to start a new path in: the highest precision which at least a given fraction of the paths reached in the first bin.
+
+			\param quorum Between 0 and 1.  The fraction of paths which must have used the precision.
+			\throws std::runtime_error, if there are no paths in the model.
+			*/
+			unsigned InitialPrecision(double quorum) const
+			{
+				if (early_precisions_.empty())
+					throw std::runtime_error("asking for an initial precision from path statistics with no paths");
+
+				auto precisions = early_precisions_;
+				auto needed = static_cast<std::ptrdiff_t>(std::ceil(Clamp(quorum)*precisions.size()));
+				auto nth = precisions.begin() + std::max<std::ptrdiff_t>(needed, 1) - 1;
+				std::nth_element(precisions.begin(), nth, precisions.end(), std::greater<unsigned>());
+				return *nth;
+			}
+
+		private:
+
+			static
+			double Clamp(double x)
+			{
+				if (!(x > 0)) // also NaN
+					return 0;
+				return std::min(x, 1.);
+			}
+
+			unsigned Bin(double fraction) const
+			{
+				return std::min(static_cast<unsigned>(Clamp(fraction)*num_bins_), num_bins_-1);
+			}
+
+			unsigned num_bins_;
+			std::size_t num_paths_;
+
+			std::vector<double> log_step_sums_; ///< the sum of the logs of the step sizes taken in each bin, over all paths
+			std::vector<unsigned long long> step_counts_; ///< the number of steps taken in each bin, over all paths
+			std::vector<unsigned> max_precisions_; ///< the highest precision used in each bin, over all paths
+
+			std::vector<double> early_step_sizes_; ///< for each path, the geometric mean step size in the first bin
+			std::vector<unsigned> early_precisions_; ///< for each path, the highest precision used in the first bin
+
+			std::vector<double> path_log_step_sums_; ///< as log_step_sums_, for the path being recorded
+			std::vector<unsigned long long> path_step_counts_; ///< as step_counts_, for the path being recorded
+			std::vector<unsigned> path_max_precisions_; ///< as max_precisions_, for the path being recorded
+		};
+
+
+
+		/**
+		\brief Records the successful steps of a tracker into a PathStatistics.
+
+		Each call to TrackPath begins a path in the statistics.  Whoever calls TrackPath knows whether it succeeded, so must call PathStatistics::EndPath.
+		*/
+		template<class TrackerT>
+		class PathStatisticsRecorder : public EventObserver<TrackerT, detail::TypeList<
+											tracking::Initializing<tracking::EventEmitter<TrackerT>, typename tracking::TrackerTraits<TrackerT>::BaseComplexType>,
+											tracking::SuccessfulStep<tracking::EventEmitter<TrackerT>> > >
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = tracking::EventEmitter<TrackerT>;
+			using ComplexT = typename tracking::TrackerTraits<TrackerT>::BaseComplexType;
+
+			void Observe(tracking::Initializing<EmitterT, ComplexT> const& e) override
+			{
+				start_time_ = e.StartTime();
+				previous_time_ = e.StartTime();
+				using std::abs;
+				length_ = NumErrorT(abs(e.EndTime() - e.StartTime()));
+				statistics_.BeginPath();
+			}
+
+			void Observe(tracking::SuccessfulStep<EmitterT> const& e) override
+			{
+				auto const& t = e.Get();
+				using std::abs;
+				const ComplexT current_time(t.CurrentTime());
+				const auto step_size = NumErrorT(abs(current_time - previous_time_));
+				const auto fraction = length_ > 0 ? NumErrorT(abs(current_time - start_time_))/length_ : 0;
+				statistics_.RecordStep(fraction, step_size, t.CurrentPrecision());
+				previous_time_ = current_time;
+			}
+
+		public:
+
+			explicit
+			PathStatisticsRecorder(PathStatistics & statistics) : statistics_(statistics)
+			{}
+
+		private:
+
+			PathStatistics & statistics_;
+			ComplexT start_time_;
+			ComplexT previous_time_;
+			NumErrorT length_ = 0;
+		};
+
+	} // namespace algorithm
+} // namespace bertini
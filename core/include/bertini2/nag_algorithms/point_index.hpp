@@ -0,0 +1,161 @@
+//This file is part of Bertini 2.
+//
+//bertini2/nag_algorithms/point_index.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//bertini2/nag_algorithms/point_index.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with bertini2/nag_algorithms/point_index.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+
+/**
+\file bertini2/nag_algorithms/point_index.hpp
+
+\brief Provides an index of points, for finding which of many points are within a tolerance of a given one without comparing against them all.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/common/config.hpp"
+
+namespace bertini{
+	namespace algorithm{
+
+		/**
+		\brief An index of points of equal size, for finding those within a tolerance, in the 2-norm, of a query point.
+
+		Each point is keyed by a fixed real linear function of the real and imaginary parts of its coordinates.  Two points within the tolerance of each other have keys within the tolerance times the norm of the function, so a query compares against only the points whose keys are in that window, found by binary search.  For points spread across space, as the solutions of a system are, the window holds few points.
+
+		\code
+		PointIndex<dbl> index(1e-10);
+		for (unsigned ii = 0; ii < solutions.size(); ++ii)
+			index.Add(solutions[ii], ii);
+		auto near = index.Near(x); // the ids of the solutions within 1e-10 of x
+		\endcode
+		*/
+		template<typename ComplexT>
+		class PointIndex
+		{
+		public:
+
+			using IdT = std::size_t;
+
+			/**
+			\param tolerance Points at a distance less than this are near each other.
+			*/
+			explicit
+			PointIndex(NumErrorT tolerance) : tolerance_(tolerance)
+			{
+				if (!(tolerance > 0))
+					throw std::runtime_error("tolerance for a point index must be positive");
+			}
+
+			/**
+			\brief Add a point to the index, with an id to refer to it by.
+
+			\throws std::runtime_error, if the point is not the size of those already added.
+			*/
+			void Add(Vec<ComplexT> const& point, IdT id)
+			{
+				if (points_.empty())
+					SetDirection(point.size());
+				else if (point.size() != points_.front().size())
+					throw std::runtime_error("adding a point of size " + std::to_string(point.size()) + " to an index of points of size " + std::to_string(points_.front().size()));
+
+				keys_.emplace(Key(point), points_.size());
+				points_.push_back(point);
+				ids_.push_back(id);
+			}
+
+			/**
+			\brief The ids of the points within the tolerance of a given point.  Empty if there are none, or if the given point is not the size of those in the index.
+			*/
+			std::vector<IdT> Near(Vec<ComplexT> const& point) const
+			{
+				std::vector<IdT> near;
+				if (points_.empty() || point.size() != points_.front().size())
+					return near;
+
+				const double key = Key(point);
+				// the keys are computed in double, so widen the window by their rounding too
+				const double window = tolerance_*direction_norm_ + 64*std::numeric_limits<double>::epsilon()*(std::abs(key) + direction_norm_);
+
+				for (auto it = keys_.lower_bound(key - window); it != keys_.end() && it->first <= key + window; ++it)
+					if (static_cast<NumErrorT>((points_[it->second] - point).norm()) < tolerance_)
+						near.push_back(ids_[it->second]);
+				return near;
+			}
+
+			/**
+			\brief Whether any point in the index is within the tolerance of a given point.
+			*/
+			bool Contains(Vec<ComplexT> const& point) const
+			{
+				return !Near(point).empty();
+			}
+
+			std::size_t Size() const
+			{
+				return points_.size();
+			}
+
+		private:
+
+			/**
+			\brief Fix the linear function giving the keys.  Its coefficients are fixed, irrational-looking numbers, so solution sets with structure, like all sharing a coordinate, don't all get the same key.
+			*/
+			void SetDirection(Eigen::Index size)
+			{
+				real_direction_.resize(size);
+				imag_direction_.resize(size);
+				double sum_squares = 0;
+				for (Eigen::Index ii = 0; ii < size; ++ii)
+				{
+					real_direction_[ii] = std::cos(1.6180339887498949*(2*ii+1));
+					imag_direction_[ii] = std::sin(2.7182818284590451*(2*ii+2));
+					sum_squares += real_direction_[ii]*real_direction_[ii] + imag_direction_[ii]*imag_direction_[ii];
+				}
+				direction_norm_ = std::sqrt(sum_squares);
+			}
+
+			double Key(Vec<ComplexT> const& point) const
+			{
+				using std::real; using std::imag;
+				double key = 0;
+				for (Eigen::Index ii = 0; ii < point.size(); ++ii)
+					key += real_direction_[ii]*static_cast<double>(real(point(ii))) + imag_direction_[ii]*static_cast<double>(imag(point(ii)));
+				return key;
+			}
+
+			NumErrorT tolerance_;
+			std::vector<double> real_direction_; ///< coefficients of the real parts of the coordinates, in the keys
+			std::vector<double> imag_direction_; ///< coefficients of the imaginary parts of the coordinates, in the keys
+			double direction_norm_ = 0;
+
+			std::multimap<double, std::size_t> keys_; ///< from key to position in points_
+			std::vector<Vec<ComplexT>> points_;
+			std::vector<IdT> ids_;
+		};
+
+	} // namespace algorithm
+} // namespace bertini
@@ -41,7 +41,19 @@
 #include "bertini2/nag_algorithms/common/algorithm_base.hpp"
 #include "bertini2/nag_algorithms/common/config.hpp"
 #include "bertini2/nag_algorithms/common/policies.hpp"
+#include "bertini2/nag_algorithms/checkpoint.hpp"
+#include "bertini2/nag_algorithms/path_statistics.hpp"
+#include "bertini2/nag_algorithms/point_index.hpp"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 
 namespace bertini {
@@ -74,7 +86,11 @@ struct AlgoTraits <ZeroDim<TrackerType, EndgameType, SystemType, StartSystemType
 								TolerancesConfig,
 								PostProcessingConfig,
 								ZeroDimConfig<BaseComplexType>,
-								AutoRetrackConfig
+								AutoRetrackConfig,
+								CheckpointConfig,
+								WarmStartConfig,
+								GammaRetrackConfig,
+								PathSchedulingConfig
 								>;
 };
 
@@ -124,6 +140,10 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			using PostProcessing = PostProcessingConfig;
 			using ZeroDimConf = ZeroDimConfig<BaseComplexType>;
 			using AutoRetrack = AutoRetrackConfig;
+			using Checkpoint = CheckpointConfig;
+			using WarmStart = WarmStartConfig;
+			using GammaRetrack = GammaRetrackConfig;
+			using Scheduling = PathSchedulingConfig;
 
 /// metadata structs
 
@@ -179,6 +199,8 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				bool is_real;       		// real flag:  0 - not real, 1 - real
 				bool is_finite;     		// finite flag: -1 - no finite/infinite distinction, 0 - infinite, 1 - finite
 				bool is_singular;       		// singular flag: 0 - non-sigular, 1 - singular
+
+				bool retracked = false; 	// whether the solution came from retracking the path on a homotopy with a fresh gamma
 			};
 
 
@@ -197,11 +219,52 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			};
 
 
+			/**
+			\brief The work done tracking a path, or, summed, a whole solve.
+
+			Gathered from the per-thread tracking::TrackingCounters, so always available, without attaching any observers.  The three wall times partition the time spent tracking the path.
+			*/
+			struct PathProfile
+			{
+				tracking::TrackingCounters counters; ///< counts of steps, Newton iterations, evaluations, and factorizations, and the time at each precision, over all phases
+				double pre_endgame_seconds = 0; ///< wall time tracking to the endgame boundary, including re-tracking crossed paths
+				double endgame_seconds = 0; ///< wall time in the endgame, not counting refinement
+				double refinement_seconds = 0; ///< wall time refining during the endgame
+
+				PathProfile& operator+=(PathProfile const& other)
+				{
+					counters += other.counters;
+					pre_endgame_seconds += other.pre_endgame_seconds;
+					endgame_seconds += other.endgame_seconds;
+					refinement_seconds += other.refinement_seconds;
+					return *this;
+				}
+			};
+
+
+
+			/**
+			\brief What retracking failed and crossed paths on fresh homotopies did.  See GammaRetrackConfig.
+			*/
+			struct GammaRetrackMetaData
+			{
+				unsigned num_homotopies = 0; ///< how many homotopies with a fresh gamma were formed
+				std::vector<SolnIndT> attempted; ///< the paths which failed or crossed, so were retracked
+				std::vector<SolnIndT> recovered; ///< the paths which made it through the endgame on a fresh homotopy
+				std::vector<SolnIndT> new_solutions; ///< of the recovered paths, those which ended at a point no other path did
+				std::vector<SolnIndT> duplicates; ///< of the recovered paths, those which ended at a point another path did
+			};
+
 
 // a few more using statements
 
 			using MidpathType = MidpathChecker<BaseRealType, BaseComplexType, EGBoundaryMetaData>;
 
+			/**
+			\brief Called with the index, solution, and metadata of each path as it comes through the endgame.  See SetSolutionCallback.
+			*/
+			using SolutionCallback = std::function<void(SolnIndT, Vec<BaseComplexType> const&, SolutionMetaData const&)>;
+
 			using SystemManagementPolicy::TargetSystem;
 			using SystemManagementPolicy::StartSystem;
 			using SystemManagementPolicy::Homotopy;
@@ -221,6 +284,8 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			ZeroDim(SysTs const& ...sys) : SystemManagementPolicy(sys...), tracker_(TargetSystem()), endgame_(tracker_)
 			{
 				ConsistencyCheck();
+				// before the target is prepared, which patches it randomly
+				source_key_ = HomotopyCache::Key(TargetSystem(), boost::typeindex::type_id<StartSystemType>().pretty_name());
 				DefaultSetup();
 			}
 
@@ -287,6 +352,10 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				this->template Set<PostProcessing>(PostProcessing());
 				this->template Set<ZeroDimConf>(ZeroDimConf());
 				this->template Set<AutoRetrack>(AutoRetrack());
+				this->template Set<Checkpoint>(Checkpoint());
+				this->template Set<WarmStart>(WarmStart());
+				this->template Set<GammaRetrack>(GammaRetrack());
+				this->template Set<Scheduling>(Scheduling());
 			}
 
 			void SetMidpathRetrackTol(NumErrorT const& rt)
@@ -420,12 +489,14 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			/**
 			\brief Perform the basic Zero Dim solve algorithm.
 
-			This function iterates over all start points to the start system, tracking from each to the endgame boundary.  At the endgame boundary, path crossings are checked for.  Multiple paths which jump onto each other will not be detected, unless you are using a certified tracker, in which case this is prevented in the first place.
+			This function iterates over all start points to the start system, tracking from each to the endgame boundary.  If enabled in the PathSchedulingConfig, the paths are instead tracked cheapest first, each through the endgame before the next.  At the endgame boundary, path crossings are checked for.  Multiple paths which jump onto each other will not be detected, unless you are using a certified tracker, in which case this is prevented in the first place.
 
 			Paths which have crossed are re-run, up to a certain number of times.
 
 			Then, the points at the endgame boundary are tracked using the prescribed endgame toward the final time.
 
+			If enabled in the GammaRetrackConfig, paths which failed or still cross are then retracked on homotopies with a fresh random gamma.
+
 			Finally, results are post-processed.
 
 			It is up to you to put the output somewhere.
@@ -436,12 +507,21 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 
 				PreSolveSetup();
 
-				TrackBeforeEG();
+				if (this->template Get<Scheduling>().enabled)
+					TrackScheduled();
+				else
+					TrackBeforeEG();
 
 				EGBoundaryAction();
 
 				TrackDuringEG();
 
+				if (this->template Get<GammaRetrack>().enabled)
+					RetrackFailedPaths();
+
+				if (checkpoint_)
+					checkpoint_->Sync();
+
 				PostEGAction();
 			}
 
@@ -472,6 +552,50 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				return solutions_at_endgame_boundary_;
 			}
 
+			/**
+			\brief Get the profile of the work done on each path.  Paths read from a checkpoint log have empty profiles.
+			*/
+			const auto& PathProfiles() const
+			{
+				return path_profiles_;
+			}
+
+			/**
+			\brief Get the profile of the work done on all paths, summed at the end of Solve.
+			*/
+			PathProfile const& Profile() const
+			{
+				return total_profile_;
+			}
+
+			/**
+			\brief Get the step size and precision profile learned from the paths tracked to the endgame boundary.  Empty unless warm starting is enabled in the WarmStartConfig.
+			*/
+			PathStatistics const& PathStatisticsModel() const
+			{
+				return path_statistics_;
+			}
+
+			/**
+			\brief Set a function to be called with each solution as it comes out of the endgame, to use or write results before the solve is done.
+
+			The callback is called from the thread calling Solve.  Multiplicities are not known until the end of the solve.  A path tracked again, after crossing another path or by retracking on a fresh homotopy, is passed again, and the later call supersedes the earlier.  Pass an empty function to stop.
+
+			\see output::Classic::Streamer
+			*/
+			void SetSolutionCallback(SolutionCallback callback)
+			{
+				solution_callback_ = std::move(callback);
+			}
+
+			/**
+			\brief Get what retracking failed and crossed paths did.  Empty unless retracking is enabled in the GammaRetrackConfig.
+			*/
+			GammaRetrackMetaData const& GammaRetrackResults() const
+			{
+				return gamma_retrack_results_;
+			}
+
 		private:
 
 			/**
@@ -488,11 +612,235 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			{
 				auto num_as_size_t = static_cast<SolnIndT>(num_start_points_);
 
-				solution_final_metadata_.resize(num_as_size_t);
+				solution_final_metadata_.assign(num_as_size_t, SolutionMetaData()); // fresh, as the precisions recorded for a path are merged into it
 				solutions_at_endgame_boundary_.resize(num_as_size_t);
 				solutions_post_endgame_.resize(num_as_size_t);
+				path_profiles_.assign(num_as_size_t, PathProfile());
 
 				SetMidpathRetrackTol(this->template Get<Tolerances>().newton_before_endgame);
+
+				path_statistics_ = PathStatistics(this->template Get<WarmStart>().num_bins);
+				gamma_retrack_results_ = GammaRetrackMetaData();
+
+				CheckpointSetup();
+			}
+
+
+			/**
+			\brief Open the checkpoint log, if requested, and ingest any paths already recorded in it.
+
+			Paths found in the log are marked as done, so that they are skipped when tracking.  The log's header holds the target system, start system, and homotopy it was written for, with their random gamma and coefficients.  If they differ from the ones set up for this run, they are restored from the log, so the recorded paths continue on the same homotopy.
+
+			\throws std::runtime_error, if the log was written for a different system, or if its homotopy differs and can't be restored because the systems were given by reference.
+			*/
+			void CheckpointSetup()
+			{
+				auto num_as_size_t = static_cast<SolnIndT>(num_start_points_);
+				done_before_eg_.assign(num_as_size_t, false);
+				done_during_eg_.assign(num_as_size_t, false);
+
+				const auto& conf = this->template Get<Checkpoint>();
+				if (!conf.enabled)
+				{
+					checkpoint_.reset();
+					return;
+				}
+
+				const auto identity = CheckpointIdentity();
+				checkpoint_ = std::make_shared<CheckpointLog>(conf.filename, binary::NumberTypeTag<BaseComplexType>::value, conf.sync_batch_size, conf.resume, identity);
+
+				if (checkpoint_->Identity() != identity)
+					RestoreSystemsFrom(checkpoint_->Identity());
+
+				checkpoint_->Replay([this](CheckpointRecord const& r){ IngestCheckpointRecord(r); });
+			}
+
+
+			/**
+			\brief The identity written into the header of the checkpoint log: the key of the system as given, and the serialized target system, start system, and homotopy.
+			*/
+			std::string CheckpointIdentity() const
+			{
+				std::stringstream systems(std::ios::in | std::ios::out | std::ios::binary);
+				{
+					boost::archive::binary_oarchive oa(systems);
+					oa << TargetSystem() << StartSystem() << Homotopy();
+				}
+
+				binary::Buffer buf;
+				binary::Write(buf, source_key_);
+				binary::Write(buf, systems.str());
+				return std::string(buf.begin(), buf.end());
+			}
+
+
+			/**
+			\brief Replace the target system, start system, and homotopy with the ones in the identity of a checkpoint log.
+			*/
+			void RestoreSystemsFrom(std::string const& identity)
+			{
+				binary::Reader in(identity.data(), identity.data()+identity.size());
+				std::string logged_key, systems;
+				binary::Read(in, logged_key);
+				binary::Read(in, systems);
+
+				if (source_key_.empty() || logged_key != source_key_)
+					throw std::runtime_error("checkpoint log '" + this->template Get<Checkpoint>().filename + "' was written for a different system");
+
+				RestoreSystems(systems, std::integral_constant<bool, std::is_same<StoredSystemT, SystemType>::value>());
+
+				if (StartSystem().NumStartPoints() != num_start_points_)
+					throw std::runtime_error("start system restored from checkpoint log has a different number of start points");
+			}
+
+			/**
+			\brief Deserialize systems from a checkpoint log into the stored copies.
+			*/
+			void RestoreSystems(std::string const& systems, std::true_type)
+			{
+				std::stringstream ss(systems, std::ios::in | std::ios::binary);
+				SystemType target, homotopy;
+				StartSystemType start;
+				{
+					boost::archive::binary_iarchive ia(ss);
+					ia >> target >> start >> homotopy;
+				}
+				// moved, not copied, so the nodes shared between them stay shared.  the tracker refers to the stored homotopy, so sees the restored one.
+				TargetSystem() = std::move(target);
+				StartSystem() = std::move(start);
+				Homotopy() = std::move(homotopy);
+			}
+
+			/**
+			\brief Systems given by reference belong to the caller, so can't be replaced.
+			*/
+			void RestoreSystems(std::string const&, std::false_type)
+			{
+				throw std::runtime_error("checkpoint log '" + this->template Get<Checkpoint>().filename + "' was written with a different homotopy, which can't be restored into systems given by reference");
+			}
+
+
+			/**
+			\brief Populate the computed data for a path from a record in the checkpoint log.
+			*/
+			void IngestCheckpointRecord(CheckpointRecord const& r)
+			{
+				if (r.path_index >= num_start_points_)
+					throw std::runtime_error("checkpoint log contains path index " + std::to_string(r.path_index) + ", but there are only " + std::to_string(num_start_points_) + " start points.  was it written for a different system?");
+
+				auto soln_ind = static_cast<SolnIndT>(r.path_index);
+				binary::Reader in(r.payload, r.payload + r.payload_size);
+
+				switch (r.kind)
+				{
+					case CheckpointRecordKind::EndgameBoundary:
+					{
+						auto& bdry = solutions_at_endgame_boundary_[soln_ind];
+						binary::Read(in, bdry.path_point);
+						binary::Read(in, bdry.success_code);
+						binary::Read(in, bdry.last_used_stepsize);
+						Read(in, solution_final_metadata_[soln_ind]);
+
+						done_before_eg_[soln_ind] = true;
+						done_during_eg_[soln_ind] = false; // a retracked path must go through the endgame again
+						break;
+					}
+					case CheckpointRecordKind::PostEndgame:
+					{
+						binary::Read(in, solutions_post_endgame_[soln_ind]);
+						Read(in, solution_final_metadata_[soln_ind]);
+
+						done_during_eg_[soln_ind] = true;
+						break;
+					}
+					default:
+						throw std::runtime_error("unknown record kind in checkpoint log");
+				}
+			}
+
+
+			void CheckpointBeforeEG(SolnIndT soln_ind)
+			{
+				done_before_eg_[soln_ind] = true;
+				done_during_eg_[soln_ind] = false;
+
+				if (!checkpoint_)
+					return;
+
+				const auto& bdry = solutions_at_endgame_boundary_[soln_ind];
+				binary::Buffer payload;
+				binary::Write(payload, bdry.path_point);
+				binary::Write(payload, bdry.success_code);
+				binary::Write(payload, bdry.last_used_stepsize);
+				Write(payload, solution_final_metadata_[soln_ind]);
+
+				checkpoint_->Append(CheckpointRecordKind::EndgameBoundary, soln_ind, payload);
+			}
+
+
+			void CheckpointDuringEG(SolnIndT soln_ind)
+			{
+				done_during_eg_[soln_ind] = true;
+
+				if (!checkpoint_)
+					return;
+
+				binary::Buffer payload;
+				binary::Write(payload, solutions_post_endgame_[soln_ind]);
+				Write(payload, solution_final_metadata_[soln_ind]);
+
+				checkpoint_->Append(CheckpointRecordKind::PostEndgame, soln_ind, payload);
+			}
+
+
+			static
+			void Write(binary::Buffer & buf, SolutionMetaData const& smd)
+			{
+				using binary::Write;
+				Write(buf, static_cast<std::uint64_t>(smd.path_index));
+				Write(buf, static_cast<std::uint64_t>(smd.solution_index));
+				Write(buf, smd.precision_changed);
+				Write(buf, smd.time_of_first_prec_increase);
+				Write(buf, static_cast<std::uint64_t>(smd.max_precision_used));
+				Write(buf, smd.pre_endgame_success);
+				Write(buf, smd.condition_number);
+				Write(buf, smd.newton_residual);
+				Write(buf, smd.final_time_used);
+				Write(buf, smd.accuracy_estimate);
+				Write(buf, smd.accuracy_estimate_user_coords);
+				Write(buf, smd.cycle_num);
+				Write(buf, smd.endgame_success);
+				Write(buf, smd.function_residual);
+				Write(buf, smd.multiplicity);
+				Write(buf, smd.is_real);
+				Write(buf, smd.is_finite);
+				Write(buf, smd.is_singular);
+			}
+
+
+			static
+			void Read(binary::Reader & in, SolutionMetaData & smd)
+			{
+				using binary::Read;
+				std::uint64_t tmp;
+				Read(in, tmp); smd.path_index = static_cast<SolnIndT>(tmp);
+				Read(in, tmp); smd.solution_index = static_cast<SolnIndT>(tmp);
+				Read(in, smd.precision_changed);
+				Read(in, smd.time_of_first_prec_increase);
+				Read(in, tmp); smd.max_precision_used = static_cast<decltype(smd.max_precision_used)>(tmp);
+				Read(in, smd.pre_endgame_success);
+				Read(in, smd.condition_number);
+				Read(in, smd.newton_residual);
+				Read(in, smd.final_time_used);
+				Read(in, smd.accuracy_estimate);
+				Read(in, smd.accuracy_estimate_user_coords);
+				Read(in, smd.cycle_num);
+				Read(in, smd.endgame_success);
+				Read(in, smd.function_residual);
+				Read(in, smd.multiplicity);
+				Read(in, smd.is_real);
+				Read(in, smd.is_finite);
+				Read(in, smd.is_singular);
 			}
 
 			/**
@@ -501,6 +849,8 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			Results are accumulated into an internally stored variable, solutions_at_endgame_boundary_.
 
 			The point at the endgame boundary, as well as the success flag, and the stepsize, are all stored.
+
+			If warm starting is enabled, the paths are recorded into the path statistics, and once enough have been, each further path starts with the step size and precision they suggest.
 			*/
 			void TrackBeforeEG()
 			{
@@ -511,9 +861,23 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				auto t_start = this->template Get<ZeroDimConf>().start_time;
 				auto t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
 
+				const bool warm_start = this->template Get<WarmStart>().enabled;
+				PathStatisticsRecorder<TrackerType> recorder(path_statistics_);
+				if (warm_start)
+					GetTracker().AddObserver(&recorder);
+
 				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
 				{
-					TrackSinglePathBeforeEG(static_cast<SolnIndT>(ii));
+					if (done_before_eg_[static_cast<SolnIndT>(ii)])
+						continue;
+
+					TrackSinglePathBeforeEG(static_cast<SolnIndT>(ii), warm_start);
+				}
+
+				if (warm_start)
+				{
+					GetTracker().RemoveObserver(&recorder);
+					GetTracker().ReinitializeInitialStepSize(true);
 				}
 			}
 
@@ -521,8 +885,11 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 
 			/**
 			 /brief Track a single path before we reach the endgame boundary.
+
+			 \param soln_ind The index of the start point to track from.
+			 \param warm_start Whether to start from, and record into, the path statistics.  Retracks of crossed paths don't, as they are the paths which behaved unlike the others.
 			*/
-			void TrackSinglePathBeforeEG(SolnIndT soln_ind)
+			void TrackSinglePathBeforeEG(SolnIndT soln_ind, bool warm_start = false)
 			{
 					// if you can think of a way to replace this `if` with something meta, please do so.
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
@@ -536,16 +903,42 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 					smd.path_index = soln_ind;
 					smd.solution_index = soln_ind;
 
-				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
+				const auto& warm_start_conf = this->template Get<WarmStart>();
+				const bool seeded = warm_start && path_statistics_.NumPaths() >= warm_start_conf.min_num_paths;
+
+				unsigned initial_precision = this->template Get<ZeroDimConf>().initial_ambient_precision;
+				if (seeded && tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
+					initial_precision = std::max(initial_precision, path_statistics_.InitialPrecision(warm_start_conf.precision_quorum));
+
+				DefaultPrecision(initial_precision);
 				auto t_start = this->template Get<ZeroDimConf>().start_time;
 				auto t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
 				auto start_point = StartSystem().template StartPoint<BaseComplexType>(soln_ind);
 
+				if (seeded)
+					GetTracker().SetStepSize(BaseRealType(path_statistics_.InitialStepSize(warm_start_conf.step_size_quantile)));
+				if (warm_start)
+					GetTracker().ReinitializeInitialStepSize(!seeded);
+
+				tracking::ThisThreadPathIndex() = soln_ind;
+				auto& counters = tracking::ThisThreadCounters();
+				const auto counters_before = counters;
+				const auto clock_start = tracking::TrackingCounters::Clock::now();
+				counters.StartPrecisionClock(DefaultPrecision());
+
 				Vec<BaseComplexType> result;
 				auto tracking_success = GetTracker().TrackPath(result, t_start, t_endgame_boundary, start_point);
 
+				counters.StopPrecisionClock();
+				auto& profile = path_profiles_[soln_ind];
+				profile.counters += counters - counters_before;
+				profile.pre_endgame_seconds += std::chrono::duration<double>(tracking::TrackingCounters::Clock::now() - clock_start).count();
+
 				solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaData({ result, tracking_success, GetTracker().CurrentStepsize() });
 
+				if (warm_start)
+					path_statistics_.EndPath(tracking_success==SuccessCode::Success);
+
 					smd.pre_endgame_success = tracking_success;
 
 					// if you can think of a way to replace this `if` with something meta, please do so.
@@ -564,9 +957,340 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 							max(smd.max_precision_used, min_max_prec_.MaxPrecision());
 					}
 
+				CheckpointBeforeEG(soln_ind);
+			}
+
+			/**
+			\brief A tracker and endgame, with their own copy of a homotopy, for tracking paths on a thread of their own.
+
+			Not movable, since the tracker refers to the homotopy, and the endgame to the tracker.
+			*/
+			struct PathWorker
+			{
+				PathWorker(SystemType const& h, EndgameType const& eg) : homotopy(Clone(h)), tracker(homotopy), endgame(eg)
+				{
+					endgame.SetTracker(tracker);
+				}
+
+				PathWorker(PathWorker const&) = delete;
+				PathWorker& operator=(PathWorker const&) = delete;
+
+				SystemType homotopy;
+				TrackerType tracker;
+				EndgameType endgame;
+
+				tracking::FirstPrecisionRecorder<TrackerType> first_prec_rec; ///< the worker's own, since observers are notified on the tracking thread
+				tracking::MinMaxPrecisionRecorder<TrackerType> min_max_prec;
+			};
+
+			/**
+			\brief Where to pick a path up from: a point some fraction of the way from the start time to the endgame boundary, and the step size to go on with.  At fraction 0, the point is the start point, and the path starts afresh.
+			*/
+			struct PathProbe
+			{
+				double fraction = 0;
+				Vec<BaseComplexType> point;
+				BaseRealType stepsize;
+				NumErrorT cost = 0; ///< the estimated number of steps the rest of the way to the endgame boundary
+			};
+
+			/**
+			\brief The result of tracking one path on a worker, kept apart from the results of the solve until the main thread stores it.
+			*/
+			struct PathResult
+			{
+				EGBoundaryMetaData boundary;
+				Vec<BaseComplexType> solution;
+				Vec<BaseComplexType> previous_approximation;
+				SolutionMetaData metadata;
+				PathProfile profile;
+			};
+
+
+			/**
+			\brief Attach the observers recording the precisions used by a path to the tracker of this object, if it is adaptive.
+			*/
+			void AttachPrecisionRecorders(SolutionMetaData const& smd)
+			{
+				AttachPrecisionRecorders(GetTracker(), first_prec_rec_, min_max_prec_, smd);
+			}
+
+			/**
+			\brief Detach the observers attached by AttachPrecisionRecorders, folding what they recorded into the metadata of the path.
+			*/
+			void DetachPrecisionRecorders(SolutionMetaData & smd)
+			{
+				DetachPrecisionRecorders(GetTracker(), first_prec_rec_, min_max_prec_, smd);
+			}
+
+			/**
+			\brief Attach precision recorders to a tracker, if it is adaptive.  The recorder of the first precision increase is attached only if the path hasn't already increased precision.
+			*/
+			static
+			void AttachPrecisionRecorders(TrackerType & tracker, tracking::FirstPrecisionRecorder<TrackerType> & first_prec_rec, tracking::MinMaxPrecisionRecorder<TrackerType> & min_max_prec, SolutionMetaData const& smd)
+			{
+				// if you can think of a way to replace this `if` with something meta, please do so.
+				if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
+				{
+					if (!smd.precision_changed)
+						tracker.AddObserver(&first_prec_rec);
+					tracker.AddObserver(&min_max_prec);
+				}
+			}
+
+			/**
+			\brief Detach precision recorders from a tracker, folding what they recorded into the metadata of the path.
+			*/
+			static
+			void DetachPrecisionRecorders(TrackerType & tracker, tracking::FirstPrecisionRecorder<TrackerType> & first_prec_rec, tracking::MinMaxPrecisionRecorder<TrackerType> & min_max_prec, SolutionMetaData & smd)
+			{
+				// if you can think of a way to replace this `if` with something meta, please do so.
+				if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
+				{
+					if (!smd.precision_changed)
+					{
+						if (first_prec_rec.DidPrecisionIncrease())
+						{
+							smd.precision_changed = true;
+							smd.time_of_first_prec_increase = first_prec_rec.TimeOfIncrease();
+						}
+					}
+					tracker.RemoveObserver(&first_prec_rec);
+					tracker.RemoveObserver(&min_max_prec);
+					using std::max;
+					smd.max_precision_used =
+						max(smd.max_precision_used, min_max_prec.MaxPrecision());
+				}
+			}
+
+
+			/**
+			\brief Pass a path's solution to the solution callback, if there is one.
+			*/
+			void StreamSolution(SolnIndT soln_ind) const
+			{
+				if (solution_callback_)
+					solution_callback_(soln_ind, solutions_post_endgame_[soln_ind], solution_final_metadata_[soln_ind]);
+			}
+
+
+			/**
+			\brief Track the paths cheapest first, each through the endgame before the next, so that solutions come out early, and stream out.
+
+			Each path is first probed a short way, to estimate its cost; see ProbeSinglePath.  The paths are then picked up from their probes, in order of increasing cost.  If there are dedicated workers, the most expensive paths are given to them, most expensive first, and tracked on their own threads alongside the cheap ones, so the slowest paths start early and don't hold up the end of the solve.  Their results are stored, and streamed, by the thread calling Solve, between cheap paths.
+
+			Observers attached to the tracker of this object don't see the paths tracked by dedicated workers.  The check for crossed paths needs every path at the endgame boundary, so comes after; paths retracked then go through the endgame again, and are streamed again.
+			*/
+			void TrackScheduled()
+			{
+				const auto& conf = this->template Get<Scheduling>();
+
+				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_before_endgame);
+
+				std::vector<PathProbe> probes(num_start_points_);
+				std::vector<SolnIndT> order;
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+				{
+					auto soln_ind = static_cast<SolnIndT>(ii);
+					if (done_before_eg_[soln_ind])
+						continue;
+
+					if (ProbeSinglePath(soln_ind, probes[soln_ind]))
+						order.push_back(soln_ind);
+				}
+
+				std::stable_sort(order.begin(), order.end(), [&probes](SolnIndT a, SolnIndT b){ return probes[a].cost < probes[b].cost; });
+
+				std::size_t num_dedicated = 0;
+				if (conf.num_dedicated_workers > 0)
+					num_dedicated = std::min(order.size(), static_cast<std::size_t>(std::ceil(std::max(conf.dedicated_fraction, 0.)*order.size())));
+
+				const std::vector<SolnIndT> dedicated(order.rbegin(), order.rbegin() + num_dedicated);
+				order.resize(order.size() - num_dedicated);
+
+				const auto num_threads = std::min<std::size_t>(conf.num_dedicated_workers, num_dedicated);
+				auto workers = MakeWorkers(Homotopy(), num_threads);
+
+				std::vector<PathResult> results(num_dedicated);
+				std::atomic<std::size_t> next{0};
+				std::vector<std::exception_ptr> errors(num_threads);
+				std::mutex finished_mutex;
+				std::vector<std::size_t> finished; // positions in dedicated of the paths whose results are ready to store
+
+				auto work = [&](std::size_t worker_index)
+				{
+					try
+					{
+						auto& w = *workers[worker_index];
+						for (auto ii = next++; ii < num_dedicated; ii = next++)
+						{
+							TrackSinglePathOnWorker(w, dedicated[ii], probes[dedicated[ii]], results[ii]);
+							std::lock_guard<std::mutex> lock(finished_mutex);
+							finished.push_back(ii);
+						}
+					}
+					catch (...)
+					{
+						errors[worker_index] = std::current_exception();
+					}
+				};
+
+				auto store_finished = [&]()
+				{
+					std::vector<std::size_t> ready;
+					{
+						std::lock_guard<std::mutex> lock(finished_mutex);
+						ready.swap(finished);
+					}
+					for (auto ii : ready)
+						StoreDedicated(dedicated[ii], results[ii]);
+				};
+
+				std::vector<std::thread> threads;
+				for (std::size_t ii{0}; ii < num_threads; ++ii)
+					threads.emplace_back(work, ii);
+
+				try
+				{
+					for (auto soln_ind : order)
+					{
+						TrackScheduledPath(soln_ind, probes[soln_ind]);
+						store_finished();
+					}
+				}
+				catch (...)
+				{
+					next = num_dedicated; // so the workers stop after their current paths
+					for (auto& t : threads)
+						t.join();
+					throw;
+				}
+
+				for (auto& t : threads)
+					t.join();
+
+				for (auto const& e : errors)
+					if (e)
+						std::rethrow_exception(e);
 
+				store_finished();
 			}
 
+
+			/**
+			\brief Track a path a short way from its start point, to estimate the work to track the rest of it.
+
+			The estimate is the number of steps the rest of the way to the endgame boundary would take at the step size the probe ended with, times the number of digits lost to the condition number there.  Paths which start with small steps, or badly conditioned, are the expensive ones.
+
+			\return Whether the probe succeeded.  If not, the path is recorded as failed before the endgame.
+			*/
+			bool ProbeSinglePath(SolnIndT soln_ind, PathProbe & probe)
+			{
+				auto& smd = solution_final_metadata_[soln_ind];
+				smd.path_index = soln_ind;
+				smd.solution_index = soln_ind;
+
+				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
+				auto start_point = StartSystem().template StartPoint<BaseComplexType>(soln_ind);
+
+				probe.fraction = std::min(std::max(this->template Get<Scheduling>().probe_fraction, 0.), 1.);
+
+				GetTracker().ReinitializeInitialStepSize(true);
+				Vec<BaseComplexType> result;
+				auto tracking_success = TrackSegmentBeforeEG(soln_ind, 0, probe.fraction, start_point, result);
+
+				if (tracking_success != SuccessCode::Success)
+				{
+					solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaData({ result, tracking_success, GetTracker().CurrentStepsize() });
+					smd.pre_endgame_success = tracking_success;
+					CheckpointBeforeEG(soln_ind);
+					return false;
+				}
+
+				probe.point = result;
+				probe.stepsize = GetTracker().CurrentStepsize();
+
+				using std::abs; using std::log10; using std::max;
+				const auto remaining = static_cast<NumErrorT>(abs(PreEndgameTime(1) - PreEndgameTime(probe.fraction)));
+				probe.cost = remaining / static_cast<NumErrorT>(probe.stepsize) * max(NumErrorT(1), log10(GetTracker().LatestConditionNumber()));
+				return true;
+			}
+
+
+			/**
+			\brief Pick a path up from its probe, and track it to the endgame boundary, then through the endgame.
+			*/
+			void TrackScheduledPath(SolnIndT soln_ind, PathProbe const& probe)
+			{
+				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_before_endgame);
+				GetTracker().SetStepSize(probe.stepsize);
+				GetTracker().ReinitializeInitialStepSize(false);
+
+				Vec<BaseComplexType> result;
+				auto tracking_success = TrackSegmentBeforeEG(soln_ind, probe.fraction, 1, probe.point, result);
+
+				solutions_at_endgame_boundary_[soln_ind] = EGBoundaryMetaData({ result, tracking_success, GetTracker().CurrentStepsize() });
+				solution_final_metadata_[soln_ind].pre_endgame_success = tracking_success;
+				CheckpointBeforeEG(soln_ind);
+
+				if (tracking_success != SuccessCode::Success)
+					return;
+
+				GetTracker().SetTrackingTolerance(this->template Get<Tolerances>().newton_during_endgame);
+				TrackSinglePathDuringEG(soln_ind);
+				CheckpointDuringEG(soln_ind);
+				StreamSolution(soln_ind);
+			}
+
+
+			/**
+			\brief Track a path with the tracker of this object, between two fractions of the way from the start time to the endgame boundary, adding the work to its profile.
+			*/
+			SuccessCode TrackSegmentBeforeEG(SolnIndT soln_ind, double from_fraction, double to_fraction, Vec<BaseComplexType> const& from_point, Vec<BaseComplexType> & result)
+			{
+				auto& smd = solution_final_metadata_[soln_ind];
+				AttachPrecisionRecorders(smd);
+
+				DefaultPrecision(Precision(from_point));
+				BaseComplexType t_from = PreEndgameTime(from_fraction);
+				BaseComplexType t_to = PreEndgameTime(to_fraction);
+
+				tracking::ThisThreadPathIndex() = soln_ind;
+				auto& counters = tracking::ThisThreadCounters();
+				const auto counters_before = counters;
+				const auto clock_start = tracking::TrackingCounters::Clock::now();
+				counters.StartPrecisionClock(DefaultPrecision());
+
+				auto tracking_success = GetTracker().TrackPath(result, t_from, t_to, from_point);
+
+				counters.StopPrecisionClock();
+				auto& profile = path_profiles_[soln_ind];
+				profile.counters += counters - counters_before;
+				profile.pre_endgame_seconds += std::chrono::duration<double>(tracking::TrackingCounters::Clock::now() - clock_start).count();
+
+				DetachPrecisionRecorders(smd);
+				return tracking_success;
+			}
+
+
+			/**
+			\brief Store the result of a path tracked by a dedicated worker, as the path would have been stored had it been tracked by the tracker of this object, and stream it.
+			*/
+			void StoreDedicated(SolnIndT soln_ind, PathResult const& r)
+			{
+				solutions_at_endgame_boundary_[soln_ind] = r.boundary;
+				StoreWorkerResult(soln_ind, r);
+				CheckpointBeforeEG(soln_ind);
+
+				if (r.metadata.pre_endgame_success != SuccessCode::Success)
+					return;
+
+				CheckpointDuringEG(soln_ind);
+				StreamSolution(soln_ind);
+			}
+
+
+
 			void EGBoundaryAction()
 			{
 				auto midcheckpassed = midpath_.Check(solutions_at_endgame_boundary_, StartSystem());
@@ -618,7 +1342,12 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 					if (solution_final_metadata_[soln_ind].pre_endgame_success != SuccessCode::Success)
 						continue;
 
+					if (done_during_eg_[soln_ind])
+						continue;
+
 					TrackSinglePathDuringEG(soln_ind);
+					CheckpointDuringEG(soln_ind);
+					StreamSolution(soln_ind);
 				}
 			}
 
@@ -627,13 +1356,7 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			{
 
 					auto& smd = solution_final_metadata_[soln_ind];
-					// if you can think of a way to replace this `if` with something meta, please do so.
-					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
-					{
-						if (!smd.precision_changed)
-							GetTracker().AddObserver(&first_prec_rec_);
-						GetTracker().AddObserver(&min_max_prec_);
-					}
+					AttachPrecisionRecorders(smd);
 
 				const auto& bdry_point = solutions_at_endgame_boundary_[soln_ind].path_point;
 
@@ -646,30 +1369,27 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 				BaseComplexType t_end = this->template Get<ZeroDimConf>().target_time;
 				BaseComplexType t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
 
+				tracking::ThisThreadPathIndex() = soln_ind;
+				auto& counters = tracking::ThisThreadCounters();
+				const auto counters_before = counters;
+				const auto clock_start = tracking::TrackingCounters::Clock::now();
+				counters.StartPrecisionClock(Precision(bdry_point));
+
 				auto eg_success = GetEndgame().Run(t_endgame_boundary, bdry_point, t_end);
 
+				counters.StopPrecisionClock();
+				const auto used = counters - counters_before;
+				auto& profile = path_profiles_[soln_ind];
+				profile.counters += used;
+				profile.refinement_seconds += used.refinement_seconds;
+				profile.endgame_seconds += std::chrono::duration<double>(tracking::TrackingCounters::Clock::now() - clock_start).count() - used.refinement_seconds;
+
 				solutions_post_endgame_[soln_ind] = GetEndgame().template FinalApproximation<BaseComplexType>();
 
 
 					// finally, store the metadata as necessary
 					smd.endgame_success = eg_success;
-						// if you can think of a way to replace this `if` with something meta, please do so.
-					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
-					{
-						if (!smd.precision_changed)
-						{
-							if (first_prec_rec_.DidPrecisionIncrease())
-							{
-								smd.precision_changed = true;
-								smd.time_of_first_prec_increase = first_prec_rec_.TimeOfIncrease();
-							}
-						}
-						GetTracker().RemoveObserver(&first_prec_rec_);
-						GetTracker().RemoveObserver(&min_max_prec_);
-						using std::max;
-						smd.max_precision_used =
-							max(smd.max_precision_used, min_max_prec_.MaxPrecision());
-					}
+					DetachPrecisionRecorders(smd);
 					if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
 						assert(Precision(solutions_post_endgame_[soln_ind])==Precision(GetEndgame().template FinalApproximation<BaseComplexType>()));
@@ -691,9 +1411,358 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 
 
 
+			/**
+			\brief The number of threads to use for a number of paths.  0 configured threads means one per hardware thread.
+			*/
+			static
+			std::size_t NumThreads(unsigned configured, std::size_t num_paths)
+			{
+				auto num_threads = static_cast<std::size_t>(configured);
+				if (num_threads==0)
+					num_threads = std::max(1u, std::thread::hardware_concurrency());
+				return std::min(num_threads, num_paths);
+			}
+
+
+			/**
+			\brief Make workers tracking on copies of a homotopy, set up like the tracker and endgame of this object.
+			*/
+			std::vector<std::unique_ptr<PathWorker>> MakeWorkers(SystemType const& homotopy, std::size_t num_workers) const
+			{
+				std::vector<std::unique_ptr<PathWorker>> workers;
+				for (std::size_t ii{0}; ii < num_workers; ++ii)
+				{
+					workers.push_back(std::make_unique<PathWorker>(homotopy, GetEndgame()));
+					workers.back()->tracker.SetupLike(GetTracker());
+					workers.back()->endgame.configuration_ = GetEndgame().configuration_;
+				}
+				return workers;
+			}
+
+
+			/**
+			\brief The time a fraction of the way from the start time to the endgame boundary, made fresh in the current default precision.
+			*/
+			BaseComplexType PreEndgameTime(double fraction) const
+			{
+				BaseComplexType t_start = this->template Get<ZeroDimConf>().start_time;
+				BaseComplexType t_endgame_boundary = this->template Get<ZeroDimConf>().endgame_boundary;
+
+				if (fraction <= 0)
+					return t_start;
+				if (fraction >= 1)
+					return t_endgame_boundary;
+				return t_start + BaseComplexType(fraction)*(t_endgame_boundary - t_start);
+			}
+
+
+			/**
+			\brief Retrack the paths which failed or crossed, on a second homotopy between the target and start systems with a fresh random gamma, and match the recovered endpoints against the solutions already found.
+
+			A path which fails on one homotopy usually doesn't on another, since the gamma trick moves the paths around the singularities which made it fail.  Only the failed and crossed paths are retracked, in parallel, each through to the end of the endgame.  The solutions of recovered paths replace those of the original homotopy, and are marked as retracked; the points at the endgame boundary are left as they were on the original homotopy.  Paths which still fail are retracked again on another fresh homotopy, up to GammaRetrackConfig::max_num_attempts times.
+
+			Paths going to infinity are not retracked, since they go to infinity on every homotopy.  Retracked paths are not written to the checkpoint log, so a resumed solve retracks them again.
+			*/
+			void RetrackFailedPaths()
+			{
+				auto to_retrack = PathsToRetrack();
+				gamma_retrack_results_.attempted = to_retrack;
+
+				for (unsigned attempt = 0; attempt < this->template Get<GammaRetrack>().max_num_attempts && !to_retrack.empty(); ++attempt)
+				{
+					SystemType homotopy;
+					SystemManagementPolicy::FormHomotopy(homotopy, TargetSystem(), StartSystem(), this->template Get<ZeroDimConf>().path_variable_name);
+					homotopy.Differentiate();
+					++gamma_retrack_results_.num_homotopies;
+
+					to_retrack = MatchRetracked(to_retrack, RetrackOn(homotopy, to_retrack));
+				}
+			}
+
+
+			static
+			bool WentToInfinity(SuccessCode code)
+			{
+				return code==SuccessCode::GoingToInfinity || code==SuccessCode::SecurityMaxNormReached;
+			}
+
+
+			/**
+			\brief The indices of the paths which failed before or during the endgame, except those going to infinity, and those which still cross another path at the endgame boundary.
+			*/
+			std::vector<SolnIndT> PathsToRetrack() const
+			{
+				std::vector<bool> retrack(num_start_points_, false);
+
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+				{
+					const auto& smd = solution_final_metadata_[ii];
+					if (smd.pre_endgame_success != SuccessCode::Success)
+						retrack[ii] = !WentToInfinity(smd.pre_endgame_success);
+					else if (smd.endgame_success != SuccessCode::Success)
+						retrack[ii] = !WentToInfinity(smd.endgame_success);
+				}
+
+				for (auto const& v : midpath_.GetCrossedPaths())
+					if (v.rerun())
+						retrack[v.index()] = true;
+
+				std::vector<SolnIndT> indices;
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+					if (retrack[ii])
+						indices.push_back(static_cast<SolnIndT>(ii));
+				return indices;
+			}
+
+
+			/**
+			\brief Track the given paths on a homotopy, from their start points through the endgame, with a worker per thread taking paths in turn.
+
+			\return The results, in the same order as the indices.
+			*/
+			std::vector<PathResult> RetrackOn(SystemType const& homotopy, std::vector<SolnIndT> const& indices)
+			{
+				const auto num_paths = indices.size();
+
+				// the start system is not for sharing between threads, so the start points are made up front
+				DefaultPrecision(this->template Get<ZeroDimConf>().initial_ambient_precision);
+				std::vector<PathProbe> starts(num_paths);
+				for (decltype(num_paths) ii{0}; ii < num_paths; ++ii)
+					starts[ii].point = StartSystem().template StartPoint<BaseComplexType>(indices[ii]);
+
+				const auto num_threads = NumThreads(this->template Get<GammaRetrack>().num_threads, num_paths);
+				auto workers = MakeWorkers(homotopy, num_threads);
+
+				std::vector<PathResult> results(num_paths);
+				std::atomic<std::size_t> next{0};
+				std::vector<std::exception_ptr> errors(num_threads);
+
+				auto work = [&](std::size_t worker_index)
+				{
+					try
+					{
+						auto& w = *workers[worker_index];
+						for (auto ii = next++; ii < num_paths; ii = next++)
+						{
+							TrackSinglePathOnWorker(w, indices[ii], starts[ii], results[ii]);
+							results[ii].metadata.retracked = true;
+						}
+					}
+					catch (...)
+					{
+						errors[worker_index] = std::current_exception();
+					}
+				};
+
+				if (num_threads==1)
+					work(0);
+				else
+				{
+					std::vector<std::thread> threads;
+					for (std::size_t ii{0}; ii < num_threads; ++ii)
+						threads.emplace_back(work, ii);
+					for (auto& t : threads)
+						t.join();
+				}
+
+				for (auto const& e : errors)
+					if (e)
+						std::rethrow_exception(e);
+
+				return results;
+			}
+
+
+			/**
+			\brief Track one path, to the endgame boundary and then through the endgame, on the homotopy of a worker.
+
+			Touches nothing shared with the other workers, so the metadata which needs the target system is filled in afterward, by StoreWorkerResult.
+
+			\param from Where to pick the path up.  Its point must be in the precision to track it in.
+			*/
+			void TrackSinglePathOnWorker(PathWorker & w, SolnIndT soln_ind, PathProbe const& from, PathResult & r) const
+			{
+				const auto& zd_conf = this->template Get<ZeroDimConf>();
+				const auto& tols = this->template Get<Tolerances>();
+
+				auto& smd = r.metadata;
+				smd.path_index = soln_ind;
+				smd.solution_index = soln_ind;
+
+				DefaultPrecision(Precision(from.point));
+
+				BaseComplexType t_from = PreEndgameTime(from.fraction);
+				BaseComplexType t_endgame_boundary = zd_conf.endgame_boundary;
+
+				w.tracker.SetTrackingTolerance(tols.newton_before_endgame);
+				if (from.fraction > 0)
+				{
+					w.tracker.SetStepSize(from.stepsize);
+					w.tracker.ReinitializeInitialStepSize(false);
+				}
+				else
+					w.tracker.ReinitializeInitialStepSize(true);
+
+				AttachPrecisionRecorders(w.tracker, w.first_prec_rec, w.min_max_prec, smd);
+
+				tracking::ThisThreadPathIndex() = soln_ind;
+				auto& counters = tracking::ThisThreadCounters();
+				auto counters_before = counters;
+				auto clock_start = tracking::TrackingCounters::Clock::now();
+				counters.StartPrecisionClock(DefaultPrecision());
+
+				Vec<BaseComplexType> bdry_point;
+				smd.pre_endgame_success = w.tracker.TrackPath(bdry_point, t_from, t_endgame_boundary, from.point);
+
+				counters.StopPrecisionClock();
+				r.profile.counters += counters - counters_before;
+				r.profile.pre_endgame_seconds += std::chrono::duration<double>(tracking::TrackingCounters::Clock::now() - clock_start).count();
+
+				r.boundary = EGBoundaryMetaData(bdry_point, smd.pre_endgame_success, w.tracker.CurrentStepsize());
+				smd.max_precision_used = Precision(bdry_point);
+
+				if (smd.pre_endgame_success != SuccessCode::Success)
+				{
+					DetachPrecisionRecorders(w.tracker, w.first_prec_rec, w.min_max_prec, smd);
+					r.solution = bdry_point;
+					return;
+				}
+
+				// pick up in the endgame with the stepsize we left off with
+				w.tracker.SetTrackingTolerance(tols.newton_during_endgame);
+				w.tracker.ReinitializeInitialStepSize(false);
+
+				DefaultPrecision(Precision(bdry_point));
+				// we make these fresh so they are in the correct precision to start.
+				BaseComplexType t_end = zd_conf.target_time;
+				t_endgame_boundary = zd_conf.endgame_boundary;
+
+				counters_before = counters;
+				clock_start = tracking::TrackingCounters::Clock::now();
+				counters.StartPrecisionClock(Precision(bdry_point));
+
+				smd.endgame_success = w.endgame.Run(t_endgame_boundary, bdry_point, t_end);
+
+				counters.StopPrecisionClock();
+				const auto used = counters - counters_before;
+				r.profile.counters += used;
+				r.profile.refinement_seconds += used.refinement_seconds;
+				r.profile.endgame_seconds += std::chrono::duration<double>(tracking::TrackingCounters::Clock::now() - clock_start).count() - used.refinement_seconds;
+
+				r.solution = w.endgame.template FinalApproximation<BaseComplexType>();
+				r.previous_approximation = w.endgame.template PreviousApproximation<BaseComplexType>();
+
+				smd.final_time_used = w.endgame.LatestTime();
+				smd.condition_number = w.tracker.LatestConditionNumber();
+				smd.newton_residual = w.tracker.LatestNormOfStep();
+				smd.accuracy_estimate = w.endgame.template ApproximateError();
+				smd.cycle_num = w.endgame.CycleNumber();
+				using std::max;
+				smd.max_precision_used = max(smd.max_precision_used, Precision(r.solution));
+
+				DetachPrecisionRecorders(w.tracker, w.first_prec_rec, w.min_max_prec, smd);
+			}
+
+
+			/**
+			\brief Match the endpoints of retracked paths against the solutions of the paths which succeeded, storing those of recovered paths.
+
+			The solutions are indexed in a PointIndex, so each match costs about a binary search, rather than a comparison against every solution.
+
+			\return The indices of the paths which failed again.
+			*/
+			std::vector<SolnIndT> MatchRetracked(std::vector<SolnIndT> const& indices, std::vector<PathResult> const& results)
+			{
+				std::vector<bool> retracked(num_start_points_, false);
+				for (auto ind : indices)
+					retracked[ind] = true;
+
+				PointIndex<BaseComplexType> known(this->template Get<PostProcessing>().same_point_tolerance);
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+					if (!retracked[ii] && solution_final_metadata_[ii].endgame_success==SuccessCode::Success)
+						known.Add(solutions_post_endgame_[ii], ii);
+
+				std::vector<SolnIndT> failed;
+				for (decltype(results.size()) ii{0}; ii < results.size(); ++ii)
+				{
+					const auto ind = indices[ii];
+					const auto& r = results[ii];
+
+					if (r.metadata.endgame_success != SuccessCode::Success)
+					{
+						path_profiles_[ind] += r.profile;
+						failed.push_back(ind);
+						continue;
+					}
+
+					if (known.Contains(r.solution))
+						gamma_retrack_results_.duplicates.push_back(ind);
+					else
+						gamma_retrack_results_.new_solutions.push_back(ind);
+					gamma_retrack_results_.recovered.push_back(ind);
+
+					known.Add(r.solution, ind);
+					StoreWorkerResult(ind, r);
+					StreamSolution(ind);
+				}
+				return failed;
+			}
+
+
+			/**
+			\brief Store the result of tracking a path on a worker, filling in the metadata which needs the target system.  The point at the endgame boundary is not stored, as the worker may have tracked on another homotopy.
+
+			The precisions recorded earlier for the path, say while probing it, are merged with the worker's rather than replaced: the largest precision used, and the first increase of precision.
+			*/
+			void StoreWorkerResult(SolnIndT soln_ind, PathResult const& r)
+			{
+				path_profiles_[soln_ind] += r.profile;
+
+				auto& smd = solution_final_metadata_[soln_ind];
+				const auto earlier = smd;
+				smd = r.metadata;
+
+				using std::max;
+				smd.max_precision_used = max(earlier.max_precision_used, r.metadata.max_precision_used);
+				if (earlier.precision_changed)
+				{
+					smd.precision_changed = true;
+					smd.time_of_first_prec_increase = earlier.time_of_first_prec_increase;
+				}
+
+				if (smd.endgame_success == SuccessCode::NeverStarted)
+					return;
+
+				solutions_post_endgame_[soln_ind] = r.solution;
+
+				if (tracking::TrackerTraits<TrackerType>::IsAdaptivePrec)
+				{
+					DefaultPrecision(Precision(r.solution));
+					TargetSystem().precision(Precision(r.solution));
+				}
+				smd.function_residual = static_cast<NumErrorT>(TargetSystem().Eval(r.solution).template lpNorm<Eigen::Infinity>());
+				smd.accuracy_estimate_user_coords =
+					static_cast<NumErrorT>( (TargetSystem().DehomogenizePoint(r.solution) -
+					TargetSystem().DehomogenizePoint(r.previous_approximation)).template lpNorm<Eigen::Infinity>() );
+			}
+
+
+
 			void PostEGAction()
 			{
 				ComputePostTrackMetadata();
+				ComputeProfile();
+			}
+
+
+			/**
+			\brief Sum the profiles of the paths into the profile of the solve.
+			*/
+			void ComputeProfile()
+			{
+				total_profile_ = PathProfile();
+				for (auto const& p : path_profiles_)
+					total_profile_ += p;
 			}
 
 
@@ -706,6 +1775,25 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			void ComputePostTrackMetadata()
 			{
 				ComputeMultiplicities();
+				ClassifyFiniteness();
+			}
+
+			/**
+			\brief Sort the paths into those ending at finite points and those at infinity.
+
+			A path is finite only if its endgame succeeded, and its endpoint does not have homogenizing coordinates small relative to the rest (see System::HomogenizingRatio), below the endpoint finite ratio.  Every other path, whether it went to infinity or failed, is not finite.  A path stopped before the endgame keeps, as its solution, the point where it was stopped.  That point is on the patch, so in homogeneous coordinates approximates the point at infinity the path heads to.
+			*/
+			void ClassifyFiniteness()
+			{
+				for (decltype(num_start_points_) ii{0}; ii < num_start_points_; ++ii)
+				{
+					auto& smd = solution_final_metadata_[ii];
+					if (WentToInfinity(smd.pre_endgame_success) && solutions_post_endgame_[ii].size()==0)
+						solutions_post_endgame_[ii] = solutions_at_endgame_boundary_[ii].path_point;
+
+					smd.is_finite = smd.endgame_success==SuccessCode::Success
+						&& TargetSystem().HomogenizingRatio(solutions_post_endgame_[ii]) >= this->template Get<PostProcessing>().endpoint_finite_ratio;
+				}
 			}
 
 			void ComputeMultiplicities()
@@ -761,6 +1849,24 @@ struct AnyZeroDim : public virtual AnyAlgorithm
 			SolnCont<Vec<BaseComplexType> > solutions_post_endgame_;
 			SolnCont<SolutionMetaData> solution_final_metadata_;
 
+			/// profiling
+			SolnCont<PathProfile> path_profiles_; ///< the work done on each path, from the per-thread tracking counters
+			PathProfile total_profile_; ///< the sum of path_profiles_, computed at the end of Solve
+
+			/// warm starting
+			PathStatistics path_statistics_; ///< the step size and precision profile of the paths tracked to the endgame boundary, if warm starting
+
+			/// streaming
+			SolutionCallback solution_callback_; ///< called with each solution as it comes out of the endgame.  may be empty.
+
+			/// retracking on fresh homotopies
+			GammaRetrackMetaData gamma_retrack_results_; ///< what retracking failed and crossed paths did, if enabled
+
+			/// checkpointing
+			std::shared_ptr<CheckpointLog> checkpoint_; ///< the log of completed paths.  null if not checkpointing.
+			std::string source_key_; ///< the HomotopyCache::Key of the target system as given, before it was prepared, and the type of start system.  identifies the problem in the checkpoint log.
+			std::vector<bool> done_before_eg_; ///< which paths have been tracked to the endgame boundary, either in this run or a previous one found in the log.
+			std::vector<bool> done_during_eg_; ///< which paths have been run through the endgame, either in this run or a previous one found in the log.
 
 		}; // struct ZeroDim
 
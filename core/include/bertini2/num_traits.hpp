@@ -193,8 +193,8 @@ namespace bertini
 	{
 		using std::abs;
 		using std::sqrt;
-		static std::default_random_engine generator;
-		static std::uniform_real_distribution<double> distribution(-1.0,1.0);
+		thread_local std::default_random_engine generator(EngineSeed());
+		thread_local std::uniform_real_distribution<double> distribution(-1.0,1.0);
 		std::complex<double> returnme(distribution(generator), distribution(generator));
 		return returnme / sqrt( abs(returnme));
 	}
@@ -202,8 +202,9 @@ namespace bertini
 	template <> inline
 	std::complex<double> RandomUnit<std::complex<double> >()
 	{
-		static std::default_random_engine generator;
-		static std::uniform_real_distribution<double> distribution(-1.0,1.0);
+		// one engine per thread, each seeded differently, as trackers on several threads draw from this at every step
+		thread_local std::default_random_engine generator(EngineSeed());
+		thread_local std::uniform_real_distribution<double> distribution(-1.0,1.0);
 		std::complex<double> returnme(distribution(generator), distribution(generator));
 		return returnme / abs(returnme);
 	}
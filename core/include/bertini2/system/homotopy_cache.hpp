@@ -0,0 +1,183 @@
+//This file is part of Bertini 2.
+//
+//homotopy_cache.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//homotopy_cache.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with homotopy_cache.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file bertini2/system/homotopy_cache.hpp
+
+\brief Provides the bertini::HomotopyCache class, an on-disk store of prepared homotopies.
+*/
+
+
+#ifndef BERTINI_HOMOTOPY_CACHE_HPP
+#define BERTINI_HOMOTOPY_CACHE_HPP
+
+#include "bertini2/system/system.hpp"
+
+#include <fstream>
+
+
+namespace bertini {
+
+	/**
+	\brief A directory of prepared homotopies, each stored together with its target and start systems.
+
+	Homogenizing, patching, forming the start system, and differentiating a large system can take minutes, and give the same result every run which starts from the same system in the same way.  The cache saves the result of that preparation, under a key which is a hash of the unprepared system and a description of how it was prepared, so a later run can load it instead.
+
+	The three systems are written into a single file, in the binary format of SaveBinary, so the nodes they share -- the variables, and the target inside the homotopy -- are shared again when loaded.  Files are written under a temporary name and then renamed, so concurrent runs never read half a file.  A file which can't be read, say because it was written by another version of Bertini2, counts as a miss.
+
+	\see policy::CachedCloneGiven
+	*/
+	class HomotopyCache
+	{
+	public:
+
+		/**
+		\brief The directory used if none is given.  The value of the environment variable BERTINI2_HOMOTOPY_CACHE if it is set, else bertini2_homotopy_cache in the working directory.
+		*/
+		static
+		std::string DefaultDirectory();
+
+
+		/**
+		\brief Use a cache directory.  It is made when something is first stored.
+		*/
+		explicit
+		HomotopyCache(std::string directory = DefaultDirectory()) : directory_(std::move(directory))
+		{}
+
+
+		std::string const& Directory() const
+		{
+			return directory_;
+		}
+
+
+		/**
+		\brief Compute the key for a system and its preparation.
+
+		\param sys The system before preparation.
+		\param preparation Anything else the prepared result depends on, such as the type of start system and the name of the path variable.
+		\return A string of hex digits, a 64-bit hash of the serialized system and the preparation.  Files of another binary format version are told apart by their header.
+		*/
+		static
+		std::string Key(System const& sys, std::string const& preparation);
+
+
+		/**
+		\brief Extend a key with more of a preparation.
+
+		\param key A key from the other overload, say of a system before any preparation.
+		\param preparation Anything else the prepared result depends on.
+		\return A string of hex digits, a 64-bit hash of the key and the preparation.
+		*/
+		static
+		std::string Key(std::string const& key, std::string const& preparation);
+
+
+		/**
+		\brief The path of the file for a key.
+		*/
+		std::string PathFor(std::string const& key) const;
+
+
+		/**
+		\brief Load the systems stored under a key.
+
+		\return Whether they were found and read.  If not, the arguments are untouched.
+		*/
+		template<typename StartSystemT>
+		bool Load(std::string const& key, System & target, StartSystemT & start, System & homotopy) const
+		{
+			std::ifstream fin(PathFor(key), std::ios::binary);
+			if (!fin || !ReadHeader(fin))
+				return false;
+
+			try
+			{
+				System loaded_target, loaded_homotopy;
+				StartSystemT loaded_start;
+				{
+					boost::archive::binary_iarchive ia(fin);
+					ia >> loaded_target >> loaded_start >> loaded_homotopy;
+				}
+				// moved, not copied, so the nodes shared between them stay shared
+				target = std::move(loaded_target);
+				start = std::move(loaded_start);
+				homotopy = std::move(loaded_homotopy);
+			}
+			catch (std::exception const&)
+			{
+				return false;
+			}
+			return true;
+		}
+
+
+		/**
+		\brief Store prepared systems under a key, replacing anything already there.
+
+		\throws std::runtime_error if the cache directory can't be made or written to.
+		*/
+		template<typename StartSystemT>
+		void Store(std::string const& key, System const& target, StartSystemT const& start, System const& homotopy) const
+		{
+			const auto temp_path = TemporaryPathFor(key);
+			{
+				std::ofstream fout(temp_path, std::ios::binary);
+				if (!fout)
+					throw std::runtime_error("unable to open file " + temp_path + " for writing to homotopy cache");
+
+				WriteHeader(fout);
+				boost::archive::binary_oarchive oa(fout);
+				oa << target << start << homotopy;
+			}
+			Commit(temp_path, PathFor(key));
+		}
+
+	private:
+
+		/**
+		\brief Make the cache directory if needed, and a unique name in it to write to.
+		*/
+		std::string TemporaryPathFor(std::string const& key) const;
+
+		/**
+		\brief Rename a written temporary file to its final name.
+		*/
+		static
+		void Commit(std::string const& temp_path, std::string const& path);
+
+		static
+		void WriteHeader(std::ostream & out);
+
+		static
+		bool ReadHeader(std::istream & in);
+
+		std::string directory_;
+	};
+
+} // namespace bertini
+
+
+#endif
@@ -428,6 +428,14 @@ namespace bertini {
 			return variable_group_sizes_.size();
 		}
 
+		/**
+		\brief Get the sizes of the variable groups.  Patch ii involves the variable_group_sizes[ii] variables after those of the groups before it.
+		*/
+		std::vector<unsigned> const& VariableGroupSizes() const
+		{
+			return variable_group_sizes_;
+		}
+
 
 		/**
 		\brief Get the number of variables in the patch.  
@@ -0,0 +1,300 @@
+//This file is part of Bertini 2.
+//
+//polynomial_table.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_table.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_table.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file bertini2/system/polynomial_table.hpp
+
+\brief Provides the bertini::PolynomialTable class, a sparse representation of polynomial systems for fast evaluation.
+*/
+
+
+#ifndef BERTINI_POLYNOMIAL_TABLE_HPP
+#define BERTINI_POLYNOMIAL_TABLE_HPP
+
+#include "bertini2/function_tree.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+
+namespace bertini {
+
+	/**
+	\brief A polynomial system, stored as a sparse table of monomials.
+
+	Each function is a list of terms, and each term is a coefficient and a list of (variable, exponent) pairs for the variables appearing in it.  Evaluation first fills a table with the powers of each variable which are needed, so each term is a product of entries from it.  The partial derivatives of a term are computed from the same products, using prefix and suffix products, so the Jacobian and time derivative come from the same table as the function values.
+
+	The variables of the table are the space variables given at construction, in order, then the path variable if there is one, and then any other variables found in the functions, such as parameters.  All their values are read from the variable nodes, so the table is evaluated wherever the variables were last set.
+
+	Coefficients are kept as constant expression trees, folded into single exact numbers where possible, so they can be evaluated to full accuracy at any precision.
+	*/
+	class PolynomialTable
+	{
+	public:
+		using Var = std::shared_ptr<node::Variable>;
+		using Nd = std::shared_ptr<node::Node>;
+		using Fn = std::shared_ptr<node::Function>;
+
+		/**
+		\brief The default bound on the number of terms an expansion may have.
+		*/
+		static
+		std::size_t DefaultMaxTerms()
+		{
+			return 1 << 16;
+		}
+
+		/**
+		\brief Expand functions into a table of monomials.
+
+		\param functions The functions to expand.
+		\param variables The variables with respect to which the Jacobian is computed.
+		\param path_variable The path variable, or nullptr if there isn't one.
+		\param max_terms The largest number of terms the expansion may have.  Expanding products of sums can take a lot of terms, and then the tree is better.
+
+		\throws std::runtime_error if some function is not a polynomial, or the expansion has too many terms.
+		*/
+		PolynomialTable(std::vector<Fn> const& functions, VariableGroup const& variables, Var const& path_variable, std::size_t max_terms = DefaultMaxTerms());
+
+		/**
+		\brief Expand functions into a table of monomials, if they are polynomials.
+
+		Takes the same arguments as the constructor.
+
+		\return The table, or nullptr if some function is not a polynomial, or the expansion has too many terms.
+		*/
+		static
+		std::shared_ptr<PolynomialTable> Make(std::vector<Fn> const& functions, VariableGroup const& variables, Var const& path_variable, std::size_t max_terms = DefaultMaxTerms());
+
+
+		unsigned NumFunctions() const
+		{
+			return static_cast<unsigned>(function_begin_.size()-1);
+		}
+
+		unsigned NumTerms() const
+		{
+			return static_cast<unsigned>(coefficient_nodes_.size());
+		}
+
+		/**
+		\brief The largest exponent of any of the variables in the table.
+		*/
+		unsigned MaxExponent() const;
+
+		/**
+		\brief Change the precision in which multiple precision evaluation is done.
+		*/
+		void precision(unsigned prec) const;
+
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+
+		/**
+		\brief Evaluate the functions at the current values of the variables, into the first NumFunctions() entries of function_values.
+		*/
+		template<typename Derived>
+		void EvalInPlace(Eigen::MatrixBase<Derived> & function_values) const
+		{
+			using T = typename Derived::Scalar;
+
+			auto const& powers = FillPowers<T>();
+			auto const& coefficients = Coefficients<T>();
+			auto& term = std::get<T>(temp_);
+
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+			{
+				function_values(ii) = T(0);
+				for (auto kk = function_begin_[ii]; kk < function_begin_[ii+1]; ++kk)
+				{
+					term = coefficients[kk];
+					for (auto ll = term_begin_[kk]; ll < term_begin_[kk+1]; ++ll)
+						term *= powers[factor_power_[ll]];
+					function_values(ii) += term;
+				}
+			}
+		}
+
+
+		/**
+		\brief Evaluate the derivatives of the functions with respect to the space variables, into the upper left NumFunctions() x NumVariables() block of J.
+		*/
+		template<typename Derived>
+		void JacobianInPlace(Eigen::MatrixBase<Derived> & J) const
+		{
+			using T = typename Derived::Scalar;
+
+			for (int jj = 0; jj < static_cast<int>(num_space_variables_); ++jj)
+				for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+					J(ii,jj) = T(0);
+
+			const auto num_space = num_space_variables_;
+			PartialDerivatives<T>([num_space](unsigned slot){ return slot < num_space; },
+			                      [&J](unsigned function, unsigned slot, T const& partial){ J(function,slot) += partial; });
+		}
+
+
+		/**
+		\brief Evaluate the derivatives of the functions with respect to the path variable, into the first NumFunctions() entries of ds_dt.
+
+		\throws std::runtime_error if the table has no path variable.
+		*/
+		template<typename Derived>
+		void TimeDerivativeInPlace(Eigen::MatrixBase<Derived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+
+			if (time_slot_ < 0)
+				throw std::runtime_error("computing time derivative of polynomial table with no path variable");
+
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				ds_dt(ii) = T(0);
+
+			const auto time_slot = static_cast<unsigned>(time_slot_);
+			PartialDerivatives<T>([time_slot](unsigned slot){ return slot == time_slot; },
+			                      [&ds_dt](unsigned function, unsigned slot, T const& partial){ ds_dt(function) += partial; });
+		}
+
+	private:
+
+		PolynomialTable() : num_space_variables_(0), time_slot_(-1), precision_(DefaultPrecision())
+		{}
+
+		/**
+		\brief Expand the functions into this empty table.
+
+		\param failure Set to why, if the functions can't be expanded.
+		\return Whether they were.
+		*/
+		bool Build(std::vector<Fn> const& functions, VariableGroup const& variables, Var const& path_variable, std::size_t max_terms, std::string & failure);
+
+		/**
+		\brief Compute the partial derivatives of every term with respect to the wanted variables, handing each to a sink.
+
+		For a term \f$c \prod_i p_i\f$ where \f$p_i = x_{s_i}^{e_i}\f$, the partial with respect to \f$x_{s_i}\f$ is \f$c \left(\prod_{l<i} p_l\right) e_i x_{s_i}^{e_i-1} \left(\prod_{l>i} p_l\right)\f$.  The prefix products are stored on the way forward, and the suffix product accumulated on the way back, so no division is needed, and zeros are no problem.
+		*/
+		template<typename T, typename WantedT, typename SinkT>
+		void PartialDerivatives(WantedT const& wanted, SinkT const& sink) const
+		{
+			auto const& powers = FillPowers<T>();
+			auto const& coefficients = Coefficients<T>();
+			auto& prefix = std::get<std::vector<T>>(prefix_);
+			auto& suffix = std::get<T>(suffix_);
+			auto& term = std::get<T>(temp_);
+
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				for (auto kk = function_begin_[ii]; kk < function_begin_[ii+1]; ++kk)
+				{
+					const auto first = term_begin_[kk], last = term_begin_[kk+1];
+
+					prefix[0] = coefficients[kk];
+					for (auto ll = first; ll < last; ++ll)
+						prefix[ll-first+1] = prefix[ll-first] * powers[factor_power_[ll]];
+
+					suffix = T(1);
+					for (auto ll = last; ll-- > first; )
+					{
+						if (wanted(factor_slot_[ll]))
+						{
+							term = prefix[ll-first] * suffix;
+							term *= powers[factor_power_[ll]-1];
+							term *= static_cast<int>(factor_exponent_[ll]);
+							sink(ii, factor_slot_[ll], term);
+						}
+						suffix *= powers[factor_power_[ll]];
+					}
+				}
+		}
+
+
+		/**
+		\brief Fill the table of powers of the variables at their current values.
+		*/
+		template<typename T>
+		std::vector<T> const& FillPowers() const
+		{
+			auto& powers = std::get<std::vector<T>>(powers_);
+			for (unsigned jj = 0; jj < slots_.size(); ++jj)
+			{
+				const auto offset = power_offset_[jj], end = power_offset_[jj+1];
+				if (end-offset < 2)
+					continue; // only the zeroth power, which never changes
+
+				powers[offset+1] = slots_[jj]->Eval<T>();
+				for (auto kk = offset+2; kk < end; ++kk)
+					powers[kk] = powers[kk-1] * powers[offset+1];
+			}
+			return powers;
+		}
+
+
+		/**
+		\brief Get the values of the coefficients, evaluating them in the current precision if needed.
+		*/
+		template<typename T>
+		std::vector<T> const& Coefficients() const
+		{
+			if (std::is_same<T,mpfr>::value && !coefficients_mp_current_)
+				EvaluateCoefficientsMP();
+			return std::get<std::vector<T>>(coefficients_);
+		}
+
+
+		void EvaluateCoefficientsMP() const;
+
+
+		/**
+		\brief Size the working space, and put it in the current precision.
+		*/
+		void ResizeWorkingSpace() const;
+
+
+		std::vector<Var> slots_; ///< the variables, space first, then time, then any others
+		unsigned num_space_variables_;
+		int time_slot_; ///< the index of the path variable in slots_, or -1 if there is no path variable
+
+		std::vector<unsigned> function_begin_; ///< function ii has terms function_begin_[ii] up to function_begin_[ii+1]
+		std::vector<unsigned> term_begin_; ///< term kk has factors term_begin_[kk] up to term_begin_[kk+1]
+		std::vector<unsigned> factor_slot_; ///< the variable of each factor
+		std::vector<unsigned> factor_exponent_; ///< the exponent of each factor, always positive
+		std::vector<unsigned> factor_power_; ///< the index into the table of powers of each factor
+		std::vector<unsigned> power_offset_; ///< the powers of variable jj are at power_offset_[jj] up to power_offset_[jj+1], starting with the zeroth
+		unsigned max_factors_ = 0; ///< the largest number of factors in any term
+
+		std::vector<Nd> coefficient_nodes_; ///< constant expressions, one for each term
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > coefficients_; ///< the values of the coefficient nodes
+		mutable bool coefficients_mp_current_ = false;
+		mutable unsigned precision_;
+
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > powers_;
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > prefix_;
+		mutable std::tuple< dbl, mpfr > suffix_;
+		mutable std::tuple< dbl, mpfr > temp_;
+	};
+
+} // namespace bertini
+
+
+#endif
@@ -33,6 +33,8 @@
 #include "bertini2/system/start_base.hpp"
 #include "bertini2/limbo.hpp"
 
+#include <boost/serialization/map.hpp>
+
 
 namespace bertini 
 {
@@ -40,9 +42,19 @@ namespace bertini
 
 
 		/**
-		\brief The $m$-homogeneous start system for Numerical Algebraic Geometry
+		\brief The linear-product \f$m\f$-homogeneous start system for Numerical Algebraic Geometry
+
+		Let the target system have \f$m\f$ affine variable groups, of sizes \f$n_1,\dots,n_m\f$, and let \f$d_{ij}\f$ be the degree of function \f$i\f$ in the variables of group \f$j\f$.  Start function \f$i\f$ is then the product
+
+		\f[ g_i = \prod_{j=1}^m \prod_{l=1}^{d_{ij}} L_{ijl}, \f]
+
+		where each \f$L_{ijl}\f$ is an affine linear form in the variables of group \f$j\f$ with random coefficients.
 
-		
+		A start point is obtained by choosing, for each function, one of its linear factors, such that exactly \f$n_j\f$ of the chosen factors are in group \f$j\f$.  The chosen factors then form \f$m\f$ small square linear systems, one per group.  The number of start points is the \f$m\f$-homogeneous Bezout number, which for systems with more than one variable group is often far smaller than the total degree.
+
+		The start points are accessed by index (unsigned long long), and each is computed when asked for, by solving the linear systems for that index.  Nothing is generated up front except a table of counts, which is used to turn an index into a choice of factors.
+
+		Note that the corresponding target system MUST be square.
 		*/
 		class MHomogeneous : public StartSystem
 		{
@@ -53,24 +65,110 @@ namespace bertini
 			/**
 			 Constructor for making a multi-homogeneous start system from a polynomial system
 
-			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, or has any homogeneous variable groups.
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, has any homogeneous variable groups, or has a function which is constant in every variable group.
 			*/
 			MHomogeneous(System const& s);
 
 
-			
-
 			/**
-			Get the number of start points for this total degree start system.  This is the Bezout bound for the target system.  Provided here for your convenience.
+			Get the number of start points for this m-homogeneous start system.  This is the m-homogeneous Bezout number for the target system.  Provided here for your convenience.
 			*/
 			unsigned long long NumStartPoints() const override;
 
+
+			/**
+			\brief Get the degree of a function of the target system in the variables of one of its affine variable groups.
+
+			\param function_index The index of the function.
+			\param group_index The index of the affine variable group.
+			*/
+			unsigned Degree(size_t function_index, size_t group_index) const
+			{
+				return degree_matrix_[function_index*group_sizes_.size() + group_index];
+			}
+
+
+			/**
+			\brief Get a random coefficient of one of the linear factors of a start function.
+
+			\param function_index The index of the start function.
+			\param group_index The index of the variable group the factor is in.
+			\param factor_index Which of the factors for that group, in [0, Degree(function_index, group_index)).
+			\param coefficient_index 0 for the constant term, and k+1 for the coefficient of the kth variable of the group.
+			*/
+			template<typename NumT>
+			NumT Coefficient(size_t function_index, size_t group_index, size_t factor_index, size_t coefficient_index) const
+			{
+				node::WorkingPrecisionGuard precision_guard(precision());
+				return coefficients_[FactorOffset(function_index, group_index, factor_index) + coefficient_index]->Eval<NumT>();
+			}
+
 			MHomogeneous& operator*=(Nd const& n);
 
 			MHomogeneous& operator+=(System const& sys) = delete;
 			
 		private:
 
+			/**
+			Check that the target system is one an m-homogeneous start system can be made for.
+
+			\throws std::runtime_error, if it is not.
+			*/
+			void SanityChecks(System const& s);
+
+			/**
+			Copy the sizes of the affine variable groups, and the degrees of the functions in them, from the target system.
+			*/
+			void CopyDegrees(System const& s);
+
+			/**
+			Populate the random coefficients of the linear factors.
+			*/
+			void SeedRandomCoefficients();
+
+			/**
+			Generate the functions for this start system.  Assumes the coefficients, degrees, and variables are already g2g.
+			*/
+			void GenerateFunctions();
+
+			/**
+			Fill in the table of path counts, used both for NumStartPoints and for converting an index into a choice of linear factors.
+			*/
+			void CountStartPoints();
+
+			/**
+			\brief The number of ways to choose factors for functions with indices at least function_index, if the groups have the given remaining capacities.
+
+			Memoized in num_completions_.
+			*/
+			unsigned long long CountCompletions(size_t function_index, std::vector<unsigned> & remaining);
+
+			/**
+			Look up the number of completions from a state which is already in the table.  Unreachable states have zero completions.
+			*/
+			unsigned long long NumCompletions(std::vector<unsigned> const& remaining) const;
+
+			/**
+			\brief Convert an index into a choice of linear factor for each function.
+
+			\return A pair of vectors, indexed by function.  The first is the group of the chosen factor, the second which factor in that group.
+			*/
+			std::pair<std::vector<unsigned>, std::vector<unsigned>> IndexToFactors(unsigned long long index) const;
+
+			/**
+			Get the position in coefficients_ of the constant term of a linear factor.
+			*/
+			size_t FactorOffset(size_t function_index, size_t group_index, size_t factor_index) const
+			{
+				return factor_offsets_[function_index*group_sizes_.size() + group_index] + factor_index*(group_sizes_[group_index]+1);
+			}
+
+			/**
+			Solve the linear systems for the ith start point.  Shared by the double and multiple precision generators.
+			*/
+			template<typename ComplexType>
+			Vec<ComplexType> GenerateStartPointT(unsigned long long index) const;
+
 			/**
 			Get the ith start point, in double precision.
 
@@ -85,8 +183,11 @@ namespace bertini
 			*/
 			Vec<mpfr> GenerateStartPoint(mpfr,unsigned long long index) const override;
 
-			std::vector<std::shared_ptr<node::Rational> > random_values_; ///< stores the random values for the start functions.  x^d-r, where r is stored in this vector.
-			std::vector<unsigned long long> degrees_; ///< stores the degrees of the functions.
+			std::vector<unsigned> group_sizes_; ///< the number of variables in each affine variable group, not counting homogenizing variables.
+			std::vector<unsigned> degree_matrix_; ///< the degree of each function in each group, row-major by function.
+			std::vector<size_t> factor_offsets_; ///< where the factors for each (function, group) pair start in coefficients_.  row-major by function.
+			std::vector<std::shared_ptr<node::Rational> > coefficients_; ///< the random coefficients of the linear factors.  each factor is a constant term followed by one coefficient per variable of its group.
+			std::map<std::vector<unsigned>, unsigned long long> num_completions_; ///< the number of ways to complete a choice of factors, keyed by the remaining capacities of the groups.
 
 
 			friend class boost::serialization::access;
@@ -94,8 +195,11 @@ namespace bertini
 			template <typename Archive>
 			void serialize(Archive& ar, const unsigned version) {
 				ar & boost::serialization::base_object<StartSystem>(*this);
-				ar & random_values_;
-				ar & degrees_;
+				ar & group_sizes_;
+				ar & degree_matrix_;
+				ar & factor_offsets_;
+				ar & coefficients_;
+				ar & num_completions_;
 			}
 
 		};
@@ -72,6 +72,7 @@ namespace bertini
 			template<typename NumT>
 			NumT RandomValue(size_t index) const
 			{
+				node::WorkingPrecisionGuard precision_guard(precision());
 				return random_values_[index]->Eval<NumT>();
 			}
 
@@ -32,15 +32,19 @@
 #define BERTINI_SYSTEM_HPP
 
 #include <assert.h>
+#include <algorithm>
 #include <vector>
 
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/deque.hpp>
+#include <boost/serialization/version.hpp>
 #include <boost/type_index.hpp>
 
 #include "bertini2/mpfr_complex.hpp"
@@ -50,15 +54,16 @@
 
 #include "bertini2/function_tree.hpp"
 #include "bertini2/system/patch.hpp"
+#include "bertini2/system/polynomial_table.hpp"
 
 #include "bertini2/limbo.hpp"
+#include "bertini2/common/config.hpp"
 
 
-#include <boost/archive/binary_oarchive.hpp>
-	#include <boost/archive/binary_iarchive.hpp>
-	#include <boost/iostreams/stream_buffer.hpp>
-	#include <boost/iostreams/stream.hpp>
-	#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream_buffer.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 
 namespace bertini {
 
@@ -80,6 +85,16 @@ namespace bertini {
 	*/
 	bool DefaultAutoSimplify();
 
+	/**
+	\brief Get the default value for whether a polynomial system should be evaluated from a PolynomialTable, rather than its trees.
+	*/
+	bool DefaultUsePolynomialTable();
+
+	/**
+	\brief Get the default largest number of threads used to differentiate and simplify a system.  This is the number of hardware threads.
+	*/
+	unsigned DefaultMaxDifferentiationThreads();
+
 	/**
 	\brief The fundamental polynomial system class for Bertini2.
 	
@@ -153,19 +168,54 @@ namespace bertini {
 
 		/**
 		 \brief Compute and internally store the symbolic Jacobian of the system.
+
+		 Only the structurally nonzero derivatives are made -- those of functions with respect to variables which appear in them.  The rest are known to be zero, and are neither stored nor evaluated.  Functions are differentiated, and simplified if the system is autosimplifying, on several threads if there are enough of them.  See SetMaxDifferentiationThreads.
 		*/
 		void Differentiate() const;
 
 
+		/**
+		\brief The sparsity pattern of the Jacobian of the functions, in compressed sparse column form.
+
+		The structurally nonzero entries of column jj are in rows JacobianRows()[kk], for kk from JacobianColumnBegin()[jj] up to, but not including, JacobianColumnBegin()[jj+1].  Rows are increasing within each column.  Every other entry is identically zero.  The rows for the patch are not included.
+
+		Differentiates the system, if needed.
+		*/
+		std::vector<unsigned> const& JacobianColumnBegin() const
+		{
+			if (!is_differentiated_)
+				Differentiate();
+			return jacobian_column_begin_;
+		}
+
+		/**
+		\brief The rows of the structurally nonzero entries of the Jacobian of the functions.  \see JacobianColumnBegin
+		*/
+		std::vector<unsigned> const& JacobianRows() const
+		{
+			if (!is_differentiated_)
+				Differentiate();
+			return jacobian_row_;
+		}
+
+		/**
+		\brief The number of structurally nonzero entries in the Jacobian of the functions.
+		*/
+		std::size_t NumJacobianNonzeros() const
+		{
+			return JacobianRows().size();
+		}
+
+
 		
 		/**
 		\brief Force re-evaluation of the system next eval of functions. If something has changed in the system, call this.
 		*/
 		void ResetFunctions() const
 		{
-			// TODO: it has the unfortunate side effect of resetting constant functions, too.
 			for (const auto& iter : functions_) 
 				iter->Reset();
+			functions_changed_ = node::Dependency::None;
 		}
 
 		/**
@@ -188,6 +238,7 @@ namespace bertini {
 					break;
 				}
 			}
+			jacobian_changed_ = node::Dependency::None;
 		}
 
 		void ResetTimeDerivatives() const
@@ -207,6 +258,7 @@ namespace bertini {
 					break;
 				}
 			}
+			time_derivatives_changed_ = node::Dependency::None;
 		}
 
 		/**
@@ -237,9 +289,15 @@ namespace bertini {
 				throw std::runtime_error(ss.str());
 			}
 
-			unsigned counter(0);
-			for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
-				(*iter)->EvalInPlace<T>(function_values(counter));
+			node::WorkingPrecisionGuard precision_guard(precision_);
+			if (UsesPolynomialTable())
+				polynomial_table_->EvalInPlace(function_values);
+			else
+			{
+				unsigned counter(0);
+				for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
+					(*iter)->EvalInPlace<T>(function_values(counter));
+				}
 			}
 
 			if (IsPatched())
@@ -297,7 +355,7 @@ namespace bertini {
 				throw std::runtime_error("not using a time value for evaluation of system, but path variable IS defined.");
 			
 			SetVariables(variable_values.eval());
-			ResetFunctions();
+			ResetChangedFunctions();
 			EvalInPlace(function_values);
 		}
 		
@@ -346,7 +404,7 @@ namespace bertini {
 		 \param variable_values The values of the variables, for the evaluation.
 		 \param path_variable_value The current value of the path variable.
 
-		 \todo The Eval() function for systems has the unfortunate side effect of resetting constant functions.  Modify the System class so that only certain parts of the tree get reset.
+		 Only the parts of the functions depending on what changed are re-evaluated.  Constant parts never are, and parts depending only on the path variable are re-evaluated only when its value changes.
 		 */
 		template<typename Derived, typename OtherDerived, typename T>
 		void EvalInPlace(Eigen::MatrixBase<Derived> & function_values, const Eigen::MatrixBase<OtherDerived>& variable_values, const T & path_variable_value) const
@@ -362,7 +420,7 @@ namespace bertini {
 			SetVariables(variable_values.eval());//TODO: remove this eval
 			SetPathVariable(path_variable_value);
 
-			ResetFunctions();
+			ResetChangedFunctions();
 
 			EvalInPlace(function_values);
 		}
@@ -425,21 +483,35 @@ namespace bertini {
 			if (!is_differentiated_)
 				Differentiate();
 
-			switch (jacobian_eval_method_)
+			node::WorkingPrecisionGuard precision_guard(precision_);
+			if (UsesPolynomialTable())
+				polynomial_table_->JacobianInPlace(J);
+			else
 			{
-				case JacobianEvalMethod::JacobianNode:
+				switch (jacobian_eval_method_)
 				{
-					for (int ii = 0; ii < NumFunctions(); ++ii)
+					case JacobianEvalMethod::JacobianNode:
+					{
 						for (int jj = 0; jj < NumVariables(); ++jj)
-							jacobian_[ii]->EvalJInPlace<T>(J(ii,jj),vars[jj]);
-					break;
-				}
-				case JacobianEvalMethod::Derivatives:
-				{
-					for (int jj = 0; jj < NumVariables(); ++jj)
-						for (int ii = 0; ii < NumFunctions(); ++ii)
-							space_derivatives_[ii+jj*NumFunctions()]->EvalInPlace<T>(J(ii,jj));
-					break;
+						{
+							for (int ii = 0; ii < NumFunctions(); ++ii)
+								J(ii,jj) = T(0);
+							for (auto kk = jacobian_column_begin_[jj]; kk < jacobian_column_begin_[jj+1]; ++kk)
+								jacobian_[jacobian_row_[kk]]->EvalJInPlace<T>(J(jacobian_row_[kk],jj),vars[jj]);
+						}
+						break;
+					}
+					case JacobianEvalMethod::Derivatives:
+					{
+						for (int jj = 0; jj < NumVariables(); ++jj)
+						{
+							for (int ii = 0; ii < NumFunctions(); ++ii)
+								J(ii,jj) = T(0);
+							for (auto kk = jacobian_column_begin_[jj]; kk < jacobian_column_begin_[jj+1]; ++kk)
+								space_derivatives_[kk]->EvalInPlace<T>(J(jacobian_row_[kk],jj));
+						}
+						break;
+					}
 				}
 			}
 			
@@ -493,7 +565,7 @@ namespace bertini {
 				throw std::runtime_error("not using a time value for computation of jacobian, but a path variable is defined.");
 			
 			SetVariables(variable_values);
-			ResetJacobian();
+			ResetChangedJacobian();
 			JacobianInPlace(J);
 		}
 
@@ -552,7 +624,7 @@ namespace bertini {
 			
 			SetVariables(variable_values.eval()); // TODO: remove this eval
 			SetPathVariable(path_variable_value);
-			ResetJacobian();
+			ResetChangedJacobian();
 			JacobianInPlace(J);
 		}
 
@@ -621,7 +693,7 @@ namespace bertini {
 
 			SetVariables(variable_values.eval()); //TODO: remove this eval()
 			SetPathVariable(path_variable_value);
-			ResetTimeDerivatives();
+			ResetChangedTimeDerivatives();
 			TimeDerivativeInPlace(ds_dt);
 		}
 
@@ -663,7 +735,7 @@ namespace bertini {
 			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
 
 			SetVariables(variable_values.eval()); //TODO: remove this eval()
-			ResetTimeDerivatives();
+			ResetChangedTimeDerivatives();
 			TimeDerivativeInPlace(ds_dt);
 		}
 
@@ -710,19 +782,25 @@ namespace bertini {
 			if (!is_differentiated_)
 				Differentiate();
 
-			switch (jacobian_eval_method_)
+			node::WorkingPrecisionGuard precision_guard(precision_);
+			if (UsesPolynomialTable())
+				polynomial_table_->TimeDerivativeInPlace(ds_dt);
+			else
 			{
-				case JacobianEvalMethod::JacobianNode:
+				switch (jacobian_eval_method_)
 				{
-					for (int ii = 0; ii < NumFunctions(); ++ii)
-						jacobian_[ii]->EvalJInPlace<T>(ds_dt(ii), path_variable_);
-					break;
-				}
-				case JacobianEvalMethod::Derivatives:
-				{
-					for (int ii = 0; ii < NumFunctions(); ++ii)
-						time_derivatives_[ii]->EvalInPlace<T>(ds_dt(ii));
-					break;
+					case JacobianEvalMethod::JacobianNode:
+					{
+						for (int ii = 0; ii < NumFunctions(); ++ii)
+							jacobian_[ii]->EvalJInPlace<T>(ds_dt(ii), path_variable_);
+						break;
+					}
+					case JacobianEvalMethod::Derivatives:
+					{
+						for (int ii = 0; ii < NumFunctions(); ++ii)
+							time_derivatives_[ii]->EvalInPlace<T>(ds_dt(ii));
+						break;
+					}
 				}
 			}
 
@@ -910,6 +988,7 @@ namespace bertini {
 			}
 
 			std::get<Vec<T> >(current_variable_values_) = new_values;
+			MarkChanged(node::Dependency::Space);
 		}
 
 
@@ -928,7 +1007,11 @@ namespace bertini {
 			if (!have_path_variable_)
 				throw std::runtime_error("trying to set the value of the path variable, but one is not defined for this system");
 
+			if (path_variable_->Eval<T>() == new_value)
+				return;
+
 			path_variable_->set_current_value(new_value);
+			MarkChanged(node::Dependency::Time);
 		}
 
 
@@ -964,6 +1047,7 @@ namespace bertini {
 			for (auto iter=implicit_parameters_.begin(); iter!=implicit_parameters_.end(); iter++, counter++)
 				(*iter)->set_current_value(new_values(counter));
 
+			MarkChanged(node::Dependency::Space);
 		}
 
 
@@ -1173,10 +1257,30 @@ namespace bertini {
 		
 		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
 
-		\throws std::runtime_error, if there is a mismatch between the number of variables in the input point, and the total number of var
+		\throws std::runtime_error, if there is a mismatch between the number of variables in the input point, and the total number of variables in the system, including homogenizing variables.
 		*/
 		template<typename T>
 		Vec<T> DehomogenizePoint(Vec<T> const& x) const
+			{
+				Vec<T> x_dehomogenized;
+				DehomogenizePointInPlace(x_dehomogenized, x);
+				return x_dehomogenized;
+			}
+
+		/**
+		\brief Dehomogenize a point into a given vector, which is resized only if it is not already the number of natural variables long.  
+
+		Trackers dehomogenize at every step, to check whether the path is going to infinity, and reuse the result vector.
+
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+
+		\param[out] x_dehomogenized The dehomogenized point.
+		\param x The point to dehomogenize.
+
+		\throws std::runtime_error, if there is a mismatch between the number of variables in the input point, and the total number of variables in the system, including homogenizing variables.
+		*/
+		template<typename T>
+		void DehomogenizePointInPlace(Vec<T> & x_dehomogenized, Vec<T> const& x) const
 			{
 
 				if (x.size()!=NumVariables())
@@ -1185,7 +1289,29 @@ namespace bertini {
 				if (!have_ordering_)
 					ConstructOrdering();
 
-				return DehomogenizePointFIFO(x);
+				DehomogenizePointFIFO(x_dehomogenized, x);
+			}
+
+
+		/**
+		\brief How near to infinity a point is, judged from its homogenizing coordinates: the least, over the affine variable groups, of the magnitude of the homogenizing coordinate relative to the largest magnitude of a coordinate in its group.
+
+		Unlike the norm of the dehomogenized point, this is between 0 and 1, and doesn't change when the point is rescaled, so doesn't depend on the patch.  It is 0 at infinity, and 1 for a system which is not homogenized.
+
+		\tparam T the number-type of the point.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+
+		\throws std::runtime_error, if there is a mismatch between the number of variables in the input point, and the total number of variables in the system, including homogenizing variables.
+		*/
+		template<typename T>
+		NumErrorT HomogenizingRatio(Vec<T> const& x) const
+			{
+				if (x.size()!=NumVariables())
+					throw std::runtime_error("computing homogenizing ratio of point with incorrect number of coordinates");
+
+				if (!have_ordering_)
+					ConstructOrdering();
+
+				return HomogenizingRatioFIFO(x);
 			}
 
 
@@ -1410,6 +1536,39 @@ namespace bertini {
 			return auto_simplify_;
 		}
 
+		/**
+		\brief Set whether a polynomial system should be evaluated from a PolynomialTable, rather than from its trees.
+
+		The table is built when the system is differentiated, and is used only if every function is a polynomial.
+		*/
+		void SetUsePolynomialTable(bool val)
+		{
+			use_polynomial_table_ = val;
+			if (is_differentiated_)
+				BuildPolynomialTable();
+		}
+
+		/**
+		\brief Set the largest number of threads Differentiate() and SimplifyDerivatives() may use.  Small systems use one regardless.
+		*/
+		void SetMaxDifferentiationThreads(unsigned val)
+		{
+			max_differentiation_threads_ = val;
+		}
+
+		unsigned MaxDifferentiationThreads() const
+		{
+			return max_differentiation_threads_;
+		}
+
+		/**
+		\brief Query whether evaluation is currently done from a PolynomialTable.
+		*/
+		bool UsesPolynomialTable() const
+		{
+			return is_differentiated_ && polynomial_table_;
+		}
+
 		/**
 		\brief Simplify the functions contained in the system.
 
@@ -1432,6 +1591,17 @@ namespace bertini {
 		void Simplify();
 
 
+		/**
+		\brief Merge identical subexpressions across all the functions and derivatives of the system, so that each is stored, and evaluated, once.
+
+		Differentiates first, if needed, so that the derivatives share subexpressions with the functions and with each other.
+
+		\note Merged functions share nodes, so do this after homogenizing.  See SubexpressionMerger.
+		\return The numbers of distinct nodes before and after merging.
+		*/
+		NodeCounts MergeCommonSubexpressions();
+
+
 		/**
 		\brief Add two systems together.
 
@@ -1472,6 +1642,124 @@ namespace bertini {
 		friend const System operator*(Nd const&  N, System const& s);
 	private:
 
+		/**
+		\brief Note that something the functions may depend on has changed, so the parts depending on it must be reset before the next evaluation.
+		*/
+		void MarkChanged(node::Dependency d) const
+		{
+			functions_changed_ = functions_changed_ | d;
+			jacobian_changed_ = jacobian_changed_ | d;
+			time_derivatives_changed_ = time_derivatives_changed_ | d;
+		}
+
+		/**
+		\brief Reset only the parts of the functions depending on what changed since they were last reset.
+
+		Nodes are tagged with their dependencies by Differentiate(), so an undifferentiated system is reset completely.
+		*/
+		void ResetChangedFunctions() const
+		{
+			if (UsesPolynomialTable())
+				return; // the trees aren't being evaluated, so let the changes accumulate until they are
+
+			if (!is_differentiated_)
+			{
+				ResetFunctions();
+				return;
+			}
+
+			for (const auto& iter : functions_)
+				iter->ResetDependentOn(functions_changed_);
+			functions_changed_ = node::Dependency::None;
+		}
+
+		/**
+		\brief Reset only the parts of the space derivatives depending on what changed since they were last reset.
+
+		Jacobian nodes reset themselves completely whenever the variable of differentiation changes, so those are reset completely here too.
+		*/
+		void ResetChangedJacobian() const
+		{
+			if (UsesPolynomialTable())
+				return;
+
+			if (!is_differentiated_ || jacobian_eval_method_ == JacobianEvalMethod::JacobianNode)
+			{
+				ResetJacobian();
+				return;
+			}
+
+			for (const auto& iter : space_derivatives_)
+				iter->ResetDependentOn(jacobian_changed_);
+			jacobian_changed_ = node::Dependency::None;
+		}
+
+		/**
+		\brief Reset only the parts of the time derivatives depending on what changed since they were last reset.
+		*/
+		void ResetChangedTimeDerivatives() const
+		{
+			if (UsesPolynomialTable())
+				return;
+
+			if (!is_differentiated_ || jacobian_eval_method_ == JacobianEvalMethod::JacobianNode)
+			{
+				ResetTimeDerivatives();
+				return;
+			}
+
+			for (const auto& iter : time_derivatives_)
+				iter->ResetDependentOn(time_derivatives_changed_);
+			time_derivatives_changed_ = node::Dependency::None;
+		}
+
+		/**
+		\brief Tag every node in the system with what it depends on -- the space variables, the path variable, both, or neither.
+
+		Called at the end of Differentiate(), after which the system's structure is fixed until something is added to it.
+		*/
+		void TagDependencies() const;
+
+		/**
+		\brief Expand the functions into a PolynomialTable, if they are all polynomials and the table is wanted.
+
+		Called at the end of Differentiate().
+		*/
+		void BuildPolynomialTable() const;
+
+		/**
+		\brief For each function, the indices of the variables appearing in it, in increasing order.
+
+		\param depends_on_time Filled with whether the path variable appears in each function.
+		*/
+		std::vector<std::vector<unsigned>> VariablesOfFunctions(std::vector<bool> & depends_on_time) const;
+
+		/**
+		\brief Run a task for each function, on several threads if there are enough functions.
+
+		Tasks may change the trees below the roots they are given, so functions whose roots share any operator are done on the same thread, one after another.  The leaves are evaluated in double precision before the threads start, so tasks only read them.
+
+		\param task The task, given the index of a function.
+		\param roots_of Gives the roots of the trees the task for a function may touch.
+		*/
+		void ForEachFunction(std::function<void(unsigned)> const& task, std::function<std::vector<Nd>(unsigned)> const& roots_of) const;
+
+		/**
+		\brief Do something with the variables, and path variable, at random values, putting back their values after.
+
+		All trees are reset before and after.
+		*/
+		void AtRandomValues(std::function<void()> const& f) const;
+
+		/**
+		\brief The smallest number of functions worth giving a thread of its own in Differentiate().
+		*/
+		static
+		unsigned MinFunctionsPerThread()
+		{
+			return 8;
+		}
+
 		/**
 		\brief Get the sizes according to the FIFO ordering.
 		*/
@@ -1493,14 +1781,15 @@ namespace bertini {
 		\see FIFOVariableOrdering
 		*/
 		template<typename T>
-		Vec<T> DehomogenizePointFIFO(Vec<T> const& x) const
+		void DehomogenizePointFIFO(Vec<T> & x_dehomogenized, Vec<T> const& x) const
 		{
 			#ifndef BERTINI_DISABLE_ASSERTS
 			assert(homogenizing_variables_.size()==0 || homogenizing_variables_.size()==NumVariableGroups() && "must have either 0 homogenizing variables, or the number of homogenizing variables must match the number of affine variable groups.");
 			#endif
 
 			bool is_homogenized = homogenizing_variables_.size()!=0;
-			Vec<T> x_dehomogenized(NumNaturalVariables());
+			if (x_dehomogenized.size()!=NumNaturalVariables())
+				x_dehomogenized.resize(NumNaturalVariables());
 
 			unsigned affine_group_counter = 0;
 			unsigned hom_group_counter = 0;
@@ -1547,7 +1836,57 @@ namespace bertini {
 				}
 			}
 
-			return x_dehomogenized;
+		}
+
+
+		/**
+		\brief Compute the homogenizing ratio of a point according to the FIFO variable ordering.
+
+		\see HomogenizingRatio, FIFOVariableOrdering
+		*/
+		template<typename T>
+		NumErrorT HomogenizingRatioFIFO(Vec<T> const& x) const
+		{
+			NumErrorT ratio(1);
+			if (homogenizing_variables_.size()==0)
+				return ratio;
+
+			using std::abs;
+			unsigned affine_group_counter = 0;
+			unsigned hom_group_counter = 0;
+			unsigned hom_index = 0; // index into x
+
+			for (auto& iter : time_order_of_variable_groups_)
+			{
+				switch (iter){
+					case VariableGroupType::Affine:
+					{
+						const auto h = static_cast<NumErrorT>(abs(x(hom_index++)));
+						auto largest = h;
+						for (unsigned ii = 0; ii < variable_groups_[affine_group_counter].size(); ++ii)
+							largest = std::max(largest, static_cast<NumErrorT>(abs(x(hom_index++))));
+						if (largest > 0)
+							ratio = std::min(ratio, h/largest);
+						affine_group_counter++;
+						break;
+					}
+					case VariableGroupType::Homogeneous:
+					{
+						hom_index += hom_variable_groups_[hom_group_counter++].size();
+						break;
+					}
+					case VariableGroupType::Ungrouped:
+					{
+						hom_index++;
+						break;
+					}
+					default:
+					{
+						throw std::runtime_error("unacceptable VariableGroupType in FIFOVariableOrdering");
+					}
+				}
+			}
+			return ratio;
 		}
 
 		/**
@@ -1578,12 +1917,19 @@ namespace bertini {
 
 		mutable std::vector< Jac > jacobian_; ///< The generated functions from differentiation.  Created when first call for a Jacobian matrix evaluation.
 
-		mutable std::vector< Nd > space_derivatives_; ///< The generated functions from differentiation with respect to space.  in column-major order to be consistent with Eigen default order.  Created when first call for a Jacobian matrix evaluation.
+		mutable std::vector< Nd > space_derivatives_; ///< The generated functions from differentiation with respect to space, only the structurally nonzero ones, in the compressed sparse column order of jacobian_column_begin_ and jacobian_row_.  Created when first call for a Jacobian matrix evaluation.
+
+		mutable std::vector<unsigned> jacobian_column_begin_; ///< the structurally nonzero entries of column jj of the Jacobian are jacobian_column_begin_[jj] up to jacobian_column_begin_[jj+1].
+		mutable std::vector<unsigned> jacobian_row_; ///< the row of each structurally nonzero entry of the Jacobian.
 
 		mutable std::vector< Nd > time_derivatives_; ///< The generated functions from differentiation with respect to time.  in column-major order to be consistent with Eigen default order.  Created when first call for a Jacobian matrix evaluation.
 
 		mutable bool is_differentiated_ = false; ///< indicator for whether the jacobian tree has been populated.
 
+		mutable node::Dependency functions_changed_ = node::Dependency::All; ///< what has changed since the functions were last reset.
+		mutable node::Dependency jacobian_changed_ = node::Dependency::All; ///< what has changed since the space derivatives were last reset.
+		mutable node::Dependency time_derivatives_changed_ = node::Dependency::All; ///< what has changed since the time derivatives were last reset.
+
 
 		std::vector< VariableGroupType > time_order_of_variable_groups_;
 
@@ -1600,6 +1946,11 @@ namespace bertini {
 
 		bool auto_simplify_ = DefaultAutoSimplify();
 
+		bool use_polynomial_table_ = DefaultUsePolynomialTable(); ///< whether to evaluate polynomial systems from a table.  \see SetUsePolynomialTable
+		mutable std::shared_ptr<PolynomialTable> polynomial_table_; ///< the expanded functions, built by Differentiate() if they are all polynomials.
+
+		unsigned max_differentiation_threads_ = DefaultMaxDifferentiationThreads(); ///< \see SetMaxDifferentiationThreads
+
 		friend class boost::serialization::access;
 
 		template <typename Archive>
@@ -1629,6 +1980,8 @@ namespace bertini {
 			ar & jacobian_;
 
 			ar & space_derivatives_;
+			ar & jacobian_column_begin_;
+			ar & jacobian_row_;
 			ar & time_derivatives_;
 			
 			ar & precision_;
@@ -1637,6 +1990,15 @@ namespace bertini {
 
 			ar & assume_uniform_precision_;
 			ar & jacobian_eval_method_;
+
+			if (version >= 1)
+			{
+				ar & use_polynomial_table_;
+				ar & max_differentiation_threads_;
+			}
+
+			if (Archive::is_loading::value && is_differentiated_)
+				BuildPolynomialTable();
 		}
 
 	};
@@ -1660,15 +2022,65 @@ namespace bertini {
 
 	/**
 	\brief Do a deep clone of the system.  This includes the entire structure, variables, etc.  everything.
+
+	Goes through the binary format of SaveBinary, in memory.
 	*/
 	System Clone(System const& sys);
 
+
+	/**
+	\brief The version of the binary format written by SaveBinary.  Bump it when the serialized layout of System or of any node type changes, so stale files are refused instead of misread.
+	*/
+	inline
+	unsigned SystemBinaryFormatVersion()
+	{
+		return 2;
+	}
+
+	/**
+	\brief Write a system to a stream in a compact binary format, for caching on disk or sending to other processes.
+
+	Shared nodes are written once, and the derivatives are written too if the system has been differentiated, so nothing needs recomputing when it is read back.  The stream begins with a short header naming the format and its version.
+
+	The format is Boost's binary archive, so it is only readable on machines with the same word size and byte order as the writer.  Use a text archive to move systems between unlike machines.
+
+	\param sys The system to write.
+	\param out A stream opened in binary mode.
+	*/
+	void SaveBinary(System const& sys, std::ostream & out);
+
+	/**
+	\brief Read a system written by SaveBinary.
+
+	\throws std::runtime_error if the stream doesn't start with the header of the current version of the format.
+	*/
+	System LoadBinary(std::istream & in);
+
+	/**
+	\brief Write a system to a file in the format of SaveBinary.
+
+	\throws std::runtime_error if the file can't be opened.
+	*/
+	void SaveBinary(System const& sys, std::string const& filename);
+
+	/**
+	\brief Read a system from a file written by SaveBinary.
+
+	The file is read into memory in a single read, and the system is built from the buffer in one pass.
+
+	\throws std::runtime_error if the file can't be opened, or is not in the current version of the format.
+	*/
+	System LoadBinary(std::string const& filename);
+
 	/**
 	\brief Free form function for simplifying systems.
 	*/
 	void Simplify(System & sys);
 }
 
+// version 1 added use_polynomial_table_ and max_differentiation_threads_
+BOOST_CLASS_VERSION(bertini::System, 1)
+
 
 
 
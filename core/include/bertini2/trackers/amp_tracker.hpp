@@ -400,7 +400,7 @@ namespace bertini{
 				         );
 				#endif
 
-				NotifyObservers(Initializing<AMPTracker,mpfr>(*this,start_time, end_time, start_point));
+				NotifyObservers<Initializing<AMPTracker,mpfr>>(*this,start_time, end_time, start_point);
 
 				initial_precision_ = Precision(start_point(0));
 				DefaultPrecision(initial_precision_);
@@ -463,7 +463,7 @@ namespace bertini{
 					do {
 						if (current_precision_ > Get<PrecConf>().maximum_precision)
 						{
-							NotifyObservers(SingularStartPoint<EmitterType>(*this));
+							NotifyObservers<SingularStartPoint<EmitterType>>(*this);
 							return SuccessCode::SingularStartPoint;
 						}
 
@@ -507,7 +507,7 @@ namespace bertini{
 			{
 				if (preserve_precision_)
 					ChangePrecision(initial_precision_);
-				NotifyObservers(TrackingEnded<EmitterType>(*this));
+				NotifyObservers<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -576,7 +576,7 @@ namespace bertini{
 				assert(PrecisionSanityCheck() && "precision sanity check failed.  some internal variable is not in correct precision");
 				#endif
 
-				NotifyObservers(NewStep<EmitterType>(*this));
+				NotifyObservers<NewStep<EmitterType>>(*this);
 
 				Vec<ComplexType>& predicted_space = std::get<Vec<ComplexType> >(temporary_space_); // this will be populated in the Predict step
 				Vec<ComplexType>& current_space = std::get<Vec<ComplexType> >(current_space_); // the thing we ultimately wish to update
@@ -586,25 +586,25 @@ namespace bertini{
 				SuccessCode predictor_code = Predict<ComplexType, RealType>(predicted_space, current_space, current_time, delta_t);
 				if (predictor_code==SuccessCode::MatrixSolveFailureFirstPartOfPrediction)
 				{
-					NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 					InitialMatrixSolveError();
 					return predictor_code;
 				}
 				else if (predictor_code==SuccessCode::MatrixSolveFailure)
 				{
-					NotifyObservers(PredictorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<PredictorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();// decrease stepsize, and adjust precision as necessary
 					return predictor_code;
 				}	
 				else if (predictor_code==SuccessCode::HigherPrecisionNecessary)
 				{	
-					NotifyObservers(PredictorHigherPrecisionNecessary<EmitterType>(*this));
+					NotifyObservers<PredictorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType>();
 					return predictor_code;
 				}
 
 
-				NotifyObservers(SuccessfulPredict<AMPTracker, ComplexType>(*this, predicted_space));
+				NotifyObservers<SuccessfulPredict<AMPTracker, ComplexType>>(*this, predicted_space);
 
 				Vec<ComplexType>& tentative_next_space = std::get<Vec<ComplexType> >(tentative_space_); // this will be populated in the Correct step
 
@@ -616,13 +616,13 @@ namespace bertini{
 
 				if (corrector_code==SuccessCode::MatrixSolveFailure || corrector_code==SuccessCode::FailedToConverge)
 				{
-					NotifyObservers(CorrectorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();
 					return corrector_code;
 				}
 				else if (corrector_code == SuccessCode::HigherPrecisionNecessary)
 				{
-					NotifyObservers(CorrectorHigherPrecisionNecessary<EmitterType>(*this));
+					NotifyObservers<CorrectorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType>();
 					return corrector_code;
 				}
@@ -632,7 +632,7 @@ namespace bertini{
 					return corrector_code;
 				}
 
-				NotifyObservers(SuccessfulCorrect<AMPTracker, ComplexType>(*this, tentative_next_space));
+				NotifyObservers<SuccessfulCorrect<AMPTracker, ComplexType>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -651,6 +651,14 @@ namespace bertini{
 					return Base::CheckGoingToInfinity<mpfr>();
 			}
 
+			NumErrorT CurrentHomogenizingRatio() const override
+			{
+				if (current_precision_ == DoublePrecision())
+					return Base::CurrentHomogenizingRatio<dbl>();
+				else
+					return Base::CurrentHomogenizingRatio<mpfr>();
+			}
+
 			/**
 			\brief Commit the next precision and stepsize, and adjust internals.
 
@@ -961,7 +969,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Tracker::IncrementBaseCountersSuccess();
-				NotifyObservers(SuccessfulStep<EmitterType>(*this));
+				NotifyObservers<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -972,14 +980,14 @@ namespace bertini{
 				Tracker::IncrementBaseCountersFail();
 				num_successful_steps_since_precision_decrease_ = 0;
 				num_successful_steps_since_stepsize_increase_ = 0;
-				NotifyObservers(FailedStep<EmitterType>(*this));
+				NotifyObservers<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				NotifyObservers<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 
@@ -1247,8 +1255,8 @@ namespace bertini{
 				if (new_precision==current_precision_) // no op
 					return SuccessCode::Success;
 
-				NotifyObservers(PrecisionChanged<EmitterType>(*this,current_precision_,new_precision));
-				
+				NotifyObservers<PrecisionChanged<EmitterType>>(*this,current_precision_,new_precision);
+				ThisThreadCounters().PrecisionChanged(new_precision);
 
 				bool upsampling_needed = new_precision > current_precision_;
 				// reset the counter for estimating the condition number.  
@@ -34,9 +34,13 @@
 #define BERTINI_BASE_TRACKER_HPP
 
 #include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <utility>
 //#include "bertini2/tracking/step.hpp"
 #include "bertini2/trackers/ode_predictors.hpp"
 #include "bertini2/trackers/newton_corrector.hpp"
+#include "bertini2/trackers/counters.hpp"
 #include "bertini2/limbo.hpp"
 #include "bertini2/logging.hpp"
 
@@ -159,6 +163,7 @@ namespace bertini{
 				predictor_ = std::make_shared< predict::ExplicitRKPredictor >(predict::DefaultPredictor(), tracked_system_);
 				corrector_ = std::make_shared< correct::NewtonCorrector >(tracked_system_);
 				SetPredictor(predict::DefaultPredictor());
+				ResizeWorkspaces();
 			}
 
 
@@ -189,6 +194,20 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Set this tracker up the same way as another one, without sharing its system, predictor, or corrector.
+
+			Use this to make independent trackers, say one per thread, each on their own copy of a system.
+			*/
+			void SetupLike(D const& other)
+			{
+				Setup(other.GetPredictor(), other.TrackingTolerance(), other.PathTruncationThreshold(),
+				      other.template Get<SteppingConfig>(), other.template Get<NewtonConfig>());
+				this->template Set(other.template Get<DivergenceConfig>());
+				static_cast<D&>(*this).PrecisionSetup(other.template Get<PrecConf>());
+			}
+
+
 			using Config::Get;
 
 
@@ -212,7 +231,7 @@ namespace bertini{
 			/**
 			\brief Track a start point through time, from a start time to a target time.
 
-			\param[out] solution_at_endtime The value of the solution at the end time.
+			\param[out] solution_at_endtime The value of the solution at the end time.  If the path is truncated as going to infinity, the point where it was stopped.
 			\param start_time The time at which to start tracking.
 			\param endtime The time to track to.
 			\param start_point The intial space values for tracking.
@@ -257,9 +276,14 @@ namespace bertini{
 
 					step_success_code_ = TrackerIteration();
 
+					if (infinite_path_truncation_ && this->template Get<DivergenceConfig>().enabled && step_success_code_==SuccessCode::Success)
+						UpdateDivergenceTrend(CurrentHomogenizingRatio());
+
 					if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
 					{	
 						OnInfiniteTruncation();
+						// the point where the path was stopped is on the patch, so in homogeneous coordinates approximates the point at infinity the path is heading to
+						CopyFinalSolution(solution_at_endtime);
 						PostTrackCleanup();
 						return SuccessCode::GoingToInfinity;
 					}
@@ -296,6 +320,7 @@ namespace bertini{
 			{
 
 				static_assert(detail::IsTemplateParameter<C,NeededTypes>::value,"complex type for refinement must be a used type for the tracker");
+				ScopedSeconds timer(ThisThreadCounters().refinement_seconds);
 				return this->AsDerived().RefineImpl(new_space, start_point, current_time);
 			}
 
@@ -320,7 +345,7 @@ namespace bertini{
 								Vec<C> const& start_point, C const& current_time, double const& tolerance, unsigned max_iterations) const
 			{
 				static_assert(detail::IsTemplateParameter<C,NeededTypes>::value,"complex type for refinement must be a used type for the tracker");
-
+				ScopedSeconds timer(ThisThreadCounters().refinement_seconds);
 				return this->AsDerived().RefineImpl(new_space, start_point, current_time, tolerance, max_iterations);
 			}
 
@@ -356,6 +381,7 @@ namespace bertini{
 				tracked_system_ = std::ref(new_sys);
 				predictor_->ChangeSystem(tracked_system_);
 				corrector_->ChangeSystem(tracked_system_);
+				ResizeWorkspaces();
 			}
 
 			/**
@@ -404,6 +430,11 @@ namespace bertini{
 				return tracking_tolerance_;
 			}
 
+			auto PathTruncationThreshold() const
+			{
+				return path_truncation_threshold_;
+			}
+
 		private:
 
 			// convert the base tracker into the derived type.
@@ -460,13 +491,86 @@ namespace bertini{
 			template <typename ComplexType>
 			SuccessCode CheckGoingToInfinity() const
 			{
-				if (GetSystem().DehomogenizePoint(std::get<Vec<ComplexType> >(current_space_)).norm() > path_truncation_threshold_)
+				if (this->template Get<DivergenceConfig>().enabled && step_success_code_==SuccessCode::Success
+				    && PredictsDivergence())
+					return SuccessCode::GoingToInfinity;
+
+				auto& dehomogenized = std::get<Vec<ComplexType> >(dehomogenized_space_);
+				GetSystem().DehomogenizePointInPlace(dehomogenized, std::get<Vec<ComplexType> >(current_space_));
+				if (dehomogenized.norm() > path_truncation_threshold_)
 					return SuccessCode::GoingToInfinity;
 				else
 					return SuccessCode::Success;
 			}
 
 
+			template <typename ComplexType>
+			NumErrorT CurrentHomogenizingRatio() const
+			{
+				return GetSystem().HomogenizingRatio(std::get<Vec<ComplexType> >(current_space_));
+			}
+
+
+			/**
+			\brief Fold the homogenizing ratio of the point just reached by a successful step into the trend of the path.  Called from the step loop of TrackPath.
+
+			\see DivergenceConfig
+			*/
+			void UpdateDivergenceTrend(NumErrorT homogenizing_ratio) const
+			{
+				const auto& divergence = this->template Get<DivergenceConfig>();
+				const auto stepsize = NumErrorT(current_stepsize_);
+
+				if (homogenizing_ratio < divergence.ratio_threshold && homogenizing_ratio < previous_homogenizing_ratio_
+				    && stepsize <= previous_divergence_stepsize_)
+				{
+					if (num_diverging_steps_==0)
+						diverging_from_ratio_ = homogenizing_ratio;
+					++num_diverging_steps_;
+				}
+				else
+					num_diverging_steps_ = 0;
+
+				previous_homogenizing_ratio_ = homogenizing_ratio;
+				previous_divergence_stepsize_ = stepsize;
+			}
+
+
+			/**
+			\brief Judge from the trend of the homogenizing ratio whether the path is going to infinity: it has shrunk on enough consecutive steps, and by enough.
+
+			\see DivergenceConfig, UpdateDivergenceTrend
+			*/
+			bool PredictsDivergence() const
+			{
+				const auto& divergence = this->template Get<DivergenceConfig>();
+				return num_diverging_steps_ >= divergence.window
+				       && previous_homogenizing_ratio_ <= divergence.min_decay * diverging_from_ratio_;
+			}
+
+
+
+			/**
+			\brief Size the space vectors for the tracked system, in every number type the tracker uses, so that tracking reuses them from path to path rather than allocating.
+			*/
+			void ResizeWorkspaces()
+			{
+				ResizeWorkspaces(std::make_index_sequence<std::tuple_size<TupOfVec>::value>());
+			}
+
+			template<std::size_t... I>
+			void ResizeWorkspaces(std::index_sequence<I...>)
+			{
+				const auto num_vars = GetSystem().NumVariables();
+				const auto num_natural_vars = GetSystem().NumNaturalVariables();
+				(void) std::initializer_list<int>{ (
+					std::get<I>(current_space_).resize(num_vars),
+					std::get<I>(tentative_space_).resize(num_vars),
+					std::get<I>(temporary_space_).resize(num_vars),
+					std::get<I>(dehomogenized_space_).resize(num_natural_vars),
+					0)... };
+			}
+
 
 			/**
 			\brief Function to be called before exiting the tracker loop.
@@ -494,6 +598,10 @@ namespace bertini{
 				num_failed_steps_taken_ = 0;
 				num_consecutive_failed_steps_ = 0;
 				num_total_steps_taken_ = 0;
+
+				num_diverging_steps_ = 0;
+				previous_homogenizing_ratio_ = std::numeric_limits<NumErrorT>::infinity();
+				previous_divergence_stepsize_ = std::numeric_limits<NumErrorT>::infinity();
 			}
 
 
@@ -506,6 +614,7 @@ namespace bertini{
 			{
 				num_successful_steps_taken_++; 
 				num_consecutive_successful_steps_++;
+				++ThisThreadCounters().steps_accepted;
 				current_time_ += delta_t_;
 				num_consecutive_failed_steps_ = 0;
 			}
@@ -524,6 +633,7 @@ namespace bertini{
 				num_consecutive_successful_steps_=0;
 				num_failed_steps_taken_++;
 				num_consecutive_failed_steps_++;
+				++ThisThreadCounters().steps_rejected;
 			}
 
 
@@ -538,6 +648,12 @@ namespace bertini{
 			virtual 
 			SuccessCode CheckGoingToInfinity() const = 0;
 
+			/**
+			\brief The homogenizing ratio of the current space value, in whichever number type it is currently held.
+			*/
+			virtual
+			NumErrorT CurrentHomogenizingRatio() const = 0;
+
 			virtual 
 			void OnInfiniteTruncation() const = 0;
 
@@ -553,6 +669,7 @@ namespace bertini{
 			mutable unsigned num_consecutive_successful_steps_; ///< The number of CONSECUTIVE successful steps taken in a row.
 			mutable unsigned num_consecutive_failed_steps_; ///< The number of CONSECUTIVE failed steps taken in a row. 
 			mutable unsigned num_failed_steps_taken_; ///< The total number of failed steps taken.
+			mutable unsigned num_diverging_steps_ = 0; ///< The number of CONSECUTIVE successful steps on which the path has headed toward infinity.
 
 			
 			// configuration for tracking
@@ -590,6 +707,7 @@ namespace bertini{
 			mutable TupOfVec current_space_; ///< The current space value. 
 			mutable TupOfVec tentative_space_; ///< After correction, the tentative next space value
 			mutable TupOfVec temporary_space_; ///< After prediction, the tentative next space value.
+			mutable TupOfVec dehomogenized_space_; ///< The current space value, dehomogenized, for checking whether the path is going to infinity.
 
 
 			mutable NumErrorT condition_number_estimate_; ///< An estimate on the condition number of the Jacobian		
@@ -597,6 +715,9 @@ namespace bertini{
 			mutable NumErrorT norm_J_; ///< An estimate on the norm of the Jacobian
 			mutable NumErrorT norm_J_inverse_;///< An estimate on the norm of the inverse of the Jacobian
 			mutable NumErrorT norm_delta_z_; ///< The norm of the change in space resulting from a step.
+			mutable NumErrorT previous_homogenizing_ratio_ = std::numeric_limits<NumErrorT>::infinity(); ///< The homogenizing ratio of the space after the previous successful step.
+			mutable NumErrorT diverging_from_ratio_ = std::numeric_limits<NumErrorT>::infinity(); ///< The homogenizing ratio after the first of the current run of diverging steps.
+			mutable NumErrorT previous_divergence_stepsize_ = std::numeric_limits<NumErrorT>::infinity(); ///< The stepsize of the previous successful step, for the divergence trend.
 			mutable NumErrorT size_proportion_; ///< The proportion of the space step size, taking into account the order of the predictor.
 
 
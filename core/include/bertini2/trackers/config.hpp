@@ -100,6 +100,20 @@ namespace tracking{
 	};
 
 
+	/**
+	\brief Settings for stopping paths early which are going to infinity, judged from the homogenizing coordinates of the tracked system, rather than waiting for the dehomogenized point to exceed the path truncation threshold.
+
+	A path is judged to be going to infinity once, for `window` consecutive successful steps, the homogenizing ratio (see System::HomogenizingRatio) has shrunk and the step size has not grown, the ratio is below `ratio_threshold`, and over those steps the ratio has shrunk by at least the factor `min_decay`.  Has no effect on systems which are not homogenized.
+	*/
+	struct DivergenceConfig
+	{
+		bool enabled = false; ///< Whether to stop paths early which are judged to be going to infinity.
+		NumErrorT ratio_threshold = NumErrorT(1)/NumErrorT(1000); ///< The homogenizing ratio below which a path may be judged to be going to infinity.
+		unsigned window = 8; ///< The number of consecutive successful steps over which the path must head toward infinity.
+		NumErrorT min_decay = NumErrorT(1)/NumErrorT(2); ///< The homogenizing ratio must shrink by at least this factor over the window.
+	};
+
+
 	
 	
 
@@ -286,6 +300,7 @@ namespace tracking{
 		using NeededConfigs = detail::TypeList<
 			SteppingConfig, 
 			NewtonConfig,
+			DivergenceConfig,
 			PrecisionConfig
 			>;
 	};
@@ -309,6 +324,7 @@ namespace tracking{
 		using NeededConfigs = detail::TypeList<
 			SteppingConfig, 
 			NewtonConfig,
+			DivergenceConfig,
 			PrecisionConfig
 			>;
 	};
@@ -333,6 +349,7 @@ namespace tracking{
 		using NeededConfigs = detail::TypeList<
 			SteppingConfig, 
 			NewtonConfig,
+			DivergenceConfig,
 			PrecisionConfig
 			>;
 	};
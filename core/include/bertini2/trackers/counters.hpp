@@ -0,0 +1,201 @@
+//This file is part of Bertini 2.
+//
+//counters.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//counters.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with counters.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file counters.hpp
+
+\brief Provides TrackingCounters, always-on counts of the work done while tracking, kept per thread.
+*/
+
+#ifndef BERTINI_TRACKING_COUNTERS_HPP
+#define BERTINI_TRACKING_COUNTERS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Counts of the work done while tracking.
+
+		Every thread has its own set, ThisThreadCounters(), which the trackers, predictors, correctors, and Jacobian solvers add to as they work.  Counting is an increment of a thread-local integer, so it is always on; only precision changes and refinements read the clock.  Each thread's set is aligned to a cache line, so threads counting side by side never share one.
+
+		To measure a piece of work, copy the counters before and after, and subtract.
+
+		\code
+		auto before = tracking::ThisThreadCounters();
+		tracker.TrackPath(result, t_start, t_end, start_point);
+		auto used = tracking::ThisThreadCounters() - before;
+		\endcode
+
+		Function, Jacobian, and time derivative evaluations are those made by the predictor and corrector.  Evaluations an endgame makes directly, say to compute derivatives for a power series, are not counted.
+		*/
+		struct TrackingCounters
+		{
+			using Clock = std::chrono::steady_clock;
+
+			std::uint64_t steps_accepted = 0;
+			std::uint64_t steps_rejected = 0;
+			std::uint64_t newton_iterations = 0;
+			std::uint64_t function_evaluations = 0;
+			std::uint64_t jacobian_evaluations = 0;
+			std::uint64_t time_derivative_evaluations = 0;
+			std::uint64_t lu_factorizations = 0;
+			std::uint64_t precision_changes = 0;
+			double refinement_seconds = 0; ///< wall time spent in Tracker::Refine
+			std::map<unsigned, double> seconds_at_precision; ///< wall time spent at each precision, in digits, while the precision clock was running
+
+			TrackingCounters& operator+=(TrackingCounters const& other)
+			{
+				steps_accepted += other.steps_accepted;
+				steps_rejected += other.steps_rejected;
+				newton_iterations += other.newton_iterations;
+				function_evaluations += other.function_evaluations;
+				jacobian_evaluations += other.jacobian_evaluations;
+				time_derivative_evaluations += other.time_derivative_evaluations;
+				lu_factorizations += other.lu_factorizations;
+				precision_changes += other.precision_changes;
+				refinement_seconds += other.refinement_seconds;
+				for (auto const& p : other.seconds_at_precision)
+					seconds_at_precision[p.first] += p.second;
+				return *this;
+			}
+
+			/**
+			\brief The work done between two copies of the same thread's counters.
+			*/
+			friend
+			TrackingCounters operator-(TrackingCounters later, TrackingCounters const& earlier)
+			{
+				later.steps_accepted -= earlier.steps_accepted;
+				later.steps_rejected -= earlier.steps_rejected;
+				later.newton_iterations -= earlier.newton_iterations;
+				later.function_evaluations -= earlier.function_evaluations;
+				later.jacobian_evaluations -= earlier.jacobian_evaluations;
+				later.time_derivative_evaluations -= earlier.time_derivative_evaluations;
+				later.lu_factorizations -= earlier.lu_factorizations;
+				later.precision_changes -= earlier.precision_changes;
+				later.refinement_seconds -= earlier.refinement_seconds;
+				for (auto const& p : earlier.seconds_at_precision)
+				{
+					auto& s = later.seconds_at_precision[p.first];
+					s -= p.second;
+					if (s <= 0)
+						later.seconds_at_precision.erase(p.first);
+				}
+				return later;
+			}
+
+
+			/**
+			\brief Start attributing wall time to a precision.  Called when a path starts.
+			*/
+			void StartPrecisionClock(unsigned precision)
+			{
+				clock_running_ = true;
+				clock_precision_ = precision;
+				clock_since_ = Clock::now();
+			}
+
+			/**
+			\brief Attribute the wall time since the last mark to the old precision, and continue at a new one.  Called by trackers when they change precision.
+			*/
+			void PrecisionChanged(unsigned new_precision)
+			{
+				++precision_changes;
+				if (clock_running_)
+				{
+					auto now = Clock::now();
+					seconds_at_precision[clock_precision_] += std::chrono::duration<double>(now - clock_since_).count();
+					clock_since_ = now;
+				}
+				clock_precision_ = new_precision;
+			}
+
+			/**
+			\brief Attribute the wall time since the last mark to the current precision, and stop.  Called when a path is done.
+			*/
+			void StopPrecisionClock()
+			{
+				if (!clock_running_)
+					return;
+				seconds_at_precision[clock_precision_] += std::chrono::duration<double>(Clock::now() - clock_since_).count();
+				clock_running_ = false;
+			}
+
+		private:
+			bool clock_running_ = false;
+			unsigned clock_precision_ = 0;
+			Clock::time_point clock_since_;
+		};
+
+
+		/**
+		\brief The counters of the calling thread.
+		*/
+		inline
+		TrackingCounters& ThisThreadCounters()
+		{
+			alignas(64) static thread_local TrackingCounters counters;
+			return counters;
+		}
+
+
+		/**
+		\brief The index of the path the calling thread is tracking.  Set by whatever is driving the tracker, such as ZeroDim, and used to label traces.
+		*/
+		inline
+		std::uint64_t& ThisThreadPathIndex()
+		{
+			static thread_local std::uint64_t index = 0;
+			return index;
+		}
+
+
+		/**
+		\brief Adds the wall time of its lifetime to a number of seconds.
+		*/
+		class ScopedSeconds
+		{
+		public:
+			explicit
+			ScopedSeconds(double & total) : total_(total), start_(TrackingCounters::Clock::now())
+			{}
+
+			~ScopedSeconds()
+			{
+				total_ += std::chrono::duration<double>(TrackingCounters::Clock::now() - start_).count();
+			}
+
+		private:
+			double & total_;
+			TrackingCounters::Clock::time_point start_;
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
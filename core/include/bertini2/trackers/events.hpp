@@ -73,6 +73,8 @@ namespace bertini {
 	class SuccessfulPredict : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<SuccessfulPredict, TrackingEvent<ObservedT>>;
+
 		/**
 		\brief The constructor for a SuccessfulPredict Event.
 
@@ -103,6 +105,8 @@ namespace bertini {
 	class SuccessfulCorrect : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<SuccessfulCorrect, TrackingEvent<ObservedT>>;
+
 		/**
 		\brief The constructor for a SuccessfulCorrect Event.
 
@@ -139,6 +143,8 @@ namespace bertini {
 	class PrecisionChanged : public PrecisionEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<PrecisionChanged, PrecisionEvent<ObservedT>>;
+
 		/**
 		\brief The constructor for a PrecisionChanged Event.
 
@@ -176,6 +182,8 @@ namespace bertini {
 	class PrecisionIncreased : public PrecisionChanged<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<PrecisionIncreased, PrecisionChanged<ObservedT>>;
+
 		/**
 		\brief The constructor for a PrecisionIncreased Event.
 
@@ -197,6 +205,8 @@ namespace bertini {
 	class PrecisionDecreased : public PrecisionChanged<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<PrecisionDecreased, PrecisionChanged<ObservedT>>;
+
 		/**
 		\brief The constructor for a PrecisionDecreased Event.
 
@@ -295,6 +305,8 @@ namespace bertini {
 	class Initializing : public TrackingEvent<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
+		using Lineage = EventLineage<Initializing, TrackingEvent<ObservedT>>;
+
 
 		/**
 		\brief Constructor for an Initializing Event
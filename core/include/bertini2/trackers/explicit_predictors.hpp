@@ -37,6 +37,7 @@
 #include "bertini2/trackers/amp_criteria.hpp"
 
 #include "bertini2/system/system.hpp"
+#include "bertini2/trackers/jacobian_solver.hpp"
 #include "bertini2/mpfr_extensions.hpp"
 #include <Eigen/LU>
 
@@ -132,32 +133,6 @@ namespace bertini{
 			}
 			
 			
-			namespace {
-				template<typename T>
-				struct LUSelector
-				{};
-
-				template<>
-				struct LUSelector<dbl>
-				{
-					template<typename N>
-					static Eigen::PartialPivLU<Mat<dbl>>& Run(N & n)
-					{
-						return n.GetLU_d();
-					}
-				};
-
-				template<>
-				struct LUSelector<mpfr>
-				{
-					template<typename N>
-					static Eigen::PartialPivLU<Mat<mpfr>>& Run(N & n)
-					{
-						return n.GetLU_mp();
-					}
-				};
-			}
-			
 			/**
 			 \class ExplicitRKPredictor
 			 
@@ -182,8 +157,6 @@ namespace bertini{
 			 */
 			class ExplicitRKPredictor
 			{
-				friend LUSelector<dbl>;
-				friend LUSelector<mpfr>;
 			public:
 				
 				/**
@@ -348,6 +321,20 @@ namespace bertini{
 					std::get< Vec<dbl> >(dh_dt_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(dh_dt_temp_).resize(numTotalFunctions_);
 
+					std::get< Vec<dbl> >(stage_sum_).resize(numTotalFunctions_);
+					std::get< Vec<mpfr> >(stage_sum_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(stage_space_).resize(numVariables_);
+					std::get< Vec<mpfr> >(stage_space_).resize(numVariables_);
+					std::get< Vec<dbl> >(random_rhs_).resize(numVariables_);
+					std::get< Vec<mpfr> >(random_rhs_).resize(numVariables_);
+					std::get< Vec<dbl> >(random_solution_).resize(numVariables_);
+					std::get< Vec<mpfr> >(random_solution_).resize(numVariables_);
+					std::get< Vec<dbl> >(error_).resize(numTotalFunctions_);
+					std::get< Vec<mpfr> >(error_).resize(numTotalFunctions_);
+
+					solver_0_.ChangeSystem(S);
+					solver_temp_ = solver_0_;
+
 					ResizeK();
 				}
 				
@@ -381,11 +368,20 @@ namespace bertini{
 					Precision(std::get< Mat<mpfr> >(dh_dx_0_),new_precision);
 					Precision(std::get< Mat<mpfr> >(dh_dx_temp_),new_precision);
 
+					Precision(std::get< Vec<mpfr> >(stage_sum_),new_precision);
+					Precision(std::get< Vec<mpfr> >(stage_space_),new_precision);
+					Precision(std::get< Vec<mpfr> >(random_rhs_),new_precision);
+					Precision(std::get< Vec<mpfr> >(random_solution_),new_precision);
+					Precision(std::get< Vec<mpfr> >(error_),new_precision);
+
 					Precision(std::get< Mat<mpfr_float> >(a_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(b_minus_bstar_),new_precision);
 					Precision(std::get< Vec<mpfr_float> >(c_),new_precision);
 
+					solver_0_.ChangePrecision(new_precision);
+					solver_temp_.ChangePrecision(new_precision);
+
 					PredictorMethod(predictor_);
 
 					current_precision_ = new_precision;
@@ -636,24 +632,6 @@ namespace bertini{
 				//
 				////////////////////
 				
-				template <typename T>
-				Eigen::PartialPivLU<Mat<T>>& GetLU()
-				{
-					return LUSelector<T>::Run(*this);
-				}
-
-
-				Eigen::PartialPivLU<Mat<dbl>>& GetLU_d()
-				{
-					return LU_d_;
-				}
-
-				Eigen::PartialPivLU<Mat<mpfr>>& GetLU_mp()
-				{
-					assert(current_precision_==DefaultPrecision());
-					return LU_mp_[current_precision_];
-				}
-
 				/**
 				 \brief Performs a full prediction step from current_time to current_time + delta_t
 				 
@@ -687,10 +665,11 @@ namespace bertini{
 					Mat<RealType>& aref = std::get< Mat<RealType> >(a_);
 					Vec<RealType>& bref = std::get< Vec<RealType> >(b_);
 					Vec<RealType>& cref = std::get< Vec<RealType> >(c_);
+					Vec<ComplexType>& temp = std::get< Vec<ComplexType> >(stage_sum_);
+					Vec<ComplexType>& stage_space = std::get< Vec<ComplexType> >(stage_space_);
 					Kref.fill(ComplexType(0));
-					Vec<ComplexType> temp(S.NumTotalFunctions());
 					
-					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
+					if(EvalRHS(S, current_space.derived(), current_time, Kref, 0) != SuccessCode::Success)
 					{
 						return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 					}
@@ -701,7 +680,8 @@ namespace bertini{
 						for(int jj = 0; jj < ii; ++jj)
 							temp += aref(ii,jj)*Kref.col(jj);
 
-						if(EvalRHS(S, current_space + delta_t*temp, current_time + cref(ii)*delta_t, Kref, ii) != SuccessCode::Success)
+						stage_space = current_space + delta_t*temp;
+						if(EvalRHS(S, stage_space, current_time + cref(ii)*delta_t, Kref, ii) != SuccessCode::Success)
 							return SuccessCode::MatrixSolveFailure;
 					}
 					
@@ -720,12 +700,14 @@ namespace bertini{
 				void SetNormsCond(NumErrorT & norm_J, NumErrorT & norm_J_inverse, NumErrorT & condition_number_estimate, unsigned num_steps_since_last_condition_number_computation, unsigned frequency_of_CN_estimation)
 				{
 					// Calculate condition number and update if needed
-					Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
 					Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
 
-					// TODO this random vector should not be made fresh every time.  especiallyif the numeric type is mpfr!
-					Vec<ComplexType> randy = RandomOfUnits<ComplexType>(numVariables_);
-					Vec<ComplexType> temp_soln = LUref.solve(randy);
+					// the random vector is drawn fresh every time, but into storage which persists, as does the solution
+					Vec<ComplexType>& randy = std::get< Vec<ComplexType> >(random_rhs_);
+					Vec<ComplexType>& temp_soln = std::get< Vec<ComplexType> >(random_solution_);
+					for (unsigned ii = 0; ii < numVariables_; ++ii)
+						randy(ii) = RandomUnit<ComplexType>();
+					solver_0_.SolveInPlace(temp_soln, randy);
 					
 					norm_J = NumErrorT(dhdxref.norm());
 					norm_J_inverse = NumErrorT(temp_soln.norm());
@@ -758,8 +740,7 @@ namespace bertini{
 					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
 					Vec<RealType>& b_minus_bstar_ref = std::get< Vec<RealType> >(b_minus_bstar_);
 					
-					auto numFuncs = Kref.rows();
-					Vec<ComplexType> err(numFuncs);
+					Vec<ComplexType>& err = std::get< Vec<ComplexType> >(error_);
 					
 					err.setZero();
 					for(int ii = 0; ii < s_; ++ii)
@@ -834,9 +815,12 @@ namespace bertini{
 					if (std::is_same<typename Derived::Scalar, mpfr>::value)
 						PrecisionSanityCheck();
 
+					auto& counters = ThisThreadCounters();
+					++counters.jacobian_evaluations;
+					++counters.time_derivative_evaluations;
+
 					if(stage == 0)
 					{
-						Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
 						Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
 
 						if (!std::is_same<ComplexType,dbl>::value)
@@ -848,39 +832,38 @@ namespace bertini{
 							assert(Precision(dhdxref)==current_precision_);
 							assert(Precision(K)==current_precision_);
 						}
-						S.SetAndReset<ComplexType>(space, time);
+						S.SetAndReset<ComplexType>(space.derived(), time);
 						S.JacobianInPlace(dhdxref);
-						LUref = dhdxref.lu();
 						if (!std::is_same<ComplexType,dbl>::value)
 						{
 							assert(Precision(dhdxref)==current_precision_);
-							assert(Precision(LUref.matrixLU())==current_precision_);
 						}
 
-						if (LUPartialPivotDecompositionSuccessful(LUref.matrixLU())!=MatrixSuccessCode::Success)
+						if (solver_0_.Factor(dhdxref)!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 						
 						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
 						S.TimeDerivativeInPlace(dhdtref);
-						K.col(stage) = LUref.solve(-dhdtref);
+						dhdtref = -dhdtref;
+						solver_0_.SolveInPlace(K.col(stage), dhdtref);
 						
 						return SuccessCode::Success;
 						
 					}
 					else
 					{
-						S.SetAndReset<ComplexType>(space, time);
+						S.SetAndReset<ComplexType>(space.derived(), time);
 
 						Mat<ComplexType>& dhdxtempref = std::get< Mat<ComplexType> >(dh_dx_temp_);
 						S.JacobianInPlace(dhdxtempref);
-						auto LU = dhdxtempref.lu();
 						
-						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
+						if (solver_temp_.Factor(dhdxtempref)!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailure;
 						
 						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
 						S.TimeDerivativeInPlace(dhdtref);
-						K.col(stage) = LU.solve(-dhdtref);
+						dhdtref = -dhdtref;
+						solver_temp_.SolveInPlace(K.col(stage), dhdtref);
 						
 						return SuccessCode::Success;
 					}
@@ -1018,10 +1001,15 @@ namespace bertini{
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > dh_dx_0_;  // Jacobian for the initial stage.  Use for AMP testing
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > dh_dx_temp_;  // Temporary jacobian for all other stages
 				mutable std::tuple< Vec<dbl>, Vec<mpfr> > dh_dt_temp_;  // Temporary time derivative used for all stages
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > stage_sum_;  // Weighted sum of the stage variables, for the next stage or the prediction
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > stage_space_;  // Space point at which a stage is evaluated
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > random_rhs_;  // Random right hand side for estimating the norm of the inverse of the Jacobian
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > random_solution_;  // Solution with the random right hand side
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > error_;  // Error estimate from an embedded method
 				// std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_0_;  // LU from the intial stage used for AMP testing
 
-				mutable Eigen::PartialPivLU<Mat<dbl>> LU_d_;
-				mutable std::map<unsigned,Eigen::PartialPivLU<Mat<mpfr>>> LU_mp_;
+				JacobianSolver solver_0_;  // Factorization of the Jacobian of the initial stage, kept for the condition number estimate
+				JacobianSolver solver_temp_;  // Factorization of the Jacobian for all other stages
 				
 				
 				// Butcher Table (notation from https://en.wikipedia.org/wiki/List_of_Runge%E2%80%93Kutta_methods)
@@ -128,7 +128,7 @@ namespace bertini{
 
 			void PostTrackCleanup() const override
 			{
-				this->NotifyObservers(TrackingEnded<EmitterType>(*this));
+				this->template NotifyObservers<TrackingEnded<EmitterType>>(*this);
 			}
 
 			/**
@@ -168,7 +168,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
-				this->NotifyObservers(NewStep<EmitterType >(*this));
+				this->template NotifyObservers<NewStep<EmitterType>>(*this);
 
 				Vec<CT>& predicted_space = std::get<Vec<CT> >(this->temporary_space_); // this will be populated in the Predict step
 				Vec<CT>& current_space = std::get<Vec<CT> >(this->current_space_); // the thing we ultimately wish to update
@@ -179,7 +179,7 @@ namespace bertini{
 
 				if (predictor_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType >(*this));
+					this->template NotifyObservers<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = RT(Get<Stepping>().step_size_fail_factor)*this->current_stepsize_;
 
@@ -188,7 +188,7 @@ namespace bertini{
 					return predictor_code;
 				}
 
-				this->NotifyObservers(SuccessfulPredict<EmitterType , CT>(*this, predicted_space));
+				this->template NotifyObservers<SuccessfulPredict<EmitterType , CT>>(*this, predicted_space);
 
 				Vec<CT>& tentative_next_space = std::get<Vec<CT> >(this->tentative_space_); // this will be populated in the Correct step
 
@@ -205,7 +205,7 @@ namespace bertini{
 				}
 				else if (corrector_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(CorrectorMatrixSolveFailure<EmitterType >(*this));
+					this->template NotifyObservers<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = RT(Get<Stepping>().step_size_fail_factor)*this->current_stepsize_;
 					UpdateStepsize();
@@ -214,7 +214,7 @@ namespace bertini{
 				}
 
 				
-				this->NotifyObservers(SuccessfulCorrect<EmitterType , CT>(*this, tentative_next_space));
+				this->template NotifyObservers<SuccessfulCorrect<EmitterType , CT>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -230,6 +230,11 @@ namespace bertini{
 				return Base::template CheckGoingToInfinity<CT>();
 			}
 
+			NumErrorT CurrentHomogenizingRatio() const override
+			{
+				return Base::template CurrentHomogenizingRatio<CT>();
+			}
+
 			
 
 
@@ -259,7 +264,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Base::IncrementBaseCountersSuccess();
-				this->NotifyObservers(SuccessfulStep<EmitterType >(*this));
+				this->template NotifyObservers<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -269,14 +274,14 @@ namespace bertini{
 			{
 				Base::IncrementBaseCountersFail();
 				this->num_successful_steps_since_stepsize_increase_ = 0;
-				this->NotifyObservers(FailedStep<EmitterType >(*this));
+				this->template NotifyObservers<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				this->NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				this->template NotifyObservers<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 			//////////////
@@ -452,7 +457,7 @@ namespace bertini{
 			                               BaseComplexType const& end_time,
 										   Vec<BaseComplexType> const& start_point) const override
 			{
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template NotifyObservers<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -537,7 +542,7 @@ namespace bertini{
 				}
 
 
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template NotifyObservers<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -0,0 +1,383 @@
+//This file is part of Bertini 2.
+//
+//jacobian_solver.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//jacobian_solver.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with jacobian_solver.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+
+#ifndef BERTINI_JACOBIAN_SOLVER_HPP
+#define BERTINI_JACOBIAN_SOLVER_HPP
+
+/**
+\file jacobian_solver.hpp
+
+\brief Provides the JacobianSolver class, which factors Jacobian matrices densely or sparsely, as suits the system.
+*/
+
+#include "bertini2/system/system.hpp"
+#include "bertini2/trackers/counters.hpp"
+#include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
+namespace bertini{
+	namespace detail {
+
+		/**
+		\brief Eigen's SparseLU, with access to the diagonal of the upper triangular factor, so a factorization can be checked the same way as a dense one.
+		*/
+		template<typename MatrixT>
+		class CheckedSparseLU : public Eigen::SparseLU<MatrixT, Eigen::COLAMDOrdering<int> >
+		{
+			using Base = Eigen::SparseLU<MatrixT, Eigen::COLAMDOrdering<int> >;
+		public:
+			using Scalar = typename Base::Scalar;
+
+			/**
+			\brief The diagonal of U.  The supernodal storage of L holds it, as in Eigen's own determinant functions.
+			*/
+			Vec<Scalar> DiagonalOfU() const
+			{
+				Vec<Scalar> d(this->cols());
+				for (Eigen::Index jj = 0; jj < this->cols(); ++jj)
+					for (typename Base::SCMatrix::InnerIterator it(this->m_Lstore, jj); it; ++it)
+						if (it.index() == jj)
+						{
+							d(jj) = it.value();
+							break;
+						}
+				return d;
+			}
+		};
+	} // namespace detail
+
+	namespace tracking{
+
+
+		/**
+		\class JacobianSolver
+
+		\brief Factors the Jacobian of a system, and solves with it, by dense or sparse LU as suits the system.
+
+		## Purpose
+
+		Predictors and correctors solve with the Jacobian of the homotopy at least once per stage or iteration.  In large systems where each function involves only a few of the variables, most entries of the Jacobian are zero, and a sparse factorization costs far less than a dense one.
+
+		When given a system, the solver reads the sparsity pattern of its Jacobian -- the structural nonzeros of the functions, from System::JacobianColumnBegin, and a row for each patch, full over its variable group.  If the system is square, has at least MinSparseSize() variables, and at most MaxSparseDensity() of the entries are nonzero, factorizations are sparse.  Otherwise they are dense, as they always were.
+
+		The symbolic analysis for the sparse factorization, the fill-reducing ordering and elimination tree, is done once per system, so each factorization is numeric only.
+
+		## Use
+
+		\code
+		JacobianSolver solver(sys);
+		sys.JacobianInPlace(J);
+		if (solver.Factor(J) != MatrixSuccessCode::Success)
+			return SuccessCode::MatrixSolveFailure;
+		Vec<dbl> delta = solver.Solve(-f);
+		\endcode
+
+		In the tracking loop, SolveInPlace writes into a workspace instead, so steps do not allocate.
+
+		The Jacobian is still evaluated into a dense matrix, and the entries in the pattern are gathered from it.
+		*/
+		class JacobianSolver
+		{
+			template<typename T>
+			using SparseMat = Eigen::SparseMatrix<T, Eigen::ColMajor, int>;
+
+		public:
+
+			/**
+			\brief The default smallest number of variables for which sparse factorization is considered.  Below this, dense LU is fast enough that the bookkeeping isn't worth it.
+			*/
+			static
+			unsigned DefaultMinSparseSize()
+			{
+				return 100;
+			}
+
+			/**
+			\brief The default largest fraction of nonzero entries for which sparse factorization is used.
+			*/
+			static
+			double DefaultMaxSparseDensity()
+			{
+				return 0.1;
+			}
+
+
+			JacobianSolver(unsigned min_sparse_size = DefaultMinSparseSize(), double max_sparse_density = DefaultMaxSparseDensity()) : min_sparse_size_(min_sparse_size), max_sparse_density_(max_sparse_density), current_precision_(DefaultPrecision())
+			{}
+
+			explicit
+			JacobianSolver(System const& S, unsigned min_sparse_size = DefaultMinSparseSize(), double max_sparse_density = DefaultMaxSparseDensity()) : JacobianSolver(min_sparse_size, max_sparse_density)
+			{
+				ChangeSystem(S);
+			}
+
+			/**
+			\brief Copy the pattern and settings.  Factorizations are not copied; the copy analyzes the pattern again when first used.
+			*/
+			JacobianSolver(JacobianSolver const& other) : min_sparse_size_(other.min_sparse_size_), max_sparse_density_(other.max_sparse_density_), is_sparse_(other.is_sparse_), current_precision_(other.current_precision_), sparse_matrix_(other.sparse_matrix_), dense_LU_(other.dense_LU_)
+			{}
+
+			JacobianSolver& operator=(JacobianSolver const& other)
+			{
+				if (this != &other)
+				{
+					min_sparse_size_ = other.min_sparse_size_;
+					max_sparse_density_ = other.max_sparse_density_;
+					is_sparse_ = other.is_sparse_;
+					current_precision_ = other.current_precision_;
+					sparse_matrix_ = other.sparse_matrix_;
+					dense_LU_ = other.dense_LU_;
+					std::get<0>(sparse_LU_).reset();
+					std::get<1>(sparse_LU_).reset();
+				}
+				return *this;
+			}
+
+
+			/**
+			\brief Change the system whose Jacobians are factored, deciding between dense and sparse factorization.
+
+			Differentiates the system, if needed, when it is large enough that sparse factorization might be used.
+			*/
+			void ChangeSystem(System const& S)
+			{
+				const auto num_rows = S.NumTotalFunctions(), num_cols = S.NumVariables();
+
+				is_sparse_ = false;
+				std::get<0>(sparse_LU_).reset();
+				std::get<1>(sparse_LU_).reset();
+				std::get< SparseMat<dbl> >(sparse_matrix_).resize(0,0);
+				std::get< SparseMat<mpfr> >(sparse_matrix_).resize(0,0);
+
+				if (num_rows != num_cols || num_cols < min_sparse_size_ || num_cols==0)
+					return;
+
+				// patch ii is a row after the functions, full over the columns of its variable group
+				std::vector<int> patch_of_column(num_cols, -1);
+				if (S.IsPatched())
+				{
+					const auto patch = S.GetPatch();
+					auto const& group_sizes = patch.VariableGroupSizes();
+					unsigned counter(0);
+					for (unsigned ii = 0; ii < group_sizes.size(); ++ii)
+						for (unsigned jj = 0; jj < group_sizes[ii] && counter < num_cols; ++jj)
+							patch_of_column[counter++] = static_cast<int>(ii);
+				}
+
+				std::size_t num_nonzeros = S.NumJacobianNonzeros();
+				for (auto p : patch_of_column)
+					if (p >= 0)
+						++num_nonzeros;
+
+				if (static_cast<double>(num_nonzeros) > max_sparse_density_ * static_cast<double>(num_rows) * static_cast<double>(num_cols))
+					return;
+
+				FillPattern<dbl>(S, patch_of_column);
+				FillPattern<mpfr>(S, patch_of_column);
+				is_sparse_ = true;
+			}
+
+
+			/**
+			\brief Change the precision of the multiple precision factorization.
+
+			The default precision should already be the new one.  The analysis of the sparsity pattern depends only on the pattern, so is kept; the numbers in the sparse factorization are made afresh by the next Factor.
+			*/
+			void ChangePrecision(unsigned new_precision)
+			{
+				auto& A = std::get< SparseMat<mpfr> >(sparse_matrix_);
+				for (Eigen::Index kk = 0; kk < A.nonZeros(); ++kk)
+					A.valuePtr()[kk].precision(new_precision);
+
+				// Eigen gives no write access to a dense factorization, so it is made again, at its size, holding numbers of the new precision
+				auto& LU = std::get< Eigen::PartialPivLU<Mat<mpfr>> >(dense_LU_);
+				LU = Eigen::PartialPivLU<Mat<mpfr>>(LU.matrixLU().rows());
+
+				current_precision_ = new_precision;
+			}
+
+
+			/**
+			\brief Whether factorizations are sparse.
+			*/
+			bool IsSparse() const
+			{
+				return is_sparse_;
+			}
+
+			/**
+			\brief The number of entries in the sparsity pattern, if factorizations are sparse.
+			*/
+			std::size_t NumNonzeros() const
+			{
+				return static_cast<std::size_t>(std::get< SparseMat<dbl> >(sparse_matrix_).nonZeros());
+			}
+
+			unsigned MinSparseSize() const
+			{
+				return min_sparse_size_;
+			}
+
+			double MaxSparseDensity() const
+			{
+				return max_sparse_density_;
+			}
+
+			unsigned precision() const
+			{
+				return current_precision_;
+			}
+
+
+			/**
+			\brief Factor a Jacobian matrix.
+
+			\param J The Jacobian, evaluated densely.  If factoring sparsely, only the entries in the pattern are read.
+			\return Success, or the reason the factorization is unusable, from the diagonal of U.
+			*/
+			template<typename Derived>
+			MatrixSuccessCode Factor(Eigen::MatrixBase<Derived> const& J)
+			{
+				using T = typename Derived::Scalar;
+
+				++ThisThreadCounters().lu_factorizations;
+
+				if (!is_sparse_)
+				{
+					auto& LU = std::get< Eigen::PartialPivLU<Mat<T>> >(dense_LU_);
+					LU.compute(J);
+					return LUPartialPivotDecompositionSuccessful(LU.matrixLU());
+				}
+
+				auto& A = std::get< SparseMat<T> >(sparse_matrix_);
+				auto values = A.valuePtr();
+				auto outer = A.outerIndexPtr();
+				auto inner = A.innerIndexPtr();
+				for (Eigen::Index jj = 0; jj < A.cols(); ++jj)
+					for (auto kk = outer[jj]; kk < outer[jj+1]; ++kk)
+						values[kk] = J(inner[kk], jj);
+
+				auto& LU = std::get< std::unique_ptr<detail::CheckedSparseLU<SparseMat<T>>> >(sparse_LU_);
+				if (!LU)
+				{
+					LU.reset(new detail::CheckedSparseLU<SparseMat<T>>());
+					LU->analyzePattern(A);
+				}
+
+				LU->factorize(A);
+				if (LU->info() != Eigen::Success)
+					return MatrixSuccessCode::SmallValue;
+
+				return LUDiagonalSuccessful(LU->DiagonalOfU());
+			}
+
+
+			/**
+			\brief Solve with the most recent factorization of the same number type.
+			*/
+			template<typename Derived>
+			Vec<typename Derived::Scalar> Solve(Eigen::MatrixBase<Derived> const& b) const
+			{
+				using T = typename Derived::Scalar;
+
+				if (!is_sparse_)
+					return std::get< Eigen::PartialPivLU<Mat<T>> >(dense_LU_).solve(b);
+
+				auto const& LU = std::get< std::unique_ptr<detail::CheckedSparseLU<SparseMat<T>>> >(sparse_LU_);
+				assert(LU && "solving with a sparse factorization which has not been made");
+				return LU->solve(Vec<T>(b));
+			}
+
+			/**
+			\brief Solve with the most recent factorization of the same number type, into a given vector or column, which must already be the right size.
+
+			Dense solves this way make no allocations, so the predictors and correctors use it in every step.  The right hand side may not alias the result.
+			*/
+			template<typename DerivedX, typename DerivedB>
+			void SolveInPlace(Eigen::MatrixBase<DerivedX> const& x, Eigen::MatrixBase<DerivedB> const& b) const
+			{
+				using T = typename DerivedB::Scalar;
+				static_assert(std::is_same<typename DerivedX::Scalar, T>::value, "scalar types must match");
+
+				auto& result = const_cast<Eigen::MatrixBase<DerivedX>&>(x);
+
+				if (!is_sparse_)
+				{
+					result.noalias() = std::get< Eigen::PartialPivLU<Mat<T>> >(dense_LU_).solve(b);
+					return;
+				}
+
+				auto const& LU = std::get< std::unique_ptr<detail::CheckedSparseLU<SparseMat<T>>> >(sparse_LU_);
+				assert(LU && "solving with a sparse factorization which has not been made");
+				result = LU->solve(b);
+			}
+
+		private:
+
+			/**
+			\brief Make the sparse matrix for one number type, with the entries of the pattern in place, and compress it, so its values are in the order of the pattern.
+			*/
+			template<typename T>
+			void FillPattern(System const& S, std::vector<int> const& patch_of_column)
+			{
+				auto const& column_begin = S.JacobianColumnBegin();
+				auto const& rows = S.JacobianRows();
+				const auto num_functions = S.NumFunctions();
+				const auto num_cols = S.NumVariables();
+
+				auto& A = std::get< SparseMat<T> >(sparse_matrix_);
+				A.resize(S.NumTotalFunctions(), num_cols);
+
+				Eigen::VectorXi per_column(num_cols);
+				for (unsigned jj = 0; jj < num_cols; ++jj)
+					per_column(jj) = column_begin[jj+1] - column_begin[jj] + (patch_of_column[jj] >= 0);
+				A.reserve(per_column);
+
+				for (unsigned jj = 0; jj < num_cols; ++jj)
+				{
+					for (auto kk = column_begin[jj]; kk < column_begin[jj+1]; ++kk)
+						A.insert(rows[kk], jj) = T(1);
+					if (patch_of_column[jj] >= 0)
+						A.insert(num_functions + patch_of_column[jj], jj) = T(1);
+				}
+				A.makeCompressed();
+			}
+
+
+			unsigned min_sparse_size_;
+			double max_sparse_density_;
+			bool is_sparse_ = false;
+			unsigned current_precision_;
+
+			std::tuple< SparseMat<dbl>, SparseMat<mpfr> > sparse_matrix_; ///< the pattern, with the values of the most recent Jacobian, in compressed sparse column form
+			std::tuple< std::unique_ptr<detail::CheckedSparseLU<SparseMat<dbl>>>, std::unique_ptr<detail::CheckedSparseLU<SparseMat<mpfr>>> > sparse_LU_; ///< made, and the pattern analyzed, on first use after the system changes
+			std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > dense_LU_;
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -11,6 +11,7 @@
 
 #include "bertini2/trackers/amp_criteria.hpp"
 #include "bertini2/trackers/config.hpp"
+#include "bertini2/trackers/jacobian_solver.hpp"
 #include "bertini2/system/system.hpp"
 
 
@@ -84,8 +85,10 @@ namespace bertini{
 					Precision(std::get< Vec<mpfr> >(f_temp_), new_precision);
 					Precision(std::get< Vec<mpfr> >(step_temp_), new_precision);
 					Precision(std::get< Mat<mpfr> >(J_temp_), new_precision);
+					Precision(std::get< Vec<mpfr> >(random_rhs_), new_precision);
+					Precision(std::get< Vec<mpfr> >(random_solution_), new_precision);
 
-					std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr>>(numTotalFunctions_);
+					solver_.ChangePrecision(new_precision);
 
 					current_precision_ = new_precision;				
 				}
@@ -112,6 +115,19 @@ namespace bertini{
 					std::get< Vec<mpfr> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<dbl> >(step_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(step_temp_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(random_rhs_).resize(numVariables_);
+					std::get< Vec<mpfr> >(random_rhs_).resize(numVariables_);
+					std::get< Vec<dbl> >(random_solution_).resize(numVariables_);
+					std::get< Vec<mpfr> >(random_solution_).resize(numVariables_);
+					solver_.ChangeSystem(S);
+				}
+
+				/**
+				\brief Whether the Newton steps are solved with a sparse factorization of the Jacobian.  See JacobianSolver.
+				*/
+				bool UsesSparseJacobian() const
+				{
+					return solver_.IsSparse();
 				}
 
 				
@@ -221,12 +237,11 @@ namespace bertini{
 						next_space += step_ref;
 						
 						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 						
 						if ( (step_ref.template lpNorm<Eigen::Infinity>() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
 						
-						NumErrorT norm_J_inverse(LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm());
+						NumErrorT norm_J_inverse(NormJInverseEstimate<ComplexType>());
 
 						if (!amp::CriterionB<ComplexType>(NumErrorT(J_temp_ref.norm()), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, NumErrorT(step_ref.template lpNorm<Eigen::Infinity>()), AMP_config))
 							return SuccessCode::HigherPrecisionNecessary;
@@ -296,12 +311,11 @@ namespace bertini{
 						next_space += step_ref;
 						
 						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 						
 						
 						norm_delta_z = NumErrorT(step_ref.template lpNorm<Eigen::Infinity>());
 						norm_J = NumErrorT(J_temp_ref.norm());
-						norm_J_inverse = NumErrorT(LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm());
+						norm_J_inverse = NormJInverseEstimate<ComplexType>();
 						condition_number_estimate = NumErrorT(norm_J*norm_J_inverse);
 												
 						if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
@@ -344,22 +358,42 @@ namespace bertini{
 				{
 					Vec<ComplexType>& f_temp_ref = std::get< Vec<ComplexType> >(f_temp_);
 					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-					
-					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
 
-					S.SetAndReset<ComplexType>(current_space, current_time);
+					auto& counters = ThisThreadCounters();
+					++counters.newton_iterations;
+					++counters.function_evaluations;
+					++counters.jacobian_evaluations;
+
+					S.SetAndReset<ComplexType>(current_space.derived(), current_time);
 					S.EvalInPlace(f_temp_ref);
 					S.JacobianInPlace(J_temp_ref);
-					LU_ref = J_temp_ref.lu();
 					
-					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
+					if (solver_.Factor(J_temp_ref)!=MatrixSuccessCode::Success)
 						return SuccessCode::MatrixSolveFailure;
 					
-					newton_step = LU_ref.solve(-f_temp_ref);
+					f_temp_ref = -f_temp_ref;
+					solver_.SolveInPlace(newton_step, f_temp_ref);
 					
 					return SuccessCode::Success;
 					
 				}
+
+
+				/**
+				 \brief Estimate the norm of the inverse of the most recently factored Jacobian, as the norm of its solution with a random right hand side of units.
+
+				 The right hand side is drawn fresh each time, into storage kept with the corrector, as is the solution.
+				 */
+				template<typename ComplexType>
+				NumErrorT NormJInverseEstimate()
+				{
+					Vec<ComplexType>& randy = std::get< Vec<ComplexType> >(random_rhs_);
+					Vec<ComplexType>& soln = std::get< Vec<ComplexType> >(random_solution_);
+					for (unsigned ii = 0; ii < numVariables_; ++ii)
+						randy(ii) = RandomUnit<ComplexType>();
+					solver_.SolveInPlace(soln, randy);
+					return NumErrorT(soln.norm());
+				}
 				
 
 				
@@ -375,8 +409,10 @@ namespace bertini{
 				std::tuple< Vec<dbl>, Vec<mpfr> > f_temp_; // Variable to hold temporary evaluation of the system
 				std::tuple< Vec<dbl>, Vec<mpfr> > step_temp_; // Variable to hold temporary evaluation of the newton step
 				std::tuple< Mat<dbl>, Mat<mpfr> > J_temp_; // Variable to hold temporary evaluation of the Jacobian
+				std::tuple< Vec<dbl>, Vec<mpfr> > random_rhs_; // Random right hand side for estimating the norm of the inverse of the Jacobian
+				std::tuple< Vec<dbl>, Vec<mpfr> > random_solution_; // Solution with the random right hand side
 				
-				std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_; // The LU factorization from the Newton iterates
+				JacobianSolver solver_; // The factorization of the Jacobian from the Newton iterates, dense or sparse
 				
 				unsigned current_precision_;
 
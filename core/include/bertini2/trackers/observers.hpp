@@ -36,7 +36,8 @@
 #include "bertini2/detail/observer.hpp"
 
 #include "bertini2/trackers/base_tracker.hpp"
-#include "bertini2/logging.hpp"
+#include "bertini2/io/path_trace.hpp"
+#include "bertini2/async_logging.hpp"
 #include <boost/type_index.hpp>
 
 namespace bertini {
@@ -44,31 +45,37 @@ namespace bertini {
 	namespace tracking{
 
 
+		/**
+		\brief The type which emits the events of a tracker type.
+		*/
+		template<class TrackerT>
+		using EventEmitter = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+
 		template<class TrackerT>
-		class FirstPrecisionRecorder : public Observer<TrackerT>
+		class FirstPrecisionRecorder : public EventObserver<TrackerT, detail::TypeList<
+											TrackingStarted<EventEmitter<TrackerT>>,
+											PrecisionChanged<EventEmitter<TrackerT>> > >
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
 
-			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using EmitterT = EventEmitter<TrackerT>;
 
-			virtual void Observe(AnyEvent const& e) override
+			void Observe(TrackingStarted<EmitterT> const& e) override
 			{
-				if(auto p = dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
-				{
-					precision_increased_ = false;
-					starting_precision_ = p->Get().CurrentPrecision();
-				}
-				else if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
-				{
-					auto& t = p->Get();
-					auto next = p->Next();
-					if (next > p->Previous())
-					{
-						precision_increased_ = true;
-						next_precision_ = next;
-						time_of_first_increase_ = t.CurrentTime();
-						t.RemoveObserver(this);
-					}
+				precision_increased_ = false;
+				starting_precision_ = e.Get().CurrentPrecision();
+			}
 
+			void Observe(PrecisionChanged<EmitterT> const& e) override
+			{
+				auto& t = e.Get();
+				auto next = e.Next();
+				if (next > e.Previous())
+				{
+					precision_increased_ = true;
+					next_precision_ = next;
+					time_of_first_increase_ = t.CurrentTime();
+					t.RemoveObserver(this);
 				}
 			}
 
@@ -107,26 +114,26 @@ namespace bertini {
 
 
 		template<class TrackerT>
-		class MinMaxPrecisionRecorder : public Observer<TrackerT>
+		class MinMaxPrecisionRecorder : public EventObserver<TrackerT, detail::TypeList<
+											PrecisionChanged<EventEmitter<TrackerT>>,
+											TrackingStarted<EventEmitter<TrackerT>> > >
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
 
-			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using EmitterT = EventEmitter<TrackerT>;
 
-			virtual void Observe(AnyEvent const& e) override
+			void Observe(PrecisionChanged<EmitterT> const& e) override
 			{
-				if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
-				{
-					auto next_precision = p->Next();
-					if (next_precision < min_precision_)
-						min_precision_ = next_precision;
-					if (next_precision > max_precision_)
-						max_precision_ = next_precision;
-				}
-				else if(auto p = dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
-				{
-					min_precision_ = p->Get().CurrentPrecision();
-					max_precision_ = p->Get().CurrentPrecision();
-				}
+				auto next_precision = e.Next();
+				if (next_precision < min_precision_)
+					min_precision_ = next_precision;
+				if (next_precision > max_precision_)
+					max_precision_ = next_precision;
+			}
+
+			void Observe(TrackingStarted<EmitterT> const& e) override
+			{
+				min_precision_ = e.Get().CurrentPrecision();
+				max_precision_ = e.Get().CurrentPrecision();
 			}
 
 
@@ -158,18 +165,15 @@ namespace bertini {
 
 
 		template<class TrackerT>
-		class PrecisionAccumulator : public Observer<TrackerT>
+		class PrecisionAccumulator : public EventObserver<TrackerT, detail::TypeList<
+											TrackingEvent<EventEmitter<TrackerT>> > >
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
 
-			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using EmitterT = EventEmitter<TrackerT>;
 
-			virtual void Observe(AnyEvent const& e) override
+			void Observe(TrackingEvent<EmitterT> const& e) override
 			{
-				const TrackingEvent<EmitterT>* p = dynamic_cast<const TrackingEvent<EmitterT>*>(&e);
-				if (p)
-				{
-					precisions_.push_back(p->Get().CurrentPrecision());
-				}
+				precisions_.push_back(e.Get().CurrentPrecision());
 			}
 
 
@@ -188,18 +192,15 @@ namespace bertini {
 		PathAccumulator<AMPTracker> path_accumulator;
 		*/
 		template<class TrackerT, template<class> class EventT = SuccessfulStep>
-		class AMPPathAccumulator : public Observer<TrackerT>
+		class AMPPathAccumulator : public EventObserver<TrackerT, detail::TypeList<
+											EventT<EventEmitter<TrackerT>> > >
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
 
-			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using EmitterT = EventEmitter<TrackerT>;
 
-			virtual void Observe(AnyEvent const& e) override
+			void Observe(EventT<EmitterT> const& e) override
 			{
-				const EventT<EmitterT>* p = dynamic_cast<const EventT<EmitterT>*>(&e);
-				if (p)
-				{
-					path_.push_back(p->Get().CurrentPoint());
-				}
+				path_.push_back(e.Get().CurrentPoint());
 			}
 
 
@@ -216,131 +217,391 @@ namespace bertini {
 
 
 		template<class TrackerT>
-		class GoryDetailLogger : public Observer<TrackerT>
+		class GoryDetailLogger : public EventObserver<TrackerT, detail::TypeList<
+											Initializing<EventEmitter<TrackerT>,dbl>,
+											Initializing<EventEmitter<TrackerT>,mpfr>,
+											TrackingEnded<EventEmitter<TrackerT>>,
+											NewStep<EventEmitter<TrackerT>>,
+											SingularStartPoint<EventEmitter<TrackerT>>,
+											InfinitePathTruncation<EventEmitter<TrackerT>>,
+											SuccessfulStep<EventEmitter<TrackerT>>,
+											FailedStep<EventEmitter<TrackerT>>,
+											SuccessfulPredict<EventEmitter<TrackerT>,mpfr>,
+											SuccessfulPredict<EventEmitter<TrackerT>,dbl>,
+											SuccessfulCorrect<EventEmitter<TrackerT>,mpfr>,
+											SuccessfulCorrect<EventEmitter<TrackerT>,dbl>,
+											PredictorHigherPrecisionNecessary<EventEmitter<TrackerT>>,
+											CorrectorHigherPrecisionNecessary<EventEmitter<TrackerT>>,
+											CorrectorMatrixSolveFailure<EventEmitter<TrackerT>>,
+											PredictorMatrixSolveFailure<EventEmitter<TrackerT>>,
+											FirstStepPredictorMatrixSolveFailure<EventEmitter<TrackerT>>,
+											PrecisionChanged<EventEmitter<TrackerT>>,
+											TrackingEvent<EventEmitter<TrackerT>> > >
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
 		public:
 
-			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			using EmitterT = EventEmitter<TrackerT>;
 
-			virtual void Observe(AnyEvent const& e) override
+			void Observe(Initializing<EmitterT,dbl> const& e) override
 			{
+				BERTINI_LOG_DEBUG(async_logging::categories::Tracking(), std::setprecision(e.Get().GetSystem().precision()),
+					"initializing in double, tracking path\nfrom\tt = ",
+					e.StartTime(), "\nto\tt = ", e.EndTime(),
+					"\n from\tx = \n", e.StartPoint(),
+					"\n tracking system ", async_logging::FormatNow(e.Get().GetSystem()), "\n\n");
+			}
 
+			void Observe(Initializing<EmitterT,mpfr> const& e) override
+			{
+				BERTINI_LOG_DEBUG(async_logging::categories::Tracking(), std::setprecision(e.Get().GetSystem().precision()),
+					"initializing in multiprecision, tracking path\nfrom\tt = ", e.StartTime(), "\nto\tt = ", e.EndTime(), "\n from\tx = \n", e.StartPoint(),
+					"\n tracking system ", async_logging::FormatNow(e.Get().GetSystem()), "\n\n");
+			}
 
-				if (auto p = dynamic_cast<const Initializing<EmitterT,dbl>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::debug) << std::setprecision(p->Get().GetSystem().precision())
-						<< "initializing in double, tracking path\nfrom\tt = "
-						<< p->StartTime() << "\nto\tt = " << p->EndTime()
-						<< "\n from\tx = \n" << p->StartPoint()
-						<< "\n tracking system " << p->Get().GetSystem() << "\n\n";
-				}
-				else if (auto p = dynamic_cast<const Initializing<EmitterT,mpfr>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::debug) << std::setprecision(p->Get().GetSystem().precision())
-						 << "initializing in multiprecision, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint()
-						<< "\n tracking system " << p->Get().GetSystem() << "\n\n";
-				}
+			void Observe(TrackingEnded<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "tracking ended");
+			}
 
-				else if(auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking ended";
+			void Observe(NewStep<EmitterT> const& e) override
+			{
+				auto& t = e.Get();
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "Tracker iteration ", t.NumTotalStepsTaken(), "\ncurrent precision: ", t.CurrentPrecision());
 
-				else if (auto p = dynamic_cast<const NewStep<EmitterT>*>(&e))
-				{
-					auto& t = p->Get();
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Tracker iteration " << t.NumTotalStepsTaken() << "\ncurrent precision: " << t.CurrentPrecision();
 
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), std::setprecision(t.CurrentPrecision()),
+					"t = ", t.CurrentTime(),
+					"\ncurrent stepsize: ", t.CurrentStepsize(),
+					"\ndelta_t = ", t.DeltaT(),
+					"\ncurrent x size = ", t.CurrentPoint().size(),
+					"\ncurrent x = ", t.CurrentPoint());
+			}
 
-					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(t.CurrentPrecision())
-						<< "t = " << t.CurrentTime()
-						<< "\ncurrent stepsize: " << t.CurrentStepsize()
-						<< "\ndelta_t = " << t.DeltaT() 
-						<< "\ncurrent x size = " << t.CurrentPoint().size()
-						<< "\ncurrent x = " << t.CurrentPoint();
-				}
 
 
+			void Observe(SingularStartPoint<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "singular start point");
+			}
 
-				else if (auto p = dynamic_cast<const SingularStartPoint<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "singular start point";
-				else if (auto p = dynamic_cast<const InfinitePathTruncation<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration indicated going to infinity, truncated path";
+			void Observe(InfinitePathTruncation<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "tracker iteration indicated going to infinity, truncated path");
+			}
 
 
 
 
-				else if (auto p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration successful\n\n\n";
-				}
+			void Observe(SuccessfulStep<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "tracker iteration successful\n\n\n");
+			}
 
-				else if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration unsuccessful\n\n\n";
-				}
+			void Observe(FailedStep<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "tracker iteration unsuccessful\n\n\n");
+			}
 
 
 
 
 
 
-				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,mpfr>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "prediction successful (mpfr), result:\n" << p->ResultingPoint();
-				}
-				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,dbl>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "prediction successful (dbl), result:\n" << p->ResultingPoint();
-				}
+			void Observe(SuccessfulPredict<EmitterT,mpfr> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), std::setprecision(Precision(e.ResultingPoint())), "prediction successful (mpfr), result:\n", e.ResultingPoint());
+			}
 
-				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,mpfr>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "correction successful (mpfr), result:\n" << p->ResultingPoint();
-				}
-				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,dbl>*>(&e))
-				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << std::setprecision(Precision(p->ResultingPoint())) << "correction successful (dbl), result:\n" << p->ResultingPoint();
-				}
+			void Observe(SuccessfulPredict<EmitterT,dbl> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), std::setprecision(Precision(e.ResultingPoint())), "prediction successful (dbl), result:\n", e.ResultingPoint());
+			}
+
+			void Observe(SuccessfulCorrect<EmitterT,mpfr> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), std::setprecision(Precision(e.ResultingPoint())), "correction successful (mpfr), result:\n", e.ResultingPoint());
+			}
+
+			void Observe(SuccessfulCorrect<EmitterT,dbl> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), std::setprecision(Precision(e.ResultingPoint())), "correction successful (dbl), result:\n", e.ResultingPoint());
+			}
+
+
+			void Observe(PredictorHigherPrecisionNecessary<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "Predictor, higher precision necessary");
+			}
+
+			void Observe(CorrectorHigherPrecisionNecessary<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "corrector, higher precision necessary");
+			}
+
+
+
+			void Observe(CorrectorMatrixSolveFailure<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "corrector, matrix solve failure or failure to converge");
+			}
+
+			void Observe(PredictorMatrixSolveFailure<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "predictor, matrix solve failure or failure to converge");
+			}
+
+			void Observe(FirstStepPredictorMatrixSolveFailure<EmitterT> const& e) override
+			{
+				BERTINI_LOG_TRACE(async_logging::categories::Tracking(), "Predictor, matrix solve failure in initial solve of prediction");
+			}
+
+
+			void Observe(PrecisionChanged<EmitterT> const& e) override
+			{
+				BERTINI_LOG_DEBUG(async_logging::categories::Tracking(), "changing precision from ", e.Previous(), " to ", e.Next());
+			}
+
+			void Observe(TrackingEvent<EmitterT> const& e) override
+			{
+				BERTINI_LOG_DEBUG(async_logging::categories::Tracking(), "unlogged event, of type: ", boost::typeindex::type_id_runtime(e).pretty_name());
+			}
+
+		};
+
+
+
+		template<class TrackerT>
+		class StepFailScreenPrinter : public EventObserver<TrackerT, detail::TypeList<
+											FailedStep<EventEmitter<TrackerT>> > >
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+		public:
+
+			using EmitterT = EventEmitter<TrackerT>;
+
+			void Observe(FailedStep<EmitterT> const& e) override
+			{
+				std::cout << "observed step failure" << std::endl;
+			}
+
+		};
+
+
+
+		/**
+		\brief Turns the events of a tracker into trace records, and hands them to the derived class.
+
+		Subscribes to the start and end of tracking, steps, precision changes, and failures.  Each record is the state of the tracker at the event, labelled with ThisThreadPathIndex().
+		*/
+		template<class TrackerT>
+		class TraceObserver : public EventObserver<TrackerT, detail::TypeList<
+											Initializing<EventEmitter<TrackerT>,dbl>,
+											Initializing<EventEmitter<TrackerT>,mpfr>,
+											SuccessfulStep<EventEmitter<TrackerT>>,
+											FailedStep<EventEmitter<TrackerT>>,
+											PrecisionChanged<EventEmitter<TrackerT>>,
+											HigherPrecisionNecessary<EventEmitter<TrackerT>>,
+											MatrixSolveFailure<EventEmitter<TrackerT>>,
+											SingularStartPoint<EventEmitter<TrackerT>>,
+											InfinitePathTruncation<EventEmitter<TrackerT>>,
+											TrackingEnded<EventEmitter<TrackerT>> > >
+		{
+		public:
+
+			using EmitterT = EventEmitter<TrackerT>;
+
+			void Observe(Initializing<EmitterT,dbl> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::PathStarted)); }
+
+			void Observe(Initializing<EmitterT,mpfr> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::PathStarted)); }
+
+			void Observe(SuccessfulStep<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::SuccessfulStep)); }
+
+			void Observe(FailedStep<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::FailedStep)); }
+
+			void Observe(PrecisionChanged<EmitterT> const& e) override
+			{
+				auto r = MakeRecord(e.Get(), trace::EventCode::PrecisionChanged);
+				r.precision = static_cast<std::uint16_t>(e.Next());
+				Take(r);
+			}
+
+			void Observe(HigherPrecisionNecessary<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::HigherPrecisionNecessary)); }
+
+			void Observe(MatrixSolveFailure<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::MatrixSolveFailure)); }
+
+			void Observe(SingularStartPoint<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::SingularStartPoint)); }
+
+			void Observe(InfinitePathTruncation<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::InfinitePathTruncation)); }
+
+			void Observe(TrackingEnded<EmitterT> const& e) override
+			{ Take(MakeRecord(e.Get(), trace::EventCode::PathEnded)); }
+
+		protected:
+
+			virtual
+			void Take(trace::Record const& r) = 0;
+
+			virtual
+			std::int64_t Nanoseconds() const
+			{
+				return 0;
+			}
+
+		private:
 
+			trace::Record MakeRecord(EmitterT const& t, trace::EventCode event) const
+			{
+				trace::Record r;
+				const auto time = t.CurrentTime();
+				r.path = ThisThreadPathIndex();
+				r.nanoseconds = Nanoseconds();
+				r.time_real = static_cast<double>(time.real());
+				r.time_imag = static_cast<double>(time.imag());
+				r.stepsize = static_cast<double>(t.CurrentStepsize());
+				r.residual = t.LatestNormOfStep();
+				r.condition_number = t.LatestConditionNumber();
+				r.step = static_cast<std::uint32_t>(t.NumTotalStepsTaken());
+				r.precision = static_cast<std::uint16_t>(t.CurrentPrecision());
+				r.event = event;
+				r.thread = 0;
+				return r;
+			}
+		};
 
-				else if (auto p = dynamic_cast<const PredictorHigherPrecisionNecessary<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, higher precision necessary";
-				else if (auto p = dynamic_cast<const CorrectorHigherPrecisionNecessary<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, higher precision necessary";
 
 
+		/**
+		\brief Records the tracking of paths into a binary trace, cheaply enough to leave on for a whole run.
+
+		Each record is a 64-byte copy into a lock-free ring buffer; a trace::Writer writes the rings to disk from its own thread.  Attach one recorder to each tracker, and so to each tracking thread, all sharing one writer.
+
+		\code
+		trace::Writer writer("paths.b2trace");
+		TraceRecorder<AMPTracker> recorder(writer);
+		tracker.AddObserver(&recorder);
+		\endcode
+
+		\see trace::ReadTrace, TraceReplayer, and the b2_trace program.
+		*/
+		template<class TrackerT>
+		class TraceRecorder : public TraceObserver<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+		public:
 
-				else if (auto p = dynamic_cast<const CorrectorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, matrix solve failure or failure to converge";
-				else if (auto p = dynamic_cast<const PredictorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "predictor, matrix solve failure or failure to converge";
-				else if (auto p = dynamic_cast<const FirstStepPredictorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, matrix solve failure in initial solve of prediction";
+			explicit
+			TraceRecorder(trace::Writer & writer) : ring_(writer.NewRing())
+			{}
 
+		private:
 
-				else if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "changing precision from " << p->Previous() << " to " << p->Next();
+			void Take(trace::Record const& r) override
+			{
+				ring_->Push(r);
+			}
 
-				else
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "unlogged event, of type: " << boost::typeindex::type_id_runtime(e).pretty_name();
+			std::int64_t Nanoseconds() const override
+			{
+				return ring_->Nanoseconds();
 			}
 
+			std::shared_ptr<trace::Ring> ring_; ///< the recorder holds no reference to the writer, so may outlive it, its records then being dropped
 		};
 
 
 
+		/**
+		\brief Checks a re-run of a path against its trace, step by step, and finds where they first differ.
+
+		Feed it the records of one path, from trace::PathRecords, then track the path again from the same start point, on the same homotopy, with the same settings, with this observer attached.  Traces don't record the start point or the homotopy, random gamma included, so you must keep them from the traced run; a re-run from anything else diverges at the first record.  A run which reproduces the trace matches in event, step number, precision, time, and stepsize, all exactly; the residual and condition number are not compared, as condition number estimates use random vectors.  The first mismatch, or the first record the re-run didn't reach, is kept.
+
+		\code
+		auto path = trace::PathRecords(trace::ReadTrace("paths.b2trace"), 1234);
+		TraceReplayer<AMPTracker> replayer(path);
+		tracker.AddObserver(&replayer);
+		tracker.TrackPath(result, t_start, t_end, start_point);
+		if (!replayer.Reproduced())
+			std::cout << "diverged at record " << replayer.DivergedAt() << '\n';
+		\endcode
+		*/
 		template<class TrackerT>
-		class StepFailScreenPrinter : public Observer<TrackerT>
+		class TraceReplayer : public TraceObserver<TrackerT>
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
 		public:
 
-			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+			explicit
+			TraceReplayer(std::vector<trace::Record> expected) : expected_(std::move(expected))
+			{}
+
+			/**
+			\brief Whether every record seen so far matched, and every expected record has been seen.
+			*/
+			bool Reproduced() const
+			{
+				return !diverged_ && num_seen_ == expected_.size();
+			}
+
+			bool Diverged() const
+			{
+				return diverged_;
+			}
+
+			/**
+			\brief The index in the expected records of the first mismatch.  If the re-run ended early, the number of records it made.
+			*/
+			std::size_t DivergedAt() const
+			{
+				return diverged_ ? diverged_at_ : num_seen_;
+			}
+
+			/**
+			\brief The record the re-run made at the first mismatch.  Only meaningful if Diverged().
+			*/
+			trace::Record const& Actual() const
+			{
+				return actual_;
+			}
+
+			std::vector<trace::Record> const& Expected() const
+			{
+				return expected_;
+			}
+
+		private:
+
+			void Take(trace::Record const& r) override
+			{
+				if (diverged_)
+					return;
+
+				if (num_seen_ >= expected_.size() || !Matches(expected_[num_seen_], r))
+				{
+					diverged_ = true;
+					diverged_at_ = num_seen_;
+					actual_ = r;
+					return;
+				}
+				++num_seen_;
+			}
 
-			virtual void Observe(AnyEvent const& e) override
+			static
+			bool Matches(trace::Record const& a, trace::Record const& b)
 			{
-				if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
-					std::cout << "observed step failure" << std::endl;
+				return a.event==b.event && a.step==b.step && a.precision==b.precision
+					&& a.time_real==b.time_real && a.time_imag==b.time_imag && a.stepsize==b.stepsize;
 			}
 
+			std::vector<trace::Record> expected_;
+			std::size_t num_seen_ = 0;
+			bool diverged_ = false;
+			std::size_t diverged_at_ = 0;
+			trace::Record actual_{};
 		};
 
 	} //re: namespace tracking
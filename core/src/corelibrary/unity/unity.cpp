@@ -12,6 +12,8 @@
 #include "src/function_tree/roots/function.cpp"
 #include "src/function_tree/roots/jacobian.cpp"
 
+#include "src/function_tree/simplify.cpp"
+
 #include "src/function_tree/symbols/differential.cpp"
 #include "src/function_tree/symbols/number.cpp"
 #include "src/function_tree/symbols/special_number.cpp"
@@ -22,6 +24,8 @@
 #include "src/parallel/parallel.cpp"
 
 
+#include "src/system/homotopy_cache.cpp"
+#include "src/system/polynomial_table.cpp"
 #include "src/system/precon.cpp"
 #include "src/system/slice.cpp"
 #include "src/system/start_base.cpp"
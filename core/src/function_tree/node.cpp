@@ -26,6 +26,8 @@
 
 #include "function_tree.hpp"
 
+#include <type_traits>
+
 BOOST_CLASS_EXPORT(bertini::node::Variable)
 BOOST_CLASS_EXPORT(bertini::node::Differential)
 
@@ -66,9 +68,58 @@ namespace node{
 	}
 
 
+	void Node::TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f)
+	{}
+
+
+	std::string Node::LocalData() const
+	{
+		return std::string();
+	}
+
+
+
+	void Node::ResetDependentOn(Dependency changed) const
+	{
+		if (Intersects(dependency_, changed))
+			Reset();
+	}
+
+
+
+	Dependency TagDependencies(std::shared_ptr<Node> const& n, std::shared_ptr<Variable> const& path_variable, std::unordered_set<Node const*> & visited)
+	{
+		if (!visited.insert(n.get()).second)
+			return n->dependency_;
+
+		auto d = Dependency::None;
+		bool have_children = false;
+		n->TransformChildren([&](std::shared_ptr<Node> const& c)
+			{
+				have_children = true;
+				d = d | TagDependencies(c, path_variable, visited);
+				return c;
+			});
+
+		if (!have_children)
+		{
+			if (auto v = std::dynamic_pointer_cast<Variable>(n))
+				d = (v==path_variable) ? Dependency::Time : Dependency::Space;
+			else if (std::dynamic_pointer_cast<Differential>(n))
+				d = Dependency::All;
+		}
+
+		n->dependency_ = d;
+		return d;
+	}
+
+
 	template<typename T>
 	void Node::EvalInPlace(T& eval_value, std::shared_ptr<Variable> const& diff_variable) const
 	{
+		if (std::is_same<T,mpfr>::value)
+			MatchWorkingPrecision();
+
 		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
 		if(!val_pair.second)
 		{
@@ -102,6 +153,20 @@ namespace node{
 		std::get< std::pair<mpfr,bool> >(current_value_).second = false;
 	}
 
+	void Node::MatchWorkingPrecision() const
+	{
+		const auto prec = WorkingPrecision();
+		if (prec && precision() != prec)
+			MatchPrecision(prec);
+	}
+
+	void Node::MatchPrecision(unsigned prec) const
+	{
+		auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
+		val_pair.first.precision(prec);
+		val_pair.second = false;
+	}
+
 	Node::Node()
 	{
 		std::get<std::pair<dbl,bool> >(current_value_).second = false;
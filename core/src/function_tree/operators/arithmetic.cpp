@@ -154,6 +154,15 @@ unsigned SumOperator::ReduceSubMults()
 }
 
 
+std::string SumOperator::LocalData() const
+{
+	std::string signs;
+	for (auto iter : children_sign_)
+		signs.push_back(iter ? '+' : '-');
+	return signs;
+}
+
+
 unsigned SumOperator::ReduceDepth()
 {
 	auto num_eliminated = ReduceSubSums() + ReduceSubMults();
@@ -677,6 +686,15 @@ unsigned MultOperator::ReduceSubMults()
 }
 
 
+std::string MultOperator::LocalData() const
+{
+	std::string ops;
+	for (auto iter : children_mult_or_div_)
+		ops.push_back(iter ? '*' : '/');
+	return ops;
+}
+
+
 unsigned MultOperator::ReduceDepth()
 {
 	auto num_eliminated = ReduceSubSums() + ReduceSubMults();
@@ -928,6 +946,13 @@ void MultOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable
 /////////////////
 
 
+void PowerOperator::TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f)
+{
+	base_ = f(base_);
+	exponent_ = f(exponent_);
+}
+
+
 unsigned PowerOperator::EliminateZeros()
 {
 	return 0;
@@ -945,6 +970,17 @@ void PowerOperator::Reset() const
 	exponent_->Reset();
 }
 
+
+void PowerOperator::ResetDependentOn(Dependency changed) const
+{
+	if (!Intersects(dependency_, changed))
+		return;
+
+	Node::ResetStoredValues();
+	base_->ResetDependentOn(changed);
+	exponent_->ResetDependentOn(changed);
+}
+
 void PowerOperator::print(std::ostream & target) const
 {
 	target << "(" << *base_ << ")^(" << *exponent_ << ")";
@@ -1125,6 +1161,12 @@ void PowerOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variabl
 //
 ////////////////////
 
+std::string IntegerPowerOperator::LocalData() const
+{
+	return std::to_string(exponent_);
+}
+
+
 unsigned IntegerPowerOperator::EliminateZeros()
 {
 	return 0;
@@ -36,12 +36,28 @@ void UnaryOperator::Reset() const
 	child_->Reset();
 }
 
+
+void UnaryOperator::ResetDependentOn(Dependency changed) const
+{
+	if (!Intersects(dependency_, changed))
+		return;
+
+	Node::ResetStoredValues();
+	child_->ResetDependentOn(changed);
+}
+
 void UnaryOperator::SetChild(std::shared_ptr<Node> new_child)
 {
 	child_ = new_child;
 }
 
 
+void UnaryOperator::TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f)
+{
+	child_ = f(child_);
+}
+
+
 //Return the only child for the unary operator
 std::shared_ptr<Node> UnaryOperator::first_child() const
 {
@@ -123,6 +139,7 @@ void UnaryOperator::precision(unsigned int prec) const
 {
 	auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
 	val_pair.first.precision(prec);
+	val_pair.second = false; // constant nodes are skipped by ResetDependentOn, so make them re-evaluate at the new precision
 
 	child_->precision(prec);
 }
@@ -143,6 +160,17 @@ void NaryOperator::Reset() const
 
 }
 
+
+void NaryOperator::ResetDependentOn(Dependency changed) const
+{
+	if (!Intersects(dependency_, changed))
+		return;
+
+	Node::ResetStoredValues();
+	for (const auto& ii : children_)
+		ii->ResetDependentOn(changed);
+}
+
 // Add a child onto the container for this operator
 void NaryOperator::AddChild(std::shared_ptr<Node> child)
 {
@@ -150,6 +178,13 @@ void NaryOperator::AddChild(std::shared_ptr<Node> child)
 }
 
 
+void NaryOperator::TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f)
+{
+	for (auto& iter : children_)
+		iter = f(iter);
+}
+
+
 
 
 
@@ -176,6 +211,7 @@ void NaryOperator::precision(unsigned int prec) const
 {
 	auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
 	val_pair.first.precision(prec);
+	val_pair.second = false;
 	
 	this->PrecisionChangeSpecific(prec);
 
@@ -188,5 +224,12 @@ void NaryOperator::PrecisionChangeSpecific(unsigned prec) const
 {}
 
 
+void NaryOperator::MatchPrecision(unsigned prec) const
+{
+	Node::MatchPrecision(prec);
+	this->PrecisionChangeSpecific(prec);
+}
+
+
 } // re: namespace node	
 } // re: bertini namespace
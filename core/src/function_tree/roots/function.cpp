@@ -26,6 +26,8 @@
 
 #include "function_tree/roots/jacobian.hpp"
 
+#include <sstream>
+
 
 
 
@@ -61,11 +63,38 @@ void Function::Reset() const
 	entry_node_->Reset();
 }
 
+
+void Function::ResetDependentOn(Dependency changed) const
+{
+	EnsureNotEmpty();
+
+	if (!Intersects(dependency_, changed))
+		return;
+
+	Node::ResetStoredValues();
+	entry_node_->ResetDependentOn(changed);
+}
+
 void Function::SetRoot(std::shared_ptr<Node> const& entry)
 {
 	entry_node_ = entry;
 }
 
+
+void Function::TransformChildren(std::function<std::shared_ptr<Node>(std::shared_ptr<Node> const&)> const& f)
+{
+	EnsureNotEmpty();
+	entry_node_ = f(entry_node_);
+}
+
+
+std::string Function::LocalData() const
+{
+	std::stringstream ss;
+	ss << static_cast<void const*>(this);
+	return ss.str();
+}
+
 void Function::EnsureNotEmpty() const
 {
 	if (entry_node_==nullptr)
@@ -136,6 +165,7 @@ void Function::precision(unsigned int prec) const
 		return;
 	else{
 		val_pair.first.precision(prec);
+		val_pair.second = false;
 		entry_node_->precision(prec);
 	}
 	
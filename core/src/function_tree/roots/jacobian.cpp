@@ -26,6 +26,8 @@
 
 #include "function_tree/roots/jacobian.hpp"
 
+#include <type_traits>
+
 
 
 
@@ -42,6 +44,9 @@ Jacobian::Jacobian(const std::shared_ptr<Node> & entry) : Function(entry)
 template<typename T>
 T Jacobian::EvalJ(std::shared_ptr<Variable> const& diff_variable) const
 {
+		if (std::is_same<T,mpfr>::value)
+			MatchWorkingPrecision();
+
 		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
 
 		if(diff_variable == current_diff_variable_ && val_pair.second)
@@ -64,6 +69,9 @@ template mpfr Jacobian::EvalJ(std::shared_ptr<Variable> const& diff_variable) co
 template<typename T>
 void Jacobian::EvalJInPlace(T& eval_value, std::shared_ptr<Variable> const& diff_variable) const
 {
+		if (std::is_same<T,mpfr>::value)
+			MatchWorkingPrecision();
+
 		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
 
 		if(diff_variable == current_diff_variable_ && val_pair.second)
@@ -30,6 +30,9 @@
 
 
 #include "bertini2/function_tree/simplify.hpp"
+#include "bertini2/function_tree.hpp"
+
+#include <boost/functional/hash.hpp>
 
 namespace bertini {
 
@@ -39,14 +42,18 @@ unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n)
 	unsigned num_ones = 0;
 	unsigned num_zeros = 0;
 
+	unsigned num_folds = 0;
+
+	num_folds = FoldConstants(n);
 	num_reductions = n->ReduceDepth();
 	num_ones = n->EliminateOnes();
 	num_zeros = n->EliminateZeros();
 
 	unsigned num_rounds{0};
-	while (num_reductions || num_ones || num_zeros)
+	while (num_reductions || num_ones || num_zeros || num_folds)
 	{
 		++num_rounds;
+		num_folds = FoldConstants(n);
 		num_reductions = n->ReduceDepth();
 		num_ones = n->EliminateOnes();
 		num_zeros = n->EliminateZeros();
@@ -54,5 +61,285 @@ unsigned Simplify(std::shared_ptr<bertini::node::Node> const& n)
 	return num_rounds;
 }
 
+
+
+
+std::size_t SubexpressionMerger::KeyHash::operator()(Key const& k) const
+{
+	std::size_t seed = k.type.hash_code();
+	boost::hash_combine(seed, k.local_data);
+	for (auto c : k.children)
+		boost::hash_combine(seed, c);
+	return seed;
+}
+
+
+
+std::shared_ptr<node::Node> SubexpressionMerger::Representative(std::shared_ptr<node::Node> const& n)
+{
+	auto found = seen_.find(n.get());
+	if (found != seen_.end())
+		return found->second;
+
+	std::vector<node::Node const*> children;
+	n->TransformChildren([&](std::shared_ptr<node::Node> const& c)
+		{
+			auto r = Representative(c);
+			children.push_back(r.get());
+			return r;
+		});
+
+	Key key{std::type_index(typeid(*n)), n->LocalData(), std::move(children)};
+	auto inserted = unique_.emplace(std::move(key), n);
+
+	auto const& rep = inserted.first->second;
+	seen_.emplace(n.get(), rep);
+	return rep;
+}
+
+
+
+void SubexpressionMerger::Merge(std::shared_ptr<node::Node> & root)
+{
+	root = Representative(root);
+}
+
+
+
+void SubexpressionMerger::MergeBelow(std::shared_ptr<node::Node> const& root)
+{
+	if (seen_.find(root.get()) != seen_.end())
+		return;
+
+	root->TransformChildren([this](std::shared_ptr<node::Node> const& c)
+		{
+			return Representative(c);
+		});
+
+	seen_.emplace(root.get(), root);
+	++num_kept_roots_;
+}
+
+
+
+NodeCounts MergeCommonSubexpressions(std::vector<std::shared_ptr<node::Node>> & roots)
+{
+	SubexpressionMerger merger;
+	for (auto& iter : roots)
+		merger.Merge(iter);
+	return merger.Counts();
+}
+
+
+
+
+std::shared_ptr<node::Node> ConstantFolder::Folded(std::shared_ptr<node::Node> const& n)
+{
+	auto found = seen_.find(n.get());
+	if (found != seen_.end())
+		return found->second;
+
+	n->TransformChildren([this](std::shared_ptr<node::Node> const& c)
+		{
+			return Folded(c);
+		});
+
+	auto replacement = n;
+	Exact value;
+	if (ExactValue(n, value))
+	{
+		if (!std::dynamic_pointer_cast<node::Number>(n)) // numbers are already as folded as they get
+		{
+			if (value.imag==0 && denominator(value.real)==1)
+				replacement = MakeInteger(mpz_int(numerator(value.real)));
+			else
+				replacement = MakeRational(value.real, value.imag);
+			++num_folded_;
+		}
+		exact_.emplace(replacement.get(), std::move(value));
+	}
+
+	seen_.emplace(n.get(), replacement);
+	return replacement;
+}
+
+
+
+bool ConstantFolder::ExactValue(std::shared_ptr<node::Node> const& n, Exact & value) const
+{
+	using namespace node;
+
+	if (auto i = std::dynamic_pointer_cast<Integer>(n))
+	{
+		value.real = mpq_rational(i->value());
+		value.imag = 0;
+		return true;
+	}
+
+	if (auto r = std::dynamic_pointer_cast<Rational>(n))
+	{
+		value.real = r->real_value();
+		value.imag = r->imag_value();
+		return true;
+	}
+
+	auto exact_child = [this](std::shared_ptr<Node> const& c) -> Exact const*
+	{
+		auto found = exact_.find(c.get());
+		return found==exact_.end() ? nullptr : &found->second;
+	};
+
+	if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+	{
+		value.real = 0; value.imag = 0;
+		for (std::size_t ii = 0; ii < s->children().size(); ++ii)
+		{
+			auto c = exact_child(s->children()[ii]);
+			if (!c)
+				return false;
+
+			if (s->children_signs()[ii])
+			{
+				value.real += c->real; value.imag += c->imag;
+			}
+			else
+			{
+				value.real -= c->real; value.imag -= c->imag;
+			}
+		}
+		return true;
+	}
+
+	if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+	{
+		value.real = 1; value.imag = 0;
+		for (std::size_t ii = 0; ii < m->children().size(); ++ii)
+		{
+			auto c = exact_child(m->children()[ii]);
+			if (!c)
+				return false;
+
+			auto factor = *c;
+			if (!m->children_mult_or_div()[ii] && !Invert(factor))
+				return false;
+			value = Times(value, factor);
+		}
+		return true;
+	}
+
+	if (auto neg = std::dynamic_pointer_cast<NegateOperator>(n))
+	{
+		auto c = exact_child(neg->first_child());
+		if (!c)
+			return false;
+		value.real = -c->real; value.imag = -c->imag;
+		return true;
+	}
+
+	if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+	{
+		auto c = exact_child(p->first_child());
+		if (!c)
+			return false;
+		value = *c;
+		return RaiseTo(value, p->exponent());
+	}
+
+	if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+	{
+		auto b = exact_child(p->base());
+		auto e = exact_child(p->exponent());
+		if (!b || !e || e->imag!=0 || denominator(e->real)!=1)
+			return false;
+
+		const auto k = numerator(e->real);
+		if (abs(k) > MaxExactExponent())
+			return false;
+
+		value = *b;
+		return RaiseTo(value, k.convert_to<int>());
+	}
+
+	return false;
+}
+
+
+
+ConstantFolder::Exact ConstantFolder::Times(Exact const& a, Exact const& b)
+{
+	return Exact{a.real*b.real - a.imag*b.imag, a.real*b.imag + a.imag*b.real};
+}
+
+
+
+bool ConstantFolder::Invert(Exact & a)
+{
+	mpq_rational norm_squared = a.real*a.real + a.imag*a.imag;
+	if (norm_squared==0)
+		return false;
+
+	a.real /= norm_squared;
+	a.imag = -a.imag/norm_squared;
+	return true;
+}
+
+
+
+bool ConstantFolder::RaiseTo(Exact & a, int exponent)
+{
+	if (exponent > MaxExactExponent() || exponent < -MaxExactExponent())
+		return false;
+
+	if (exponent < 0)
+	{
+		if (!Invert(a))
+			return false;
+		exponent = -exponent;
+	}
+
+	Exact result{1,0};
+	while (exponent)
+	{
+		if (exponent & 1)
+			result = Times(result, a);
+		exponent >>= 1;
+		if (exponent)
+			a = Times(a, a);
+	}
+	a = std::move(result);
+	return true;
+}
+
+
+
+void ConstantFolder::Fold(std::shared_ptr<node::Node> & root)
+{
+	root = Folded(root);
+}
+
+
+
+void ConstantFolder::FoldBelow(std::shared_ptr<node::Node> const& root)
+{
+	if (seen_.find(root.get()) != seen_.end())
+		return;
+
+	root->TransformChildren([this](std::shared_ptr<node::Node> const& c)
+		{
+			return Folded(c);
+		});
+
+	seen_.emplace(root.get(), root);
+}
+
+
+
+unsigned FoldConstants(std::shared_ptr<node::Node> const& n)
+{
+	ConstantFolder folder;
+	folder.FoldBelow(n);
+	return folder.NumFolded();
+}
+
 } // namespace bertini
 
@@ -26,6 +26,8 @@
 
 #include "function_tree/symbols/differential.hpp"
 
+#include <sstream>
+
 
 
 
@@ -52,6 +54,14 @@ void Differential::print(std::ostream & target) const
 }
 
 
+std::string Differential::LocalData() const
+{
+	std::stringstream ss;
+	ss << static_cast<void const*>(differential_variable_.get());
+	return ss.str();
+}
+
+
 std::shared_ptr<Node> Differential::Differentiate(std::shared_ptr<Variable> const& v) const
 {
 	throw std::runtime_error("differentiating a differential is not correctly implemented yet");
@@ -64,6 +64,11 @@ void Integer::print(std::ostream & target) const
 	target << true_value_;
 }
 
+std::string Integer::LocalData() const
+{
+	return true_value_.str();
+}
+
 // Return value of constant
 dbl Integer::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
 {
@@ -99,6 +104,11 @@ void Float::print(std::ostream & target) const
 	target << highest_precision_value_;
 }
 
+std::string Float::LocalData() const
+{
+	return highest_precision_value_.real().str(0, std::ios_base::scientific) + "," + highest_precision_value_.imag().str(0, std::ios_base::scientific);
+}
+
 // Return value of constant
 dbl Float::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
 {
@@ -111,14 +121,21 @@ void Float::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const&
 }
 
 
+mpfr Float::Round(unsigned prec) const
+{
+	mpfr rounded(highest_precision_value_);
+	rounded.precision(prec);
+	return rounded;
+}
+
 mpfr Float::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
 {
-	return mpfr(highest_precision_value_);
+	return RoundedTo(Node::precision(), [this](unsigned prec){ return Round(prec); });
 }
 
 void Float::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
 {
-	evaluation_value = mpfr(highest_precision_value_);
+	evaluation_value = RoundedTo(evaluation_value.precision(), [this](unsigned prec){ return Round(prec); });
 }
 
 
@@ -133,6 +150,11 @@ void Rational::print(std::ostream & target) const
 	target << "(" << true_value_real_ << "," << true_value_imag_ << ")";
 }
 
+std::string Rational::LocalData() const
+{
+	return true_value_real_.str() + "," + true_value_imag_.str();
+}
+
 // Return value of constant
 dbl Rational::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
 {
@@ -145,14 +167,21 @@ void Rational::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> cons
 }
 
 
-mpfr Rational::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+mpfr Rational::Round(unsigned prec) const
 {
+	// the conversion from rational is done in the default precision
+	DefaultPrecisionGuard precision_guard(prec);
 	return mpfr(boost::multiprecision::mpfr_float(true_value_real_),boost::multiprecision::mpfr_float(true_value_imag_));
 }
 
+mpfr Rational::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+{
+	return RoundedTo(Node::precision(), [this](unsigned prec){ return Round(prec); });
+}
+
 void Rational::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
 {
-	evaluation_value = mpfr(boost::multiprecision::mpfr_float(true_value_real_),boost::multiprecision::mpfr_float(true_value_imag_));
+	evaluation_value = RoundedTo(evaluation_value.precision(), [this](unsigned prec){ return Round(prec); });
 }
 
 
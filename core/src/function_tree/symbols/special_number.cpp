@@ -46,14 +46,20 @@ void Pi::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& dif
 }
 
 
-mpfr Pi::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+mpfr Pi::Round(unsigned prec) const
 {
+	DefaultPrecisionGuard precision_guard(prec);
 	return mpfr(mpfr_float(acos(mpfr_float(-1))));
 }
 
+mpfr Pi::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const
+{
+	return RoundedTo(Node::precision(), [this](unsigned prec){ return Round(prec); });
+}
+
 void Pi::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
 {
-	evaluation_value = mpfr(mpfr_float(acos(mpfr_float(-1))));
+	evaluation_value = RoundedTo(evaluation_value.precision(), [this](unsigned prec){ return Round(prec); });
 }
 
 
@@ -71,14 +77,20 @@ void E::FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff
 }
 
 
-mpfr E::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const 
+mpfr E::Round(unsigned prec) const
 {
+	DefaultPrecisionGuard precision_guard(prec);
 	return mpfr(mpfr_float(exp(mpfr_float(1))));
 }
 
+mpfr E::FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const 
+{
+	return RoundedTo(Node::precision(), [this](unsigned prec){ return Round(prec); });
+}
+
 void E::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const 
 {
-	evaluation_value = mpfr(mpfr_float(exp(mpfr_float(1))));
+	evaluation_value = RoundedTo(evaluation_value.precision(), [this](unsigned prec){ return Round(prec); });
 }
 			}// special number namespace
 std::shared_ptr<Node> Pi()
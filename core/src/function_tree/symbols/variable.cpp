@@ -28,6 +28,8 @@
 
 #include "bertini2/eigen_extensions.hpp"
 
+#include <sstream>
+
 
 
 namespace bertini{
@@ -105,6 +107,14 @@ void Variable::Reset() const
 }
 
 
+std::string Variable::LocalData() const
+{
+	std::stringstream ss;
+	ss << static_cast<void const*>(this);
+	return ss.str();
+}
+
+
 
 int Variable::Degree(std::shared_ptr<Variable> const& v) const
 {
@@ -0,0 +1,141 @@
+//This file is part of Bertini 2.
+//
+//homotopy_cache.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//homotopy_cache.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with homotopy_cache.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+
+#include "bertini2/system/homotopy_cache.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+
+namespace bertini {
+
+	namespace {
+		/**
+		The first bytes of a cache file, before the version number.
+		*/
+		const char CacheMagic[] = "bertini2 homotopy";
+
+
+		/**
+		The 64-bit FNV-1a hash.  Stable across platforms and runs, unlike std::hash.
+		*/
+		std::uint64_t FNV1a(std::string const& bytes, std::uint64_t h = 14695981039346656037ull)
+		{
+			for (unsigned char c : bytes)
+			{
+				h ^= c;
+				h *= 1099511628211ull;
+			}
+			return h;
+		}
+	}
+
+
+	std::string HomotopyCache::DefaultDirectory()
+	{
+		if (const char* dir = std::getenv("BERTINI2_HOMOTOPY_CACHE"))
+			return dir;
+		return "bertini2_homotopy_cache";
+	}
+
+
+	std::string HomotopyCache::Key(System const& sys, std::string const& preparation)
+	{
+		std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+		SaveBinary(sys, ss);
+
+		return Key(ss.str(), preparation);
+	}
+
+
+	std::string HomotopyCache::Key(std::string const& key, std::string const& preparation)
+	{
+		auto h = FNV1a(key);
+		h = FNV1a(preparation, h);
+
+		std::stringstream extended;
+		extended << std::hex << std::setw(16) << std::setfill('0') << h;
+		return extended.str();
+	}
+
+
+	std::string HomotopyCache::PathFor(std::string const& key) const
+	{
+		return (boost::filesystem::path(directory_) / (key + ".b2hom")).string();
+	}
+
+
+	std::string HomotopyCache::TemporaryPathFor(std::string const& key) const
+	{
+		namespace fs = boost::filesystem;
+		try
+		{
+			fs::create_directories(directory_);
+			return (fs::path(directory_) / fs::unique_path(key + ".%%%%-%%%%-%%%%.tmp")).string();
+		}
+		catch (fs::filesystem_error const& e)
+		{
+			throw std::runtime_error("unable to make homotopy cache directory " + directory_ + ": " + e.what());
+		}
+	}
+
+
+	void HomotopyCache::Commit(std::string const& temp_path, std::string const& path)
+	{
+		namespace fs = boost::filesystem;
+		boost::system::error_code ec;
+		fs::rename(temp_path, path, ec);
+		if (ec)
+		{
+			fs::remove(temp_path, ec);
+			throw std::runtime_error("unable to move " + temp_path + " into homotopy cache as " + path);
+		}
+	}
+
+
+	void HomotopyCache::WriteHeader(std::ostream & out)
+	{
+		out.write(CacheMagic, sizeof(CacheMagic));
+		const std::uint32_t version = SystemBinaryFormatVersion();
+		out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	}
+
+
+	bool HomotopyCache::ReadHeader(std::istream & in)
+	{
+		char magic[sizeof(CacheMagic)];
+		std::uint32_t version;
+		in.read(magic, sizeof(magic));
+		in.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+		return in && std::memcmp(magic, CacheMagic, sizeof(CacheMagic))==0 && version==SystemBinaryFormatVersion();
+	}
+
+} // namespace bertini
@@ -0,0 +1,493 @@
+//This file is part of Bertini 2.
+//
+//polynomial_table.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_table.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_table.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+#include "bertini2/system/polynomial_table.hpp"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+namespace bertini {
+
+	namespace {
+
+		using Nd = std::shared_ptr<node::Node>;
+		using Var = std::shared_ptr<node::Variable>;
+
+		/// (variable index, exponent) pairs, sorted by variable, exponents positive.
+		using Monomial = std::vector<std::pair<unsigned,unsigned>>;
+
+		/// a sparse polynomial, with constant expressions for coefficients.
+		using Polynomial = std::map<Monomial, Nd>;
+
+
+		Monomial MultiplyMonomials(Monomial const& a, Monomial const& b)
+		{
+			Monomial m;
+			m.reserve(a.size()+b.size());
+			auto i = a.begin(), j = b.begin();
+			while (i!=a.end() && j!=b.end())
+			{
+				if (i->first < j->first)
+					m.push_back(*i++);
+				else if (j->first < i->first)
+					m.push_back(*j++);
+				else
+				{
+					m.emplace_back(i->first, i->second + j->second);
+					++i; ++j;
+				}
+			}
+			m.insert(m.end(), i, a.end());
+			m.insert(m.end(), j, b.end());
+			return m;
+		}
+
+
+
+		/**
+		\brief Expands expression trees into sparse polynomials, with respect to all the variables appearing in them.
+
+		Results are remembered per node, so shared subexpressions are expanded once.  A tree which is not a polynomial, or expands to too many terms, is not an error, just a tree better evaluated as it is, so expansion reports failure by its return value, and says why in Failure().
+		*/
+		class Expander
+		{
+		public:
+
+			Expander(std::vector<Var> & slots, std::size_t max_terms) : slots_(slots), max_terms_(max_terms), one_(MakeInteger(1))
+			{
+				for (unsigned ii = 0; ii < slots_.size(); ++ii)
+					slot_index_[slots_[ii].get()] = ii;
+			}
+
+			/**
+			\return The expansion, or nullptr if it failed.
+			*/
+			Polynomial const* Expand(Nd const& n)
+			{
+				auto found = expanded_.find(n.get());
+				if (found != expanded_.end())
+					return &found->second;
+
+				Polynomial p;
+				if (!ExpandFresh(n, p) || !CheckSize(p))
+					return nullptr;
+
+				return &expanded_.emplace(n.get(), std::move(p)).first->second;
+			}
+
+			/**
+			\brief Why the most recent expansion failed.
+			*/
+			std::string const& Failure() const
+			{
+				return failure_;
+			}
+
+		private:
+
+			bool Fail(std::string reason)
+			{
+				failure_ = std::move(reason);
+				return false;
+			}
+
+			bool CheckSize(Polynomial const& p)
+			{
+				if (p.size() > max_terms_)
+					return Fail("expanding function into polynomial table gives more than " + std::to_string(max_terms_) + " terms");
+				return true;
+			}
+
+			bool ExpandFresh(Nd const& n, Polynomial & result)
+			{
+				using namespace node;
+
+				if (IsConstant(n))
+				{
+					result = Polynomial{{Monomial{}, n}};
+					return true;
+				}
+
+				if (auto v = std::dynamic_pointer_cast<Variable>(n))
+				{
+					result = Polynomial{{Monomial{{SlotOf(v),1}}, one_}};
+					return true;
+				}
+
+				if (auto f = std::dynamic_pointer_cast<Function>(n))
+				{
+					auto p = Expand(f->entry_node());
+					if (!p)
+						return false;
+					result = *p;
+					return true;
+				}
+
+				if (auto s = std::dynamic_pointer_cast<SumOperator>(n))
+				{
+					const auto& signs = s->children_signs();
+					for (unsigned ii = 0; ii < s->children_size(); ++ii)
+					{
+						auto p = Expand(s->children()[ii]);
+						if (!p)
+							return false;
+						Accumulate(result, *p, signs[ii]);
+					}
+					return true;
+				}
+
+				if (auto neg = std::dynamic_pointer_cast<NegateOperator>(n))
+				{
+					auto p = Expand(neg->first_child());
+					if (!p)
+						return false;
+					Accumulate(result, *p, false);
+					return true;
+				}
+
+				if (auto m = std::dynamic_pointer_cast<MultOperator>(n))
+				{
+					result = Polynomial{{Monomial{}, one_}};
+					const auto& mult_or_div = m->children_mult_or_div();
+					for (unsigned ii = 0; ii < m->children_size(); ++ii)
+					{
+						const auto& child = m->children()[ii];
+						if (mult_or_div[ii])
+						{
+							auto p = Expand(child);
+							if (!p || !Multiply(result, *p, result))
+								return false;
+						}
+						else if (IsConstant(child))
+						{
+							for (auto& term : result)
+								term.second = std::make_shared<MultOperator>(term.second, true, child, false);
+						}
+						else
+							return Fail("function divides by a non-constant, so is not a polynomial");
+					}
+					return true;
+				}
+
+				if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+				{
+					if (p->exponent() < 0)
+						return Fail("function has a negative power of a non-constant, so is not a polynomial");
+
+					auto base = Expand(p->first_child());
+					return base && Power(*base, static_cast<unsigned>(p->exponent()), result);
+				}
+
+				if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+				{
+					if (!IsConstant(p->exponent()))
+						return Fail("function has a non-constant exponent, so is not a polynomial");
+
+					// same test for an integer exponent as in PowerOperator::Degree
+					auto exp_val = p->exponent()->Eval<dbl>();
+					if (fabs(imag(exp_val)) >= 10*std::numeric_limits<double>::epsilon() ||
+					    fabs(real(exp_val) - std::round(real(exp_val))) >= 10*std::numeric_limits<double>::epsilon() ||
+					    std::round(real(exp_val)) < 0)
+						return Fail("function has a power of a non-constant which is not a non-negative integer, so is not a polynomial");
+
+					auto base = Expand(p->base());
+					return base && Power(*base, static_cast<unsigned>(std::round(real(exp_val))), result);
+				}
+
+				return Fail("function contains a non-polynomial operation");
+			}
+
+
+			/**
+			\brief Whether a subtree contains no variables, and so can serve as a coefficient.
+			*/
+			bool IsConstant(Nd const& n)
+			{
+				auto found = is_constant_.find(n.get());
+				if (found != is_constant_.end())
+					return found->second;
+
+				bool result;
+				if (std::dynamic_pointer_cast<node::Variable>(n) || std::dynamic_pointer_cast<node::Differential>(n))
+					result = false;
+				else
+				{
+					result = true;
+					n->TransformChildren([&](Nd const& child){ result = result && IsConstant(child); return child; });
+				}
+
+				is_constant_[n.get()] = result;
+				return result;
+			}
+
+
+			unsigned SlotOf(Var const& v)
+			{
+				auto found = slot_index_.find(v.get());
+				if (found != slot_index_.end())
+					return found->second;
+
+				slots_.push_back(v);
+				return slot_index_[v.get()] = static_cast<unsigned>(slots_.size()-1);
+			}
+
+
+			Nd Plus(Nd const& a, Nd const& b, bool add) const
+			{
+				return std::make_shared<node::SumOperator>(a, true, b, add);
+			}
+
+			Nd Times(Nd const& a, Nd const& b) const
+			{
+				if (a==one_)
+					return b;
+				if (b==one_)
+					return a;
+				return std::make_shared<node::MultOperator>(a, b);
+			}
+
+
+			void AddTerm(Polynomial & result, Monomial const& m, Nd const& c, bool add) const
+			{
+				auto found = result.find(m);
+				if (found != result.end())
+					found->second = Plus(found->second, c, add);
+				else
+					result.emplace(m, add ? c : -c);
+			}
+
+			void Accumulate(Polynomial & result, Polynomial const& p, bool add) const
+			{
+				for (const auto& term : p)
+					AddTerm(result, term.first, term.second, add);
+			}
+
+
+			/**
+			\brief Multiply two polynomials.  The product may be one of the factors.
+
+			\return Whether the product has few enough terms.
+			*/
+			bool Multiply(Polynomial const& a, Polynomial const& b, Polynomial & product)
+			{
+				Polynomial result;
+				for (const auto& s : a)
+					for (const auto& t : b)
+						AddTerm(result, MultiplyMonomials(s.first, t.first), Times(s.second, t.second), true);
+
+				if (!CheckSize(result))
+					return false;
+				product = std::move(result);
+				return true;
+			}
+
+
+			/**
+			\brief Raise a polynomial to a power, by repeated squaring.
+
+			\return Whether the power, and every product on the way to it, has few enough terms.
+			*/
+			bool Power(Polynomial const& p, unsigned e, Polynomial & result)
+			{
+				result = Polynomial{{Monomial{}, one_}};
+				Polynomial base = p;
+				while (e > 0)
+				{
+					if ((e & 1u) && !Multiply(result, base, result))
+						return false;
+					e >>= 1;
+					if (e > 0 && !Multiply(base, base, base))
+						return false;
+				}
+				return true;
+			}
+
+
+			std::vector<Var> & slots_;
+			std::unordered_map<node::Node const*, unsigned> slot_index_;
+			std::size_t max_terms_;
+			Nd one_;
+
+			std::unordered_map<node::Node const*, Polynomial> expanded_;
+			std::unordered_map<node::Node const*, bool> is_constant_;
+			std::string failure_;
+		};
+
+	} // namespace
+
+
+
+	PolynomialTable::PolynomialTable(std::vector<Fn> const& functions, VariableGroup const& variables, Var const& path_variable, std::size_t max_terms) : PolynomialTable()
+	{
+		std::string failure;
+		if (!Build(functions, variables, path_variable, max_terms, failure))
+			throw std::runtime_error(failure);
+	}
+
+
+
+	std::shared_ptr<PolynomialTable> PolynomialTable::Make(std::vector<Fn> const& functions, VariableGroup const& variables, Var const& path_variable, std::size_t max_terms)
+	{
+		std::shared_ptr<PolynomialTable> table(new PolynomialTable());
+		std::string failure;
+		if (!table->Build(functions, variables, path_variable, max_terms, failure))
+			return nullptr;
+		return table;
+	}
+
+
+
+	bool PolynomialTable::Build(std::vector<Fn> const& functions, VariableGroup const& variables, Var const& path_variable, std::size_t max_terms, std::string & failure)
+	{
+		slots_.assign(variables.begin(), variables.end());
+		num_space_variables_ = static_cast<unsigned>(variables.size());
+		if (path_variable)
+		{
+			time_slot_ = static_cast<int>(slots_.size());
+			slots_.push_back(path_variable);
+		}
+
+		Expander expander(slots_, max_terms);
+
+		std::vector<unsigned> max_exponents;
+		function_begin_.push_back(0);
+		term_begin_.push_back(0);
+
+		for (const auto& f : functions)
+		{
+			auto expanded = expander.Expand(f);
+			if (!expanded)
+			{
+				failure = expander.Failure();
+				return false;
+			}
+			const auto& p = *expanded;
+			max_exponents.resize(slots_.size(), 0);
+
+			for (const auto& term : p)
+			{
+				coefficient_nodes_.push_back(term.second);
+				for (const auto& factor : term.first)
+				{
+					factor_slot_.push_back(factor.first);
+					factor_exponent_.push_back(factor.second);
+					max_exponents[factor.first] = std::max(max_exponents[factor.first], factor.second);
+				}
+				term_begin_.push_back(static_cast<unsigned>(factor_slot_.size()));
+				max_factors_ = std::max(max_factors_, static_cast<unsigned>(term.first.size()));
+			}
+			function_begin_.push_back(static_cast<unsigned>(coefficient_nodes_.size()));
+		}
+		max_exponents.resize(slots_.size(), 0);
+
+		power_offset_.push_back(0);
+		for (auto e : max_exponents)
+			power_offset_.push_back(power_offset_.back() + e + 1);
+
+		for (unsigned ll = 0; ll < factor_slot_.size(); ++ll)
+			factor_power_.push_back(power_offset_[factor_slot_[ll]] + factor_exponent_[ll]);
+
+		// coefficients gathered from several terms are sums of products of constants.  most are exact, and become single numbers.
+		ConstantFolder folder;
+		for (auto& c : coefficient_nodes_)
+			folder.Fold(c);
+
+		auto& coefficients_d = std::get<std::vector<dbl>>(coefficients_);
+		coefficients_d.reserve(coefficient_nodes_.size());
+		for (const auto& c : coefficient_nodes_)
+			coefficients_d.push_back(c->Eval<dbl>());
+
+		ResizeWorkingSpace();
+		return true;
+	}
+
+
+
+	unsigned PolynomialTable::MaxExponent() const
+	{
+		unsigned m = 0;
+		for (auto e : factor_exponent_)
+			m = std::max(m, e);
+		return m;
+	}
+
+
+
+	void PolynomialTable::precision(unsigned prec) const
+	{
+		if (prec == precision_)
+			return;
+
+		precision_ = prec;
+		coefficients_mp_current_ = false;
+		ResizeWorkingSpace();
+	}
+
+
+
+	void PolynomialTable::EvaluateCoefficientsMP() const
+	{
+		node::WorkingPrecisionGuard precision_guard(precision_);
+
+		auto& coefficients_mp = std::get<std::vector<mpfr>>(coefficients_);
+		coefficients_mp.resize(coefficient_nodes_.size());
+
+		for (unsigned kk = 0; kk < coefficient_nodes_.size(); ++kk)
+		{
+			coefficients_mp[kk].precision(precision_);
+			coefficient_nodes_[kk]->EvalInPlace(coefficients_mp[kk]);
+		}
+
+		coefficients_mp_current_ = true;
+	}
+
+
+
+	void PolynomialTable::ResizeWorkingSpace() const
+	{
+		const auto num_powers = power_offset_.back();
+
+		auto& powers_d = std::get<std::vector<dbl>>(powers_);
+		auto& powers_mp = std::get<std::vector<mpfr>>(powers_);
+		powers_d.assign(num_powers, dbl(1));
+		powers_mp.resize(num_powers);
+		for (auto& p : powers_mp)
+		{
+			p.precision(precision_);
+			p = mpfr(1);
+		}
+
+		std::get<std::vector<dbl>>(prefix_).resize(max_factors_+1);
+		auto& prefix_mp = std::get<std::vector<mpfr>>(prefix_);
+		prefix_mp.resize(max_factors_+1);
+		for (auto& p : prefix_mp)
+			p.precision(precision_);
+
+		std::get<mpfr>(suffix_).precision(precision_);
+		std::get<mpfr>(temp_).precision(precision_);
+	}
+
+} // namespace bertini
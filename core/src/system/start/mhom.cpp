@@ -35,114 +35,278 @@ namespace bertini {
 		// constructor for MHomogeneous start system, from any other *suitable* system.
 		MHomogeneous::MHomogeneous(System const& s)
 		{
+			SanityChecks(s);
+			CopyDegrees(s);
+			CopyVariableStructure(s);
+			SeedRandomCoefficients();
+			GenerateFunctions();
+			CountStartPoints();
+
+			if (s.IsHomogeneous())
+				Homogenize();
+
+			if (s.IsPatched())
+				CopyPatches(s);
+		}// m-homogeneous constructor
 
+		
+		MHomogeneous& MHomogeneous::operator*=(Nd const& n)
+		{
+			*this *= n;
+			return *this;
+		}
+		
+		
+
+		unsigned long long MHomogeneous::NumStartPoints() const
+		{
+			return NumCompletions(group_sizes_);
+		}
+
+
+
+		void MHomogeneous::SanityChecks(System const& s)
+		{
 			if (s.NumHomVariableGroups() > 0)
 				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
 
+			if (s.NumUngroupedVariables() > 0)
+				throw std::runtime_error("ungrouped variables are present.  currently unallowed");
 
 			if (s.NumTotalFunctions() != s.NumVariables())
-				throw std::runtime_error("attempting to construct total degree start system from non-square target system");
+				throw std::runtime_error("attempting to construct m-homogeneous start system from non-square target system");
 
 			if (s.HavePathVariable())
-				throw std::runtime_error("attempting to construct total degree start system, but target system has path varible declared already");			
+				throw std::runtime_error("attempting to construct m-homogeneous start system, but target system has path varible declared already");			
 
 			if (!s.IsPolynomial())
-				throw std::runtime_error("attempting to construct total degree start system from non-polynomial target system");
-
-			
+				throw std::runtime_error("attempting to construct m-homogeneous start system from non-polynomial target system");
+		}
 
-			auto deg = s.Degrees();
-			for (auto iter : deg)
-				degrees_.push_back((size_t) iter);
 
-			CopyVariableStructure(s);
 
-			random_values_.resize(s.NumFunctions());
+		void MHomogeneous::CopyDegrees(System const& s)
+		{
+			const auto num_groups = s.NumVariableGroups();
+			const auto num_functions = s.NumFunctions();
 
+			group_sizes_.resize(num_groups);
+			degree_matrix_.resize(num_functions*num_groups);
 
-			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
-				random_values_[ii] = MakeRational(node::Rational::Rand());
+			for (size_t jj = 0; jj < num_groups; ++jj)
+			{
+				auto const& group = s.AffineVariableGroup(jj);
+				group_sizes_[jj] = group.size();
 
-			// by hypothesis, the system has a single variable group.
-			VariableGroup v = this->AffineVariableGroup(0);
+				auto degs = s.Degrees(group);
+				for (size_t ii = 0; ii < num_functions; ++ii)
+					degree_matrix_[ii*num_groups + jj] = static_cast<unsigned>(degs[ii]);
+			}
 
-			for (auto iter = v.begin(); iter!=v.end(); iter++)
-				AddFunction(pow(*iter,(int) *(degrees_.begin() + (iter-v.begin()))) - random_values_[iter-v.begin()]); 
-			
-			if (s.IsHomogeneous())
-				Homogenize();
+			for (size_t ii = 0; ii < num_functions; ++ii)
+			{
+				unsigned total = 0;
+				for (size_t jj = 0; jj < num_groups; ++jj)
+					total += Degree(ii,jj);
+				if (total==0)
+					throw std::runtime_error("attempting to construct m-homogeneous start system from target system with a constant function");
+			}
+		}
 
-			if (s.IsPatched())
-				CopyPatches(s);
 
-		}// total degree constructor
 
-		
-		MHomogeneous& MHomogeneous::operator*=(Nd const& n)
+		void MHomogeneous::SeedRandomCoefficients()
 		{
-			*this *= n;
-			return *this;
+			const auto num_groups = group_sizes_.size();
+			const auto num_functions = degree_matrix_.size() / num_groups;
+
+			factor_offsets_.resize(degree_matrix_.size());
+
+			size_t num_coefficients = 0;
+			for (size_t ii = 0; ii < num_functions; ++ii)
+				for (size_t jj = 0; jj < num_groups; ++jj)
+				{
+					factor_offsets_[ii*num_groups + jj] = num_coefficients;
+					num_coefficients += Degree(ii,jj) * (group_sizes_[jj]+1);
+				}
+
+			coefficients_.resize(num_coefficients);
+			for (auto& c : coefficients_)
+				c = MakeRational(node::Rational::Rand());
 		}
-		
-		
 
-		unsigned long long MHomogeneous::NumStartPoints() const
-		{
-			unsigned long long num_start_points = 1;
-			for (auto iter : degrees_)
-				num_start_points*=iter;
-			return num_start_points;
-		}
 
 
-		
-		Vec<dbl> MHomogeneous::GenerateStartPoint(dbl,unsigned long long index) const
+		void MHomogeneous::GenerateFunctions()
 		{
-			Vec<dbl> start_point(NumVariables());
-			auto indices = IndexToSubscript(index, degrees_);
+			const auto num_groups = group_sizes_.size();
+			const auto num_functions = degree_matrix_.size() / num_groups;
 
-			unsigned offset = 0;
-			if (IsPatched())
+			for (size_t ii = 0; ii < num_functions; ++ii)
 			{
-				start_point(0) = dbl(1);
-				offset = 1;
+				Nd f;
+				for (size_t jj = 0; jj < num_groups; ++jj)
+				{
+					auto const& group = this->AffineVariableGroup(jj);
+					for (unsigned ll = 0; ll < Degree(ii,jj); ++ll)
+					{
+						auto offset = FactorOffset(ii,jj,ll);
+						Nd factor = coefficients_[offset];
+						for (size_t kk = 0; kk < group.size(); ++kk)
+							factor = factor + coefficients_[offset+1+kk] * group[kk];
+
+						f = f ? f * factor : factor;
+					}
+				}
+				AddFunction(f);
 			}
+		}
 
-			for (size_t ii = 0; ii< NumNaturalVariables(); ++ii)
-				start_point(ii+offset) = exp( std::acos(-1) * dbl(0,2) * double(indices[ii]) / double(degrees_[ii])  ) * pow(random_values_[ii]->Eval<dbl>(), double(1) / double(degrees_[ii]));
 
-			if (IsPatched())
-				RescalePointToFitPatchInPlace(start_point);
 
-			return start_point;
+		unsigned long long MHomogeneous::NumCompletions(std::vector<unsigned> const& remaining) const
+		{
+			auto found = num_completions_.find(remaining);
+			if (found == num_completions_.end())
+				return 0;
+			return found->second;
 		}
 
 
-		Vec<mpfr> MHomogeneous::GenerateStartPoint(mpfr,unsigned long long index) const
+
+		void MHomogeneous::CountStartPoints()
 		{
-			Vec<mpfr> start_point(NumVariables());
-			auto indices = IndexToSubscript(index, degrees_);
+			num_completions_.clear();
+			auto remaining = group_sizes_;
+			CountCompletions(0, remaining);
+		}
 
-			unsigned offset = 0;
-			if (IsPatched())
+
+		// this is the permanent-style expansion of the m-homogeneous Bezout number along the functions.  the function index is determined by the remaining capacities, so only they are needed as the key.
+		unsigned long long MHomogeneous::CountCompletions(size_t function_index, std::vector<unsigned> & remaining)
+		{
+			auto found = num_completions_.find(remaining);
+			if (found != num_completions_.end())
+				return found->second;
+
+			const auto num_groups = group_sizes_.size();
+			unsigned long long count = 0;
+
+			if (function_index == degree_matrix_.size() / num_groups)
+				count = 1; // every group is full, since the system is square
+			else
+				for (size_t jj = 0; jj < num_groups; ++jj)
+				{
+					const auto d = Degree(function_index, jj);
+					if (remaining[jj]==0 || d==0)
+						continue;
+
+					--remaining[jj];
+					count += d * CountCompletions(function_index+1, remaining);
+					++remaining[jj];
+				}
+
+			num_completions_[remaining] = count;
+			return count;
+		}
+
+
+
+		std::pair<std::vector<unsigned>, std::vector<unsigned>> MHomogeneous::IndexToFactors(unsigned long long index) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("index of start point exceeds the number of start points for m-homogeneous start system");
+
+			const auto num_groups = group_sizes_.size();
+			const auto num_functions = degree_matrix_.size() / num_groups;
+
+			std::vector<unsigned> groups(num_functions), factors(num_functions);
+			auto remaining = group_sizes_;
+
+			for (size_t ii = 0; ii < num_functions; ++ii)
 			{
-				start_point(0) = mpfr(1);
-				offset = 1;
+				for (size_t jj = 0; jj < num_groups; ++jj)
+				{
+					const auto d = Degree(ii, jj);
+					if (remaining[jj]==0 || d==0)
+						continue;
+
+					--remaining[jj];
+					const auto num_below = NumCompletions(remaining);
+					if (index < d*num_below)
+					{
+						groups[ii] = jj;
+						factors[ii] = static_cast<unsigned>(index / num_below);
+						index %= num_below;
+						break;
+					}
+					index -= d*num_below;
+					++remaining[jj];
+				}
 			}
 
-			auto two_i = mpfr(0,2);
-			auto one = mpfr(1);
+			return std::make_pair(groups, factors);
+		}
+
+
+
+		template<typename ComplexType>
+		Vec<ComplexType> MHomogeneous::GenerateStartPointT(unsigned long long index) const
+		{
+			node::WorkingPrecisionGuard precision_guard(precision());
+			Vec<ComplexType> start_point(NumVariables());
+			auto choice = IndexToFactors(index);
+			auto const& groups = choice.first;
+			auto const& factors = choice.second;
 
-			for (size_t ii = 0; ii< NumNaturalVariables(); ++ii)
-				start_point(ii+offset) = exp( acos( mpfr_float(-1) ) * two_i * mpfr_float(indices[ii]) / mpfr_float(degrees_[ii])  ) * pow(random_values_[ii]->Eval<mpfr>(), one / degrees_[ii]);
+			const bool have_homvars = NumHomVariables() > 0;
+
+			unsigned offset = 0;
+			for (unsigned jj = 0; jj < group_sizes_.size(); ++jj)
+			{
+				const auto n = group_sizes_[jj];
+				Mat<ComplexType> A(n,n);
+				Vec<ComplexType> b(n);
+
+				unsigned row = 0;
+				for (size_t ii = 0; ii < groups.size(); ++ii)
+				{
+					if (groups[ii]!=jj)
+						continue;
+
+					auto factor_offset = FactorOffset(ii, jj, factors[ii]);
+					b(row) = -coefficients_[factor_offset]->Eval<ComplexType>();
+					for (unsigned kk = 0; kk < n; ++kk)
+						A(row,kk) = coefficients_[factor_offset+1+kk]->Eval<ComplexType>();
+					++row;
+				}
+
+				if (have_homvars)
+					start_point(offset++) = ComplexType(1);
+
+				start_point.segment(offset,n) = A.lu().solve(b);
+				offset += n;
+			}
 
 			if (IsPatched())
 				RescalePointToFitPatchInPlace(start_point);
 
-
 			return start_point;
 		}
 
+
+		
+		Vec<dbl> MHomogeneous::GenerateStartPoint(dbl,unsigned long long index) const
+		{
+			return GenerateStartPointT<dbl>(index);
+		}
+
+
+		Vec<mpfr> MHomogeneous::GenerateStartPoint(mpfr,unsigned long long index) const
+		{
+			return GenerateStartPointT<mpfr>(index);
+		}
+
 		inline
 		MHomogeneous operator*(MHomogeneous td, std::shared_ptr<node::Node> const& n)
 		{
@@ -93,6 +93,7 @@ namespace bertini {
 
 		Vec<mpfr> TotalDegree::GenerateStartPoint(mpfr,unsigned long long index) const
 		{
+			node::WorkingPrecisionGuard precision_guard(precision());
 			Vec<mpfr> start_point(NumVariables());
 			auto indices = IndexToSubscript(index, degrees_);
 
@@ -25,6 +25,16 @@
 
 #include "bertini2/system/system.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+
 template<typename NumType> using Vec = bertini::Vec<NumType>;
 template<typename NumType> using Mat = bertini::Mat<NumType>;
 
@@ -45,6 +55,16 @@ namespace bertini
 		return true;
 	}
 
+	bool DefaultUsePolynomialTable()
+	{
+		return true;
+	}
+
+	unsigned DefaultMaxDifferentiationThreads()
+	{
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
 	void swap(System & a, System & b)
 	{
 		using std::swap;
@@ -74,6 +94,8 @@ namespace bertini
 
 		swap(a.space_derivatives_,b.space_derivatives_);
 		swap(a.time_derivatives_,b.time_derivatives_);
+		swap(a.jacobian_column_begin_,b.jacobian_column_begin_);
+		swap(a.jacobian_row_,b.jacobian_row_);
 
 		swap(a.assume_uniform_precision_,b.assume_uniform_precision_);
 		swap(a.jacobian_eval_method_,b.jacobian_eval_method_);
@@ -81,6 +103,9 @@ namespace bertini
 		swap(a.precision_,b.precision_);
 		swap(a.is_patched_,b.is_patched_);
 		swap(a.patch_,b.patch_);
+
+		swap(a.use_polynomial_table_,b.use_polynomial_table_);
+		swap(a.polynomial_table_,b.polynomial_table_);
 	}
 
 	// the copy constructor
@@ -100,6 +125,8 @@ namespace bertini
 		jacobian_ = other.jacobian_;
 		space_derivatives_ = other.space_derivatives_;
 		time_derivatives_ = other.time_derivatives_;
+		jacobian_column_begin_ = other.jacobian_column_begin_;
+		jacobian_row_ = other.jacobian_row_;
 
 		is_differentiated_ = other.is_differentiated_;
 
@@ -115,6 +142,12 @@ namespace bertini
 
 		precision_ = other.precision_;
 
+		max_differentiation_threads_ = other.max_differentiation_threads_;
+
+		use_polynomial_table_ = other.use_polynomial_table_;
+		if (other.polynomial_table_) // the table has its own working space, so is not shared
+			polynomial_table_ = std::make_shared<PolynomialTable>(*other.polynomial_table_);
+
 		// now to do the members which are not simply copied
 		constant_subfunctions_.resize(other.constant_subfunctions_.size());
 		for (unsigned ii = 0; ii < constant_subfunctions_.size(); ++ii)
@@ -226,46 +259,12 @@ namespace bertini
 		if (this->assume_uniform_precision_ && new_precision == this->precision_)
 			return;
 
-		for (const auto& iter : functions_) {
-			iter->precision(new_precision);
-		}
-
-		for (const auto& iter : subfunctions_) {
-			iter->precision(new_precision);
-		}
-
-		for (const auto& iter : explicit_parameters_) {
-			iter->precision(new_precision);
-		}
-
+		// the function trees adjust themselves when next evaluated, since evaluation is done with the system's precision as the working precision.  only the places values are written into need changing now.
 
 		for (const auto& iter :implicit_parameters_) {
 			iter->precision(new_precision);
 		}
 
-		for (const auto& iter : constant_subfunctions_) {
-			iter->precision(new_precision);
-		}
-
-		if (is_differentiated_)
-		{
-			switch (jacobian_eval_method_)
-			{
-				case JacobianEvalMethod::JacobianNode:
-					for (const auto& iter : jacobian_)
-						iter->precision(new_precision);
-					break;
-				case JacobianEvalMethod::Derivatives:
-					for (const auto& iter : space_derivatives_)
-						iter->precision(new_precision);
-					for (const auto& iter : time_derivatives_)
-						iter->precision(new_precision);
-					break;
-				// later, case for straight line program?
-			}
-			
-		}
-
 		if (have_path_variable_)
 			path_variable_->precision(new_precision);
 
@@ -290,50 +289,310 @@ namespace bertini
 		if (IsPatched())
 			patch_.Precision(new_precision);
 
+		if (polynomial_table_)
+			polynomial_table_->precision(new_precision);
+
 		precision_ = new_precision;
 	}
 
 
 	void System::Differentiate() const
 	{
+		const auto& vars = this->Variables();
+		const auto num_vars = NumVariables();
+		const auto num_functions = NumFunctions();
+
+		std::vector<bool> depends_on_time;
+		const auto variables_of = VariablesOfFunctions(depends_on_time);
+
+		// the sparsity pattern, in compressed sparse column form.  entries_of[ii] are the indices of the entries in row ii.
+		jacobian_column_begin_.assign(num_vars+1, 0);
+		for (const auto& iter : variables_of)
+			for (auto jj : iter)
+				++jacobian_column_begin_[jj+1];
+		std::partial_sum(jacobian_column_begin_.begin(), jacobian_column_begin_.end(), jacobian_column_begin_.begin());
+
+		jacobian_row_.resize(jacobian_column_begin_.back());
+		std::vector<unsigned> next_in_column(jacobian_column_begin_.begin(), jacobian_column_begin_.end()-1);
+		std::vector<std::vector<unsigned>> entries_of(num_functions);
+		for (unsigned ii = 0; ii < num_functions; ++ii)
+			for (auto jj : variables_of[ii])
+			{
+				const auto kk = next_in_column[jj]++;
+				jacobian_row_[kk] = ii;
+				entries_of[ii].push_back(kk);
+			}
+
+		const bool simplify = auto_simplify_;
+		using bertini::Simplify;
+
+		std::function<void(unsigned)> task;
 		switch (jacobian_eval_method_)
 		{
 			case JacobianEvalMethod::JacobianNode:
 			{
-				auto num_functions = NumFunctions();
 				jacobian_.resize(num_functions);
-				for (int ii = 0; ii < num_functions; ++ii)
+				task = [&](unsigned ii)
+				{
 					jacobian_[ii] = MakeJacobian(functions_[ii]->Differentiate());
+					if (simplify)
+						Simplify(jacobian_[ii]);
+				};
 				break;
 			}
 			case JacobianEvalMethod::Derivatives:
 			{
-				const auto& vars = this->Variables();
-				const auto num_vars = NumVariables();
-				const auto num_functions = NumFunctions();
-
-				space_derivatives_.resize(num_functions*num_vars);
-				// again, computing these in column major, so staying with one variable at a time.
-				for (int jj = 0; jj < num_vars; ++jj)
-					for (int ii = 0; ii < num_functions; ++ii)
-						space_derivatives_[ii+jj*num_functions] = functions_[ii]->Differentiate(vars[jj]);
-
+				space_derivatives_.assign(jacobian_row_.size(), nullptr);
 				if (HavePathVariable())
-				{
-					const auto& t = path_variable_;
 					time_derivatives_.resize(num_functions);
-						for (int ii = 0; ii < num_functions; ++ii)
-							time_derivatives_[ii] = functions_[ii]->Differentiate(t);
-				}
+
+				task = [&](unsigned ii)
+				{
+					for (unsigned ll = 0; ll < entries_of[ii].size(); ++ll)
+					{
+						auto& d = space_derivatives_[entries_of[ii][ll]];
+						d = functions_[ii]->Differentiate(vars[variables_of[ii][ll]]);
+						if (simplify)
+							Simplify(d);
+					}
+
+					if (HavePathVariable())
+					{
+						auto& d = time_derivatives_[ii];
+						d = depends_on_time[ii] ? functions_[ii]->Differentiate(path_variable_) : MakeInteger(0);
+						if (simplify)
+							Simplify(d);
+					}
+				};
 				break;
 			}
 		}
+
+		// the derivatives made by each task reach only into the tree of its function
+		auto roots_of = [this](unsigned ii){ return std::vector<Nd>{functions_[ii]}; };
+
+		if (simplify) // simplification evaluates, to find zeros, so happens at a random point
+			AtRandomValues([&]{ ForEachFunction(task, roots_of); });
+		else
+			ForEachFunction(task, roots_of);
+
 		is_differentiated_ = true;
 
-		if (auto_simplify_)
+		TagDependencies();
+		BuildPolynomialTable();
+	}
+
+
+
+	std::vector<std::vector<unsigned>> System::VariablesOfFunctions(std::vector<bool> & depends_on_time) const
+	{
+		const auto& vars = this->Variables();
+		std::unordered_map<node::Node const*, unsigned> index_of;
+		for (unsigned jj = 0; jj < vars.size(); ++jj)
+			index_of.emplace(vars[jj].get(), jj);
+
+		const auto num_functions = NumFunctions();
+		std::vector<std::vector<unsigned>> variables_of(num_functions);
+		depends_on_time.assign(num_functions, false);
+
+		std::unordered_set<node::Node const*> visited;
+		std::vector<Nd> stack;
+		for (unsigned ii = 0; ii < num_functions; ++ii)
 		{
-			this->SimplifyDerivatives();
+			visited.clear();
+			stack.assign(1, functions_[ii]);
+			while (!stack.empty())
+			{
+				auto n = std::move(stack.back());
+				stack.pop_back();
+				if (!visited.insert(n.get()).second)
+					continue;
+
+				auto found = index_of.find(n.get());
+				if (found != index_of.end())
+					variables_of[ii].push_back(found->second);
+				else if (HavePathVariable() && n == path_variable_)
+					depends_on_time[ii] = true;
+				else
+					n->TransformChildren([&stack](Nd const& c){ stack.push_back(c); return c; });
+			}
+			std::sort(variables_of[ii].begin(), variables_of[ii].end());
 		}
+
+		return variables_of;
+	}
+
+
+
+	void System::ForEachFunction(std::function<void(unsigned)> const& task, std::function<std::vector<Nd>(unsigned)> const& roots_of) const
+	{
+		const unsigned num_functions = NumFunctions();
+		const auto num_threads = std::min(max_differentiation_threads_, num_functions / MinFunctionsPerThread());
+
+		if (num_threads < 2)
+		{
+			for (unsigned ii = 0; ii < num_functions; ++ii)
+				task(ii);
+			return;
+		}
+
+		// functions sharing an operator go in one group, found by union-find.  leaves are evaluated now, and not grouped.
+		std::vector<unsigned> group(num_functions);
+		std::iota(group.begin(), group.end(), 0);
+		auto find = [&group](unsigned ii)
+		{
+			while (group[ii]!=ii)
+				ii = group[ii] = group[group[ii]];
+			return ii;
+		};
+
+		const auto leaf = std::numeric_limits<unsigned>::max();
+		std::unordered_map<node::Node const*, unsigned> owner;
+		std::vector<Nd> stack;
+		for (unsigned ii = 0; ii < num_functions; ++ii)
+		{
+			stack = roots_of(ii);
+			while (!stack.empty())
+			{
+				auto n = std::move(stack.back());
+				stack.pop_back();
+
+				auto found = owner.emplace(n.get(), ii);
+				if (!found.second)
+				{
+					if (found.first->second != leaf)
+					{
+						auto a = find(ii), b = find(found.first->second);
+						group[std::max(a,b)] = std::min(a,b);
+					}
+					continue;
+				}
+
+				bool is_leaf = true;
+				n->TransformChildren([&](Nd const& c){ is_leaf = false; stack.push_back(c); return c; });
+				if (is_leaf)
+				{
+					found.first->second = leaf;
+					n->Eval<dbl>();
+				}
+			}
+		}
+
+		std::vector<std::vector<unsigned>> groups(num_functions);
+		for (unsigned ii = 0; ii < num_functions; ++ii)
+			groups[find(ii)].push_back(ii);
+		groups.erase(std::remove_if(groups.begin(), groups.end(), [](std::vector<unsigned> const& g){ return g.empty(); }), groups.end());
+
+		std::atomic<std::size_t> next_group{0};
+		std::vector<std::exception_ptr> errors(num_threads);
+		auto work = [&](unsigned t)
+		{
+			try
+			{
+				for (auto g = next_group++; g < groups.size(); g = next_group++)
+					for (auto ii : groups[g])
+						task(ii);
+			}
+			catch (...)
+			{
+				errors[t] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned t = 0; t < num_threads; ++t)
+			threads.emplace_back(work, t);
+		for (auto& t : threads)
+			t.join();
+
+		for (const auto& e : errors)
+			if (e)
+				std::rethrow_exception(e);
+	}
+
+
+
+	void System::AtRandomValues(std::function<void()> const& f) const
+	{
+		auto vars = this->Variables();
+		const auto num_vars = vars.size();
+		std::vector<dbl> old_vals(num_vars);  dbl old_path_var_val;
+
+		for (unsigned ii=0; ii<num_vars; ++ii)
+		{
+			old_vals[ii] = vars[ii]->Eval<dbl>();
+			vars[ii]->SetToRandUnit<dbl>();
+		}
+
+		if (HavePathVariable())
+		{
+			old_path_var_val = path_variable_->Eval<dbl>();
+			path_variable_->SetToRandUnit<dbl>();
+		}
+
+		auto reset_all = [this]()
+		{
+			auto reset = [](auto const& trees)
+			{
+				for (const auto& n : trees)
+					if (n) // during differentiation, some may not be made yet
+						n->Reset();
+			};
+			reset(functions_);
+			reset(jacobian_);
+			reset(space_derivatives_);
+			reset(time_derivatives_);
+		};
+
+		reset_all();
+		f();
+
+		for (unsigned ii=0; ii<num_vars; ++ii)
+			vars[ii]->set_current_value<dbl>(old_vals[ii]);
+		if (HavePathVariable())
+			path_variable_->set_current_value(old_path_var_val);
+
+		reset_all();
+	}
+
+
+
+	void System::BuildPolynomialTable() const
+	{
+		polynomial_table_.reset();
+		if (!use_polynomial_table_)
+			return;
+
+		polynomial_table_ = PolynomialTable::Make(functions_, Variables(), HavePathVariable() ? path_variable_ : nullptr);
+		// if null, not a polynomial, or too big expanded.  the trees it is.
+		if (polynomial_table_)
+			polynomial_table_->precision(precision_);
+	}
+
+
+
+	void System::TagDependencies() const
+	{
+		std::unordered_set<node::Node const*> visited;
+		const auto& t = HavePathVariable() ? path_variable_ : std::shared_ptr<node::Variable>();
+
+		for (const auto& iter : constant_subfunctions_)
+			node::TagDependencies(iter, t, visited);
+		for (const auto& iter : subfunctions_)
+			node::TagDependencies(iter, t, visited);
+		for (const auto& iter : explicit_parameters_)
+			node::TagDependencies(iter, t, visited);
+		for (const auto& iter : functions_)
+			node::TagDependencies(iter, t, visited);
+		for (const auto& iter : jacobian_)
+			node::TagDependencies(iter, t, visited);
+		for (const auto& iter : space_derivatives_)
+			node::TagDependencies(iter, t, visited);
+		for (const auto& iter : time_derivatives_)
+			node::TagDependencies(iter, t, visited);
+
+		// the caches may predate the tags, so start clean
+		MarkChanged(node::Dependency::All);
 	}
 
 
@@ -973,67 +1232,55 @@ namespace bertini
 		using bertini::Simplify;
 		for (auto& iter : this->functions_)
 			Simplify(iter);
+
+		if (is_differentiated_)
+			TagDependencies();
 	}
 
 
 
 	void System::SimplifyDerivatives() const
 	{
-		using bertini::Simplify;
-
-		auto num_vars = this->NumVariables();
-		std::vector<dbl> old_vals(num_vars);  dbl old_path_var_val;
-
-		auto vars = this->Variables();
-		for (unsigned ii=0; ii<num_vars; ++ii)
-		{
-			old_vals[ii] = vars[ii]->Eval<dbl>();
-			vars[ii]->SetToRandUnit<dbl>();
-		}
-
-		if (HavePathVariable())
-		{
-			old_path_var_val = path_variable_->Eval<dbl>();
-			path_variable_->SetToRandUnit<dbl>();
-		}
-
+		if (!is_differentiated_)
+			return;
 
-		for (const auto& n : jacobian_)
-			n->Reset();
-		for (const auto& n : space_derivatives_)
-			n->Reset();
-		for (const auto& n : time_derivatives_)
-			n->Reset();
+		using bertini::Simplify;
 
+		std::vector<std::vector<unsigned>> entries_of(NumFunctions());
+		for (unsigned kk = 0; kk < jacobian_row_.size(); ++kk)
+			entries_of[jacobian_row_[kk]].push_back(kk);
 
+		std::function<void(unsigned)> task;
+		std::function<std::vector<Nd>(unsigned)> roots_of;
 		switch (jacobian_eval_method_)
 		{
 			case JacobianEvalMethod::JacobianNode:
-				for (auto& iter : this->jacobian_)
-					Simplify(iter);
+				task = [this](unsigned ii){ Simplify(jacobian_[ii]); };
+				roots_of = [this](unsigned ii){ return std::vector<Nd>{jacobian_[ii]}; };
 				break;
 			case JacobianEvalMethod::Derivatives:
-				for (auto& iter : this->space_derivatives_)
-					Simplify(iter);
-				for (auto& iter : this->time_derivatives_)
-					Simplify(iter);
+				// derivatives may share nodes with those of other functions, if merged, so all of them are roots
+				roots_of = [this, &entries_of](unsigned ii)
+				{
+					std::vector<Nd> roots;
+					for (auto kk : entries_of[ii])
+						roots.push_back(space_derivatives_[kk]);
+					if (ii < time_derivatives_.size())
+						roots.push_back(time_derivatives_[ii]);
+					return roots;
+				};
+				task = [this, &entries_of](unsigned ii)
+				{
+					for (auto kk : entries_of[ii])
+						Simplify(space_derivatives_[kk]);
+					if (ii < time_derivatives_.size())
+						Simplify(time_derivatives_[ii]);
+				};
 				break;
-
 		}
-		
-		for (unsigned ii=0; ii<num_vars; ++ii)
-			vars[ii]->set_current_value<dbl>(old_vals[ii]);
-		if (HavePathVariable())
-			path_variable_->set_current_value(old_path_var_val);
-
-
-		for (const auto& n : jacobian_)
-			n->Reset();
-		for (const auto& n : space_derivatives_)
-			n->Reset();
-		for (const auto& n : time_derivatives_)
-			n->Reset();
 
+		AtRandomValues([&]{ ForEachFunction(task, roots_of); });
+		TagDependencies();
 	}
 
 
@@ -1046,6 +1293,35 @@ namespace bertini
 
 
 
+	NodeCounts System::MergeCommonSubexpressions()
+	{
+		if (!is_differentiated_)
+			Differentiate();
+
+		SubexpressionMerger merger;
+
+		for (const auto& iter : constant_subfunctions_)
+			merger.MergeBelow(iter);
+		for (const auto& iter : subfunctions_)
+			merger.MergeBelow(iter);
+		for (const auto& iter : functions_)
+			merger.MergeBelow(iter);
+
+		for (const auto& iter : jacobian_)
+			merger.MergeBelow(iter);
+		for (auto& iter : space_derivatives_)
+			merger.Merge(iter);
+		for (auto& iter : time_derivatives_)
+			merger.Merge(iter);
+
+		TagDependencies();
+		Reset();
+
+		return merger.Counts();
+	}
+
+
+
 
 
 
@@ -1120,11 +1396,12 @@ namespace bertini
 				break;
 			case JacobianEvalMethod::Derivatives:
 				for (int jj = 0; jj < s.NumVariables(); ++jj)
-					for (int ii = 0; ii < s.NumFunctions(); ++ii)
+					for (auto kk = s.jacobian_column_begin_[jj]; kk < s.jacobian_column_begin_[jj+1]; ++kk)
 					{
-						const auto& d = s.space_derivatives_[ii+jj*s.NumFunctions()];
-						out << "jac_space_der(" << ii << "," << jj << ") = " << d << "\n";
+						const auto& d = s.space_derivatives_[kk];
+						out << "jac_space_der(" << s.jacobian_row_[kk] << "," << jj << ") = " << d << "\n";
 					}
+				out << "all other space derivatives are 0\n";
 
 				if (s.HavePathVariable())
 					for (int ii = 0; ii < s.NumFunctions(); ++ii)
@@ -1196,6 +1473,7 @@ namespace bertini
 		for (auto iter=functions_.begin(); iter!=functions_.end(); iter++)
 			(*iter)->SetRoot( (*(rhs.functions_.begin()+(iter-functions_.begin())))->entry_node() + (*iter)->entry_node());
 
+		is_differentiated_ = false;
 		return *this;
 	}
 
@@ -1211,6 +1489,7 @@ namespace bertini
 		{
 			(*iter)->SetRoot( N * (*iter)->entry_node());
 		}
+		is_differentiated_ = false;
 		return *this;
 	}
 
@@ -1254,70 +1533,71 @@ namespace bertini
 
 	System Clone(System const& sys)
 	{
+		std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+		SaveBinary(sys, ss);
+		return LoadBinary(ss);
+	}
 
-//////////////////  attempt 1.  generates a npos == null problem of some sort.  i couldn't figure it out.
-
-
-		// namespace io = boost::iostreams;
-		// using buffer_type = std::vector<char>;
-		// buffer_type buffer;
-
-		// io::stream<io::back_insert_device<buffer_type> > output_stream(buffer);
-		// boost::archive::binary_oarchive oa(output_stream);
-
-		// oa << sys;
-		// output_stream.flush();
-
-		
-
-		// io::basic_array_source<char> source(&buffer[0],buffer.size());
-		// io::stream<io::basic_array_source <char> > input_stream(source);
-		// boost::archive::binary_iarchive ia(input_stream);
 
-		// System sys_clone;
-		// ia >> sys_clone;
+	namespace {
+		/**
+		The first bytes of the binary format, before the version number.
+		*/
+		const char BinaryMagic[] = "bertini2 system";
+	}
 
-		// return sys_clone;
 
+	void SaveBinary(System const& sys, std::ostream & out)
+	{
+		out.write(BinaryMagic, sizeof(BinaryMagic));
+		const std::uint32_t version = SystemBinaryFormatVersion();
+		out.write(reinterpret_cast<const char*>(&version), sizeof(version));
 
+		boost::archive::binary_oarchive oa(out);
+		oa << sys;
+	}
 
-///////////////////////  attempt2  generates crashes.  :(
-		// std::string serial_str;
-		// {
-		// 	boost::iostreams::back_insert_device<std::string> inserter(serial_str);
-		// 	boost::iostreams::stream<boost::iostreams::back_insert_device<std::string> > s(inserter);
-		// 	boost::archive::binary_oarchive oa(s);
 
-		// 	oa << sys;
+	System LoadBinary(std::istream & in)
+	{
+		char magic[sizeof(BinaryMagic)];
+		std::uint32_t version;
+		in.read(magic, sizeof(magic));
+		in.read(reinterpret_cast<char*>(&version), sizeof(version));
 
-		// 	// don't forget to flush the stream to finish writing into the buffer
-		// 	s.flush();
-		// }
-		
-		// boost::iostreams::basic_array_source<char> device(serial_str.data(), serial_str.size());
-		// boost::iostreams::stream<boost::iostreams::basic_array_source<char> > t(device);
-		// boost::archive::binary_iarchive ia(t);
-		// System sys_clone;
-		// ia >> sys_clone;
+		if (!in || std::memcmp(magic, BinaryMagic, sizeof(BinaryMagic))!=0)
+			throw std::runtime_error("reading system in binary format, but input does not start with the bertini2 system header");
+		if (version != SystemBinaryFormatVersion())
+			throw std::runtime_error("reading system in binary format version " + std::to_string(version) + ", but can only read version " + std::to_string(SystemBinaryFormatVersion()));
 
+		System sys;
+		boost::archive::binary_iarchive ia(in);
+		ia >> sys;
+		return sys;
+	}
 
 
+	void SaveBinary(System const& sys, std::string const& filename)
+	{
+		std::ofstream fout(filename, std::ios::binary);
+		if (!fout)
+			throw std::runtime_error("unable to open file " + filename + " for writing system");
+		SaveBinary(sys, fout);
+	}
 
-///////////////////// attempt3.  works.  why the others generate problems with the binary archive baffles me.
 
-		std::stringstream ss;
-		{
-			boost::archive::text_oarchive oa(ss);
-			oa << sys;
-		}
+	System LoadBinary(std::string const& filename)
+	{
+		std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+		if (!fin)
+			throw std::runtime_error("unable to open file " + filename + " for reading system");
 
-		System sys_clone;
-		{
-			boost::archive::text_iarchive ia(ss);
-			ia >> sys_clone;
-		}
+		std::vector<char> buffer(static_cast<std::size_t>(fin.tellg()));
+		fin.seekg(0);
+		fin.read(buffer.data(), buffer.size());
 
-		return sys_clone;
+		boost::iostreams::stream<boost::iostreams::array_source> in(buffer.data(), buffer.size());
+		return LoadBinary(in);
 	}
 
 	void Simplify(System & sys)
@@ -0,0 +1,133 @@
+//This file is part of Bertini 2.
+//
+//trace.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trace.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trace.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file src/tools/trace.cpp
+
+\brief The b2_trace program, which converts binary path tracking traces to other formats.
+
+  b2_trace csv <trace> [output]      all records, as CSV
+  b2_trace chrome <trace> [output]   all records, in Chrome trace format, for chrome://tracing or Perfetto
+  b2_trace path <trace> <index> [output]   the step sequence of one path, as CSV, in the order it happened
+  b2_trace summary <trace>           the number of records and paths, and the paths which ended in failure
+
+Output goes to standard out if no output file is given.  To reproduce a path, track it again with a tracking::TraceReplayer holding the records `path` selects.
+*/
+
+#include "bertini2/io/path_trace.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <map>
+
+
+namespace {
+
+	int Usage()
+	{
+		std::cerr << "usage:\n"
+		          << "  b2_trace csv <trace> [output]\n"
+		          << "  b2_trace chrome <trace> [output]\n"
+		          << "  b2_trace path <trace> <index> [output]\n"
+		          << "  b2_trace summary <trace>\n";
+		return 1;
+	}
+
+
+	template<typename F>
+	void ToOutput(int argc, char** argv, int output_arg, F const& f)
+	{
+		if (argc > output_arg)
+		{
+			std::ofstream out(argv[output_arg]);
+			if (!out)
+				throw std::runtime_error(std::string("unable to open ") + argv[output_arg] + " for writing");
+			f(out);
+		}
+		else
+			f(std::cout);
+	}
+
+
+	/**
+	Paths whose last record is not the end of a successful step sequence: those which were truncated, hit a singular start point, or stopped after a failure.
+	*/
+	void Summary(std::vector<bertini::trace::Record> const& records)
+	{
+		using namespace bertini::trace;
+
+		std::map<std::uint64_t, EventCode> last_meaningful;
+		for (auto const& r : records)
+			if (r.event != EventCode::PathEnded)
+				last_meaningful[r.path] = r.event;
+
+		std::cout << records.size() << " records of " << last_meaningful.size() << " paths\n";
+		for (auto const& p : last_meaningful)
+			if (p.second != EventCode::SuccessfulStep && p.second != EventCode::PrecisionChanged && p.second != EventCode::PathStarted)
+				std::cout << "path " << p.first << " ended after " << Name(p.second) << '\n';
+	}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+	using namespace bertini;
+
+	if (argc < 3)
+		return Usage();
+
+	const std::string mode(argv[1]);
+
+	try
+	{
+		auto records = trace::ReadTrace(argv[2]);
+
+		if (mode=="csv")
+			ToOutput(argc, argv, 3, [&](std::ostream & out){ trace::WriteCSV(out, records); });
+		else if (mode=="chrome")
+			ToOutput(argc, argv, 3, [&](std::ostream & out){ trace::WriteChromeTrace(out, records); });
+		else if (mode=="path")
+		{
+			if (argc < 4)
+				return Usage();
+			auto path = trace::PathRecords(records, std::stoull(argv[3]));
+			if (path.empty())
+				throw std::runtime_error(std::string("no records of path ") + argv[3] + " in trace");
+			ToOutput(argc, argv, 4, [&](std::ostream & out){ trace::WriteCSV(out, path); });
+		}
+		else if (mode=="summary")
+			Summary(records);
+		else
+			return Usage();
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "b2_trace: " << e.what() << '\n';
+		return 1;
+	}
+
+	return 0;
+}
@@ -905,6 +905,59 @@ f->Reset();
 	BOOST_CHECK_EQUAL(init_val, f->Eval<dbl>());
 }
 
+BOOST_AUTO_TEST_CASE(fold_constants_exactly)
+{
+	using bertini::mpq_rational;
+
+	Nd third = MakeRational(mpq_rational(1,3),0);
+	auto c = (third + 2*third) * pow(Nd(MakeInteger(2)),3) / 4; // exactly 2
+	auto f = bertini::MakeFunction(c);
+
+	BOOST_CHECK(bertini::FoldConstants(f) > 0);
+	auto folded = std::dynamic_pointer_cast<bertini::node::Integer>(f->entry_node());
+	BOOST_REQUIRE(folded);
+	BOOST_CHECK_EQUAL(folded->value(), 2);
+
+	// nothing left to fold
+	BOOST_CHECK_EQUAL(bertini::FoldConstants(f), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(fold_constants_complex_rationals)
+{
+	using bertini::mpq_rational;
+
+	Nd a = MakeRational(mpq_rational(1,3),mpq_rational(1,2));
+	Nd b = MakeRational(mpq_rational(2,7),mpq_rational(-1,5));
+	auto f = bertini::MakeFunction(a*b - a/b);
+
+	bertini::FoldConstants(f);
+	auto folded = std::dynamic_pointer_cast<bertini::node::Rational>(f->entry_node());
+	BOOST_REQUIRE(folded);
+
+	// a*b - a/b, worked by hand
+	BOOST_CHECK_EQUAL(folded->real_value(), mpq_rational(3667,15645));
+	BOOST_CHECK_EQUAL(folded->imag_value(), mpq_rational(-8586,5215));
+}
+
+
+BOOST_AUTO_TEST_CASE(fold_constants_leaves_inexact_alone)
+{
+	auto x = MakeVariable("x");
+	auto f = bertini::MakeFunction(bertini::MakeFloat("0.5")*pow(x,2) + sin(MakeOne()) + (MakeOne()+1)*x);
+
+	auto before = f->Eval<dbl>();
+
+	BOOST_CHECK_EQUAL(bertini::FoldConstants(f), 1); // only the 1+1
+	f->Reset();
+	BOOST_CHECK(abs(f->Eval<dbl>() - before) < 1e-15);
+
+	// dividing by an exact zero is not folded
+	auto g = bertini::MakeFunction(MakeOne()/(MakeOne()-1));
+	bertini::FoldConstants(g);
+	BOOST_CHECK(!std::dynamic_pointer_cast<bertini::node::Number>(g->entry_node()));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // simplify
 
 
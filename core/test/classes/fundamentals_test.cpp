@@ -27,6 +27,8 @@
 #include <boost/multiprecision/mpfr.hpp>
 #include <boost/multiprecision/random.hpp>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "bertini2/limbo.hpp"
 #include "bertini2/num_traits.hpp"
@@ -108,6 +110,27 @@ BOOST_AUTO_TEST_CASE(complex_double_random_subsequent_not_equal)
 }
 
 
+// trackers on several threads at once draw random numbers at every step, so each thread has its own engine, seeded differently, so they don't all draw the same numbers
+BOOST_AUTO_TEST_CASE(complex_double_random_engine_per_thread)
+{
+	auto draw = [](std::vector<dbl> & v)
+	{
+		for (int ii=0; ii<1000; ++ii)
+			v.push_back(bertini::RandomUnit<dbl>());
+	};
+
+	std::vector<dbl> a, b, fresh;
+	std::thread t1(draw, std::ref(a)), t2(draw, std::ref(b));
+	t1.join();
+	t2.join();
+	std::thread(draw, std::ref(fresh)).join();
+
+	BOOST_CHECK(a!=b);
+	BOOST_CHECK(a!=fresh);
+	BOOST_CHECK(b!=fresh);
+}
+
+
 BOOST_AUTO_TEST_CASE(mpfr_float_can_be_nan)
 {
 	DefaultPrecision(50);
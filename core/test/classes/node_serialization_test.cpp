@@ -50,6 +50,10 @@
 #include "bertini2/system/system.hpp"
 #include "bertini2/io/parsing/system_parsers.hpp"
 #include "bertini2/system/precon.hpp"
+#include "bertini2/system/homotopy_cache.hpp"
+#include "bertini2/system/start_systems.hpp"
+
+#include <boost/filesystem.hpp>
 
 
 
@@ -69,6 +73,7 @@ using bertini::MakeFloat;
 
 using dbl = bertini::dbl;
 using mpfr = bertini::mpfr;
+using mpfr_float = bertini::mpfr_float;
 
 using System = bertini::System;
 
@@ -244,6 +249,132 @@ BOOST_AUTO_TEST_CASE(clone_griewank_osborn)
 	auto clone = bertini::Clone(gw);
 }
 
+BOOST_AUTO_TEST_CASE(system_binary_round_trip)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y; f2 = x1*y; ";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	sys.Differentiate();
+
+	std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+	bertini::SaveBinary(sys, ss);
+	auto sys2 = bertini::LoadBinary(ss);
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(3.0);
+
+	Vec<dbl> v = sys2.Eval(values);
+	BOOST_CHECK_EQUAL(v.size(),2);
+	BOOST_CHECK_EQUAL(v(0), 36.0);
+	BOOST_CHECK_EQUAL(v(1), 12.0);
+
+	BOOST_CHECK_EQUAL(sys2.NumJacobianNonzeros(), sys.NumJacobianNonzeros());
+	Mat<dbl> J = sys.Jacobian(values);
+	Mat<dbl> J2 = sys2.Jacobian(values);
+	BOOST_CHECK_SMALL((J-J2).norm(), threshold_clearance_d);
+}
+
+
+BOOST_AUTO_TEST_CASE(system_binary_file_round_trip)
+{
+	auto gw = bertini::system::Precon::GriewankOsborn();
+	gw.SetUsePolynomialTable(false);
+	gw.SetMaxDifferentiationThreads(3);
+	gw.Differentiate();
+
+	const auto filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("serialization_test_binary_system_%%%%%%%%")).string();
+	bertini::SaveBinary(gw, filename);
+	auto loaded = bertini::LoadBinary(filename);
+	boost::filesystem::remove(filename);
+
+	// settings survive the round trip, so Clone keeps them too
+	BOOST_CHECK_EQUAL(loaded.MaxDifferentiationThreads(), 3);
+	BOOST_CHECK(!loaded.UsesPolynomialTable());
+	BOOST_CHECK_EQUAL(bertini::Clone(gw).MaxDifferentiationThreads(), 3);
+
+	Vec<mpfr> values(2);
+	values << mpfr("0.3","0.1"), mpfr("-0.7","0.2");
+
+	Vec<mpfr> v = gw.Eval(values);
+	Vec<mpfr> v2 = loaded.Eval(values);
+	BOOST_CHECK_SMALL(mpfr_float((v-v2).norm()), threshold_clearance_mp);
+
+	Mat<mpfr> J = gw.Jacobian(values);
+	Mat<mpfr> J2 = loaded.Jacobian(values);
+	BOOST_CHECK_SMALL(mpfr_float((J-J2).norm()), threshold_clearance_mp);
+}
+
+
+BOOST_AUTO_TEST_CASE(system_binary_refuses_other_formats)
+{
+	std::string str = "function f1; variable_group x1; f1 = x1^2-1; ";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	std::stringstream text;
+	{
+		boost::archive::text_oarchive oa(text);
+		oa << sys;
+	}
+	BOOST_CHECK_THROW(bertini::LoadBinary(text), std::runtime_error);
+
+	std::stringstream empty;
+	BOOST_CHECK_THROW(bertini::LoadBinary(empty), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(homotopy_cache_round_trip)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; f1 = x1^2 + x2 - 1; f2 = x1*x2 - 2; ";
+
+	bertini::System sys;
+	bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+
+	auto key = bertini::HomotopyCache::Key(sys, "total degree t");
+	BOOST_CHECK_EQUAL(key.size(), 16);
+	BOOST_CHECK_EQUAL(key, bertini::HomotopyCache::Key(bertini::Clone(sys), "total degree t"));
+	BOOST_CHECK(key != bertini::HomotopyCache::Key(sys, "mhom t"));
+	BOOST_CHECK_EQUAL(bertini::HomotopyCache::Key(key, "t"), bertini::HomotopyCache::Key(key, "t"));
+	BOOST_CHECK(bertini::HomotopyCache::Key(key, "t") != bertini::HomotopyCache::Key(key, "s"));
+
+	auto target = bertini::Clone(sys);
+	target.Homogenize();
+	target.AutoPatch();
+	bertini::start_system::TotalDegree start(target);
+	auto t = MakeVariable("t");
+	System homotopy = (1-t)*target + bertini::MakeRational(bertini::node::Rational::Rand())*t*start;
+	homotopy.AddPathVariable(t);
+	homotopy.Differentiate();
+
+	const auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("homotopy_cache_%%%%%%%%");
+	bertini::HomotopyCache cache(directory.string());
+
+	System loaded_target, loaded_homotopy;
+	bertini::start_system::TotalDegree loaded_start;
+	BOOST_CHECK(!cache.Load(key, loaded_target, loaded_start, loaded_homotopy));
+
+	cache.Store(key, target, start, homotopy);
+	BOOST_CHECK(cache.Load(key, loaded_target, loaded_start, loaded_homotopy));
+
+	BOOST_CHECK_EQUAL(loaded_start.NumStartPoints(), start.NumStartPoints());
+	BOOST_CHECK_EQUAL(loaded_homotopy.NumVariables(), homotopy.NumVariables());
+
+	Vec<dbl> values(3);
+	values << dbl(0.3,0.1), dbl(-0.7,0.2), dbl(1.1,-0.4);
+	dbl time(0.4,0.1);
+
+	Vec<dbl> v = homotopy.Eval(values, time);
+	Vec<dbl> v2 = loaded_homotopy.Eval(values, time);
+	BOOST_CHECK_SMALL((v-v2).norm(), threshold_clearance_d);
+
+	Mat<dbl> J = homotopy.Jacobian(values, time);
+	Mat<dbl> J2 = loaded_homotopy.Jacobian(values, time);
+	BOOST_CHECK_SMALL((J-J2).norm(), threshold_clearance_d);
+
+	boost::filesystem::remove_all(directory);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -419,6 +419,140 @@ BOOST_AUTO_TEST_CASE(total_degree_start_system_coefficient_bound_degree_bound)
 
 
 
+BOOST_AUTO_TEST_CASE(mhom_start_system_bigraded_num_start_points)
+{
+	Var x1 = MakeVariable("x1"), x2 = MakeVariable("x2"), y = MakeVariable("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x1,x2});
+	sys.AddVariableGroup(VariableGroup{y});
+
+	sys.AddFunction(x1*y + x2 - 1);
+	sys.AddFunction(x2*y + x1*x1*x2 + 2);
+	sys.AddFunction(x1*x1 + x2*x2 - 3);
+
+	bertini::start_system::MHomogeneous MH(sys);
+
+	BOOST_CHECK_EQUAL(MH.Degree(0,0), 1);
+	BOOST_CHECK_EQUAL(MH.Degree(0,1), 1);
+	BOOST_CHECK_EQUAL(MH.Degree(1,0), 3);
+	BOOST_CHECK_EQUAL(MH.Degree(1,1), 1);
+	BOOST_CHECK_EQUAL(MH.Degree(2,0), 2);
+	BOOST_CHECK_EQUAL(MH.Degree(2,1), 0);
+
+	// the third function must take an x factor, and one of the first two takes y:  1*3*2 + 1*1*2
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 8);
+
+	bertini::start_system::TotalDegree TD(sys);
+	BOOST_CHECK_EQUAL(TD.NumStartPoints(), 12);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(mhom_start_system_start_points_are_distinct_solutions)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x1 = MakeVariable("x1"), x2 = MakeVariable("x2"), y1 = MakeVariable("y1"), y2 = MakeVariable("y2");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x1,x2});
+	sys.AddVariableGroup(VariableGroup{y1,y2});
+
+	sys.AddFunction(x1*y1 + x2*y2 - 1);
+	sys.AddFunction(x1*y2 - x2*y1*y1 + 2);
+	sys.AddFunction(x1*x2 + y1 - 3);
+	sys.AddFunction(x2*y2 + y1*y2 + 4);
+
+	bertini::start_system::MHomogeneous MH(sys);
+	const auto num_points = MH.NumStartPoints();
+	BOOST_CHECK(num_points > 0);
+	BOOST_CHECK(num_points < bertini::start_system::TotalDegree(sys).NumStartPoints());
+
+	std::vector<Vec<dbl>> points;
+	for (unsigned long long ii = 0; ii < num_points; ++ii)
+	{
+		auto start = MH.StartPoint<dbl>(ii);
+		auto function_values = MH.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+
+		for (auto const& p : points)
+			BOOST_CHECK((p-start).norm() > 1e-8);
+		points.push_back(start);
+	}
+
+	BOOST_CHECK_THROW(MH.StartPoint<dbl>(num_points), std::out_of_range);
+
+	for (unsigned long long ii = 0; ii < num_points; ++ii)
+	{
+		auto start = MH.StartPoint<mpfr>(ii);
+		auto function_values = MH.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_CASE(mhom_start_system_homogenized_and_patched)
+{
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = MakeVariable("x"), y = MakeVariable("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddVariableGroup(VariableGroup{y});
+
+	sys.AddFunction(x*y + x - 1);
+	sys.AddFunction(x*x*y + y + 2);
+
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	bertini::start_system::MHomogeneous MH(sys);
+	BOOST_CHECK(MH.IsHomogeneous());
+	BOOST_CHECK(MH.IsPatched());
+
+	// total degree would be 6
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 3);
+
+	for (unsigned long long ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<dbl>(ii);
+		BOOST_CHECK_EQUAL(start.size(), 4);
+
+		auto function_values = MH.Eval(start);
+		BOOST_CHECK_EQUAL(function_values.size(), 4);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+
+	Var t = MakeVariable("t");
+	auto final_system = (1-t)*sys + t*MH;
+	final_system.AddPathVariable(t);
+	BOOST_CHECK_EQUAL(final_system.NumTotalFunctions(), 4);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(mhom_start_system_nonpolynomial_should_throw)
+{
+	Var x = MakeVariable("x"), y = MakeVariable("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddVariableGroup(VariableGroup{y});
+
+	sys.AddFunction(exp(x)*y - 1);
+	sys.AddFunction(x*y + 2);
+
+	BOOST_CHECK_THROW(bertini::start_system::MHomogeneous MH(sys), std::runtime_error);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
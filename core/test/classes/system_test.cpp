@@ -410,6 +410,33 @@ BOOST_AUTO_TEST_CASE(system_evaluate_double)
 }
 
 
+
+/**
+\class bertini::System
+\test \b parsed_signs_bind_looser_than_powers
+
+A sign binds tighter than + and -, and looser than ^, whether what follows it is a symbol or a number.  A number not raised to a power carries its sign.
+*/
+BOOST_AUTO_TEST_CASE(parsed_signs_bind_looser_than_powers)
+{
+	std::string str = "function f1, f2, f3, f4, f5; variable_group x, y; f1 = -2^2 + x; f2 = -x^2 + y; f3 = -x + y; f4 = x*-2; f5 = -2.5^2 - -3;";
+
+	bertini::System sys;
+	bool s = bertini::parsing::classic::parse(str.begin(), str.end(), sys);
+	BOOST_CHECK(s);
+
+	Vec<dbl> values(2);
+	values << dbl(2), dbl(5);
+	auto v = sys.Eval(values);
+
+	BOOST_CHECK_EQUAL(v(0), dbl(-2));
+	BOOST_CHECK_EQUAL(v(1), dbl(1));
+	BOOST_CHECK_EQUAL(v(2), dbl(3));
+	BOOST_CHECK_EQUAL(v(3), dbl(-4));
+	BOOST_CHECK_EQUAL(v(4), dbl(-3.25));
+}
+
+
 /**
 \class bertini::System
 \test \b system_evaluate_mpfr Evaluate a system in multiple precision.
@@ -1068,6 +1095,360 @@ BOOST_AUTO_TEST_CASE(clone_system_new_variables_evaluation)
 	BOOST_CHECK_EQUAL(f_clone2,f2);
 }
 
+BOOST_AUTO_TEST_CASE(merge_common_subexpressions_of_separately_built_trees)
+{
+	Var x = MakeVariable("x"), y = MakeVariable("y");
+
+	std::vector<std::shared_ptr<bertini::node::Node>> roots{
+		pow(x+y,2)*exp(x*y),
+		pow(x+y,2)*exp(x*y),
+		x*y - 1
+	};
+
+	auto v1 = roots[0]->Eval<dbl>();
+	auto v3 = roots[2]->Eval<dbl>();
+
+	auto counts = bertini::MergeCommonSubexpressions(roots);
+
+	BOOST_CHECK(roots[0]==roots[1]);
+	BOOST_CHECK(counts.after < counts.before);
+
+	// merging again finds nothing new
+	auto counts_again = bertini::MergeCommonSubexpressions(roots);
+	BOOST_CHECK_EQUAL(counts_again.before, counts.after);
+	BOOST_CHECK_EQUAL(counts_again.after, counts.after);
+
+	roots[0]->Reset(); roots[2]->Reset();
+	BOOST_CHECK_EQUAL(roots[0]->Eval<dbl>(), v1);
+	BOOST_CHECK_EQUAL(roots[2]->Eval<dbl>(), v3);
+}
+
+
+BOOST_AUTO_TEST_CASE(merge_common_subexpressions_different_variables_not_merged)
+{
+	Var x = MakeVariable("x"), y = MakeVariable("x");
+
+	std::vector<std::shared_ptr<bertini::node::Node>> roots{ x*x+1, y*y+1 };
+	auto counts = bertini::MergeCommonSubexpressions(roots);
+
+	BOOST_CHECK(roots[0]!=roots[1]);
+	BOOST_CHECK_EQUAL(counts.after+1, counts.before); // only the 1's are merged
+}
+
+
+BOOST_AUTO_TEST_CASE(system_merge_common_subexpressions_preserves_evaluation)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = MakeVariable("x"), y = MakeVariable("y"), t = MakeVariable("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+
+	sys.AddFunction(pow(x+y,3) + x*y*t - 1);
+	sys.AddFunction(pow(x+y,3) - x*y*t + sin(x*y));
+
+	Vec<mpfr> v(2);
+	v << mpfr(0.5,-0.25), mpfr(-1.5,0.75);
+	mpfr time(0.3,0.1);
+
+	auto f_before = sys.Eval(v,time);
+	auto J_before = sys.Jacobian(v,time);
+	auto dt_before = sys.TimeDerivative(v,time);
+
+	auto counts = sys.MergeCommonSubexpressions();
+	BOOST_CHECK(counts.after < counts.before);
+
+	auto f_after = sys.Eval(v,time);
+	auto J_after = sys.Jacobian(v,time);
+	auto dt_after = sys.TimeDerivative(v,time);
+
+	BOOST_CHECK((f_after-f_before).norm() < threshold_clearance_mp);
+	BOOST_CHECK((J_after-J_before).norm() < threshold_clearance_mp);
+	BOOST_CHECK((dt_after-dt_before).norm() < threshold_clearance_mp);
+
+	Vec<dbl> v_d(2);
+	v_d << dbl(0.1,0.2), dbl(-0.3,0.4);
+	auto f_d = sys.Eval(v_d, dbl(0.7,0.1));
+	BOOST_CHECK(abs(f_d(0) - (pow(v_d(0)+v_d(1),3) + v_d(0)*v_d(1)*dbl(0.7,0.1) - 1.0)) < threshold_clearance_d);
+}
+
+
+BOOST_AUTO_TEST_CASE(selective_reset_tags_dependencies)
+{
+	Var x = MakeVariable("x"), t = MakeVariable("t");
+
+	auto c = sin(MakeFloat("0.3")) + 2;
+	auto tt = t*t;
+	auto xx = x*x;
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+	sys.AddFunction(c*xx + tt);
+
+	sys.Differentiate();
+
+	BOOST_CHECK(c->GetDependency()==node::Dependency::None);
+	BOOST_CHECK(tt->GetDependency()==node::Dependency::Time);
+	BOOST_CHECK(xx->GetDependency()==node::Dependency::Space);
+}
+
+
+BOOST_AUTO_TEST_CASE(selective_reset_matches_full_evaluation)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = MakeVariable("x"), y = MakeVariable("y"), t = MakeVariable("t");
+
+	auto c = exp(MakeFloat("0.25")) * sin(MakeFloat("0.5"));
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(c*x*y + t*t - 1);
+	sys.AddFunction(pow(x,2) - c*t + y);
+	sys.Differentiate();
+
+	auto check_at = [&](Vec<dbl> const& v, dbl const& time)
+	{
+		const dbl cv = std::exp(0.25)*std::sin(0.5);
+		auto f = sys.Eval(v, time);
+		BOOST_CHECK(abs(f(0) - (cv*v(0)*v(1) + time*time - 1.0)) < threshold_clearance_d);
+		BOOST_CHECK(abs(f(1) - (v(0)*v(0) - cv*time + v(1))) < threshold_clearance_d);
+
+		auto J = sys.Jacobian(v, time);
+		BOOST_CHECK(abs(J(0,0) - cv*v(1)) < threshold_clearance_d);
+		BOOST_CHECK(abs(J(1,0) - 2.0*v(0)) < threshold_clearance_d);
+
+		auto dt = sys.TimeDerivative(v, time);
+		BOOST_CHECK(abs(dt(0) - 2.0*time) < threshold_clearance_d);
+		BOOST_CHECK(abs(dt(1) + cv) < threshold_clearance_d);
+	};
+
+	Vec<dbl> v(2);
+	v << dbl(0.1,0.2), dbl(-0.3,0.4);
+	check_at(v, dbl(0.7,0.1));
+
+	// same time, new space point
+	v << dbl(1.1,-0.2), dbl(0.5,0.6);
+	check_at(v, dbl(0.7,0.1));
+
+	// same space point, new time
+	check_at(v, dbl(-0.2,0.9));
+
+	// evaluation in multiple precision, at a new precision
+	bertini::DefaultPrecision(50);
+	sys.precision(50);
+	Vec<mpfr> v_mp(2);
+	v_mp << mpfr("0.1","0.2"), mpfr("-0.3","0.4");
+	mpfr time_mp("0.7","0.1");
+	auto f_mp = sys.Eval(v_mp, time_mp);
+
+	mpfr cv = exp(mpfr("0.25"))*sin(mpfr("0.5"));
+	BOOST_CHECK(abs(f_mp(0) - (cv*v_mp(0)*v_mp(1) + time_mp*time_mp - mpfr(1))) < mpfr_float("1e-45"));
+	BOOST_CHECK(abs(f_mp(1) - (v_mp(0)*v_mp(0) - cv*time_mp + v_mp(1))) < mpfr_float("1e-45"));
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_CASE(polynomial_table_expands_sparsely)
+{
+	Var x = MakeVariable("x"), y = MakeVariable("y");
+
+	std::vector<std::shared_ptr<node::Function>> functions{MakeFunction(pow(x+y,2) - 2*x*y), MakeFunction(x*pow(y,3)/2)};
+	PolynomialTable table(functions, VariableGroup{x,y}, nullptr);
+
+	BOOST_CHECK_EQUAL(table.NumFunctions(), 2);
+	BOOST_CHECK_EQUAL(table.NumTerms(), 4); // x^2, xy with coefficient 0, y^2, and xy^3
+	BOOST_CHECK_EQUAL(table.MaxExponent(), 3);
+
+	x->set_current_value(dbl(0.5,0.25));
+	y->set_current_value(dbl(-1.5,0.75));
+	Vec<dbl> f(2);
+	table.EvalInPlace(f);
+	BOOST_CHECK(abs(f(0) - (dbl(0.5,0.25)*dbl(0.5,0.25) + dbl(-1.5,0.75)*dbl(-1.5,0.75))) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - dbl(0.5,0.25)*pow(dbl(-1.5,0.75),3)/2.) < threshold_clearance_d);
+}
+
+
+BOOST_AUTO_TEST_CASE(polynomial_table_not_used_for_non_polynomials)
+{
+	Var x = MakeVariable("x"), y = MakeVariable("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(sin(x) + y);
+	sys.Differentiate();
+
+	BOOST_CHECK(!sys.UsesPolynomialTable());
+
+	std::vector<std::shared_ptr<node::Function>> functions{MakeFunction(x/y)};
+	BOOST_CHECK_THROW(PolynomialTable(functions, VariableGroup{x,y}, nullptr), std::runtime_error);
+	BOOST_CHECK(!PolynomialTable::Make(functions, VariableGroup{x,y}, nullptr));
+
+	std::vector<std::shared_ptr<node::Function>> big{MakeFunction(pow(x+y,20))};
+	BOOST_CHECK(!PolynomialTable::Make(big, VariableGroup{x,y}, nullptr, 10));
+	BOOST_CHECK(PolynomialTable::Make(big, VariableGroup{x,y}, nullptr));
+}
+
+
+BOOST_AUTO_TEST_CASE(polynomial_table_matches_trees)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = MakeVariable("x"), y = MakeVariable("y"), t = MakeVariable("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddPathVariable(t);
+	sys.AddFunction((1-t)*(pow(x,3) - 1) + t*(x*y - MakeFloat("0.3","0.1")*pow(y,2)));
+	sys.AddFunction(pow(x-2*y+t,4)/3 - sqrt(MakeInteger(2))*x);
+	sys.Differentiate();
+
+	BOOST_CHECK(sys.UsesPolynomialTable());
+
+	Vec<dbl> v(2);
+	v << dbl(0.1,0.2), dbl(-0.3,0.4);
+	dbl time(0.7,0.1);
+	auto f_table = sys.Eval(v, time);
+	auto J_table = sys.Jacobian(v, time);
+	auto dt_table = sys.TimeDerivative(v, time);
+
+	Vec<mpfr> v_mp(2);
+	v_mp << mpfr("0.1","0.2"), mpfr("-0.3","0.4");
+	mpfr time_mp("0.7","0.1");
+	auto f_table_mp = sys.Eval(v_mp, time_mp);
+	auto J_table_mp = sys.Jacobian(v_mp, time_mp);
+	auto dt_table_mp = sys.TimeDerivative(v_mp, time_mp);
+
+	sys.SetUsePolynomialTable(false);
+	BOOST_CHECK(!sys.UsesPolynomialTable());
+
+	BOOST_CHECK((sys.Eval(v, time) - f_table).norm() < 1e-13);
+	BOOST_CHECK((sys.Jacobian(v, time) - J_table).norm() < 1e-13);
+	BOOST_CHECK((sys.TimeDerivative(v, time) - dt_table).norm() < 1e-13);
+
+	BOOST_CHECK((sys.Eval(v_mp, time_mp) - f_table_mp).norm() < threshold_clearance_mp);
+	BOOST_CHECK((sys.Jacobian(v_mp, time_mp) - J_table_mp).norm() < threshold_clearance_mp);
+	BOOST_CHECK((sys.TimeDerivative(v_mp, time_mp) - dt_table_mp).norm() < threshold_clearance_mp);
+}
+
+
+BOOST_AUTO_TEST_CASE(precision_change_reaches_nodes_lazily)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = MakeVariable("x"), y = MakeVariable("y");
+
+	auto c = exp(MakeRational(mpq_rational(1,4),0)) * sin(MakeFloat("0.5"));
+	auto f = c*x*y - sin(x);
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(f);
+	sys.AddFunction(pow(x,2) + y);
+	sys.Differentiate();
+
+	Vec<mpfr> v(2);
+	v << mpfr("0.1","0.2"), mpfr("-0.3","0.4");
+	sys.Eval(v);
+	BOOST_CHECK_EQUAL(f->precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::DefaultPrecision(60);
+	sys.precision(60);
+	BOOST_CHECK_EQUAL(f->precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS); // untouched until evaluated
+
+	v << mpfr("0.1","0.2"), mpfr("-0.3","0.4");
+	auto values = sys.Eval(v);
+	auto J = sys.Jacobian(v);
+	BOOST_CHECK_EQUAL(f->precision(), 60);
+	BOOST_CHECK_EQUAL(c->precision(), 60);
+
+	mpfr cv = exp(mpfr("0.25"))*sin(mpfr("0.5"));
+	BOOST_CHECK(abs(values(0) - (cv*v(0)*v(1) - sin(v(0)))) < mpfr_float("1e-55"));
+	BOOST_CHECK(abs(J(0,0) - (cv*v(1) - cos(v(0)))) < mpfr_float("1e-55"));
+	BOOST_CHECK(abs(J(1,0) - mpfr(2)*v(0)) < mpfr_float("1e-55"));
+
+	// and back down again
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	sys.precision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	v << mpfr("0.1","0.2"), mpfr("-0.3","0.4");
+	values = sys.Eval(v);
+	BOOST_CHECK_EQUAL(f->precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	BOOST_CHECK(abs(values(0) - (cv*v(0)*v(1) - sin(v(0)))) < threshold_clearance_mp);
+}
+
+
+BOOST_AUTO_TEST_CASE(jacobian_sparsity_pattern)
+{
+	Var x = MakeVariable("x"), y = MakeVariable("y"), z = MakeVariable("z");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(y + sin(z));
+	sys.AddFunction(x);
+	sys.Differentiate();
+
+	BOOST_CHECK_EQUAL(sys.NumJacobianNonzeros(), 5);
+	BOOST_CHECK(sys.JacobianColumnBegin() == (std::vector<unsigned>{0,2,4,5}));
+	BOOST_CHECK(sys.JacobianRows() == (std::vector<unsigned>{0,2,0,1,1}));
+
+	Vec<dbl> v(3);
+	v << dbl(0.1,0.2), dbl(-0.3,0.4), dbl(0.5,-0.6);
+	auto J = sys.Jacobian(v);
+
+	Mat<dbl> expected = Mat<dbl>::Zero(3,3);
+	expected(0,0) = v(1); expected(0,1) = v(0);
+	expected(1,1) = dbl(1); expected(1,2) = cos(v(2));
+	expected(2,0) = dbl(1);
+	BOOST_CHECK((J - expected).norm() < threshold_clearance_d);
+}
+
+
+BOOST_AUTO_TEST_CASE(differentiate_in_parallel_matches_serial)
+{
+	const unsigned n = 40;
+	VariableGroup x;
+	for (unsigned ii = 0; ii < n; ++ii)
+		x.push_back(MakeVariable("x" + std::to_string(ii)));
+	Var t = MakeVariable("t");
+
+	auto shared = x[0]*x[1] + 1; // in several functions, so they must be done together
+
+	auto make = [&](unsigned num_threads)
+	{
+		System sys;
+		sys.AddVariableGroup(x);
+		sys.AddPathVariable(t);
+		for (unsigned ii = 0; ii < n; ++ii)
+		{
+			auto f = pow(x[ii],2)*x[(ii+1)%n] - t*x[(ii+7)%n] + sin(x[(ii+3)%n]);
+			if (ii%5==0)
+				f = f + shared*x[ii];
+			sys.AddFunction(f);
+		}
+		sys.SetMaxDifferentiationThreads(num_threads);
+		sys.Differentiate();
+		return sys;
+	};
+
+	auto serial = make(1);
+	auto parallel = make(4);
+
+	BOOST_CHECK_EQUAL(serial.NumJacobianNonzeros(), parallel.NumJacobianNonzeros());
+	BOOST_CHECK(serial.NumJacobianNonzeros() < n*n/4);
+
+	auto v = RandomOfUnits<dbl>(n);
+	dbl time(0.3,0.2);
+	BOOST_CHECK((serial.Jacobian(v, time) - parallel.Jacobian(v, time)).norm() < threshold_clearance_d);
+	BOOST_CHECK((serial.TimeDerivative(v, time) - parallel.TimeDerivative(v, time)).norm() < threshold_clearance_d);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
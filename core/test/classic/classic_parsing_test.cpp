@@ -33,6 +33,7 @@
 #include "bertini.hpp"
 #include <bertini2/io/parsing/classic_utilities.hpp>
 #include <string>
+#include <sstream>
 #include <boost/test/unit_test.hpp>
 
 
@@ -625,6 +626,124 @@ BOOST_AUTO_TEST_CASE(test_split_and_uncomment)
 }
 
 
+BOOST_AUTO_TEST_CASE(streaming_parser_matches_qi_parser)
+{
+	using namespace bertini;
+	std::string input = "variable_group x, y;\nvariable z;\npathvariable t;\nparameter s;\nconstant c;\nfunction f1, f2, f3;\nc = 1.5e-1 + 2*I;\ns = t;\ny2 = y^2;\nf1 = x*y2 - 3/4*z + c*s;\nf2 = (x - z)^3 * sin(y) + exp(x*z) - 0.25;\nf3 = sqrt(x + 2) / (y - 7) + x^-2 - Pi*z;\n";
+
+	System qi(input);
+	std::stringstream ss(input);
+	auto streamed = parsing::classic::ParseSystem(ss);
+
+	BOOST_CHECK_EQUAL(streamed.NumVariables(), qi.NumVariables());
+	BOOST_CHECK_EQUAL(streamed.NumFunctions(), qi.NumFunctions());
+	BOOST_CHECK_EQUAL(streamed.NumVariableGroups(), qi.NumVariableGroups());
+	BOOST_CHECK(streamed.HavePathVariable());
+
+	Vec<dbl> x(3);
+	x << dbl(0.3,-0.2), dbl(1.1,0.4), dbl(-0.7,0.9);
+	dbl t(0.6,0.1);
+
+	auto f_qi = qi.Eval(x, t);
+	auto f_streamed = streamed.Eval(x, t);
+	for (int ii = 0; ii < f_qi.size(); ++ii)
+		BOOST_CHECK(abs(f_qi(ii) - f_streamed(ii)) < 1e-14);
+
+	qi.Differentiate();
+	streamed.Differentiate();
+	auto J_qi = qi.Jacobian(x, t);
+	auto J_streamed = streamed.Jacobian(x, t);
+	for (int ii = 0; ii < J_qi.rows(); ++ii)
+		for (int jj = 0; jj < J_qi.cols(); ++jj)
+			BOOST_CHECK(abs(J_qi(ii,jj) - J_streamed(ii,jj)) < 1e-13);
+}
+
+
+BOOST_AUTO_TEST_CASE(streaming_parser_reads_whole_input_file)
+{
+	using namespace bertini;
+	std::string input = "% a classic input file\nCONFIG\ntracktype: 0; % comment about setting\nfinaltol: 1e-11;\nEND;\nINPUT\nvariable_group x,y;\nfunction f, g;\n% f = junk;\nf = x^2 + y^2 - 1; % the circle\ng = x - y;\nEND;\nthis is ignored";
+
+	std::stringstream ss(input);
+	auto sys = parsing::classic::ParseSystem(ss);
+
+	BOOST_CHECK_EQUAL(sys.NumVariables(), 2);
+	BOOST_CHECK_EQUAL(sys.NumFunctions(), 2);
+
+	Vec<dbl> x(2);
+	x << dbl(2), dbl(3);
+	auto f = sys.Eval(x);
+	BOOST_CHECK_EQUAL(f(0), dbl(12));
+	BOOST_CHECK_EQUAL(f(1), dbl(-1));
+}
+
+
+BOOST_AUTO_TEST_CASE(streaming_parser_signs_match_qi_parser)
+{
+	using namespace bertini;
+	std::string input = "variable_group x, y;\nfunction f1, f2, f3, f4, f5;\nf1 = -x + y;\nf2 = -2^2 + x;\nf3 = x*-y - -3;\nf4 = -x^2 - +y;\nf5 = x^-y^2 + -(x-y)*y;\n";
+
+	System qi(input);
+	std::stringstream ss(input);
+	auto streamed = parsing::classic::ParseSystem(ss);
+
+	Vec<dbl> x(2);
+	x << dbl(2), dbl(5);
+	auto f = streamed.Eval(x);
+	auto f_qi = qi.Eval(x);
+	for (int ii = 0; ii < f.size(); ++ii)
+		BOOST_CHECK(abs(f(ii) - f_qi(ii)) < 1e-14);
+
+	// a sign binds tighter than + and -, and looser than ^, whether it precedes a symbol or a number
+	BOOST_CHECK_EQUAL(f(0), dbl(3));
+	BOOST_CHECK_EQUAL(f(1), dbl(-2));
+	BOOST_CHECK_EQUAL(f(2), dbl(-7));
+	BOOST_CHECK_EQUAL(f(3), dbl(-9));
+}
+
+
+BOOST_AUTO_TEST_CASE(streaming_tokenizer_across_buffer_boundaries)
+{
+	using bertini::parsing::classic::InputTokenizer;
+	std::string input = "f = 2e + 3.5E-2*x^2 - .5; % 1e7\nz1_[2]=1e5;";
+
+	for (std::size_t buffer_size : {1, 2, 3, 7, 1024})
+	{
+		std::stringstream ss(input);
+		InputTokenizer tokens(ss, buffer_size);
+
+		std::vector<std::string> texts;
+		while (tokens.Peek().kind != InputTokenizer::Kind::End)
+			texts.push_back(tokens.Next().text);
+
+		std::vector<std::string> expected{"f","=","2","e","+","3.5e-2","*","x","^","2","-",".5",";","z1_[2]","=","1e5",";"};
+		BOOST_CHECK(texts == expected);
+	}
+}
+
+
+BOOST_AUTO_TEST_CASE(streaming_parser_reports_line_of_error)
+{
+	using namespace bertini;
+	std::stringstream undeclared("variable_group x;\nfunction f;\n\nf = x + q;\n");
+	try
+	{
+		parsing::classic::ParseSystem(undeclared);
+		BOOST_FAIL("parsing an undeclared symbol should throw");
+	}
+	catch (std::runtime_error const& e)
+	{
+		BOOST_CHECK(std::string(e.what()).find("line 4")!=std::string::npos);
+	}
+
+	std::stringstream redeclared("variable_group x;\nfunction x;\n");
+	BOOST_CHECK_THROW(parsing::classic::ParseSystem(redeclared), std::runtime_error);
+
+	std::stringstream unterminated("variable_group x;\nfunction f;\nf = x^2");
+	BOOST_CHECK_THROW(parsing::classic::ParseSystem(unterminated), std::runtime_error);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
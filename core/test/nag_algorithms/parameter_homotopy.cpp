@@ -0,0 +1,130 @@
+//This file is part of Bertini 2.
+//
+//test/nag_algorithms/parameter_homotopy.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//test/nag_algorithms/parameter_homotopy.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with test/nag_algorithms/parameter_homotopy.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+/**
+\file test/nag_algorithms/parameter_homotopy.cpp  Tests the parameter homotopy algorithm.
+*/
+
+#include "bertini2/nag_algorithms/parameter_homotopy.hpp"
+#include "bertini2/endgames.hpp"
+#include <boost/test/unit_test.hpp>
+
+
+BOOST_AUTO_TEST_SUITE(parameter_homotopy)
+
+using TrackerT = bertini::tracking::DoublePrecisionTracker;
+using EndgameT = bertini::endgame::EndgameSelector<TrackerT>::Cauchy;
+
+
+/**
+x^2 = p, moved from generic p to p = 4, 9, and -1.  The generic solutions are the square roots of the generic p.
+*/
+BOOST_AUTO_TEST_CASE(square_roots)
+{
+	using namespace bertini;
+
+	auto x = MakeVariable("x");
+	auto t = MakeVariable("t");
+	auto p = MakeVariable("p");
+
+	dbl p_generic(0.3, 0.7);
+	auto p_generic_node = MakeFloat("0.3","0.7");
+
+	System homotopy;
+	homotopy.AddFunction(x*x - ((1-t)*p + t*p_generic_node));
+	homotopy.AddVariableGroup(VariableGroup{x});
+	homotopy.AddPathVariable(t);
+	homotopy.AddImplicitParameters(VariableGroup{p});
+
+	using std::sqrt;
+	auto r = sqrt(p_generic);
+	algorithm::SolnCont<Vec<dbl>> generic_solutions(2, Vec<dbl>(1));
+	generic_solutions[0](0) = r;
+	generic_solutions[1](0) = -r;
+
+	algorithm::ParameterHomotopy<TrackerT, EndgameT> ph(homotopy, generic_solutions);
+
+	auto conf = ph.Get<algorithm::ParameterHomotopyConfig>();
+	conf.num_threads = 2;
+	ph.Set(conf);
+
+	std::vector<Vec<dbl>> params(3, Vec<dbl>(1));
+	params[0](0) = dbl(4);
+	params[1](0) = dbl(9);
+	params[2](0) = dbl(-1);
+
+	// twice, to check that the workers are reused correctly
+	for (int run = 0; run < 2; ++run)
+	{
+		auto results = ph.Solve(params);
+
+		BOOST_REQUIRE_EQUAL(results.size(), 3);
+		for (const auto& res : results)
+		{
+			BOOST_REQUIRE_EQUAL(res.solutions.size(), 2);
+			for (decltype(res.solutions.size()) ii{0}; ii<2; ++ii)
+			{
+				BOOST_CHECK(res.metadata[ii].endgame_success==SuccessCode::Success);
+				auto z = res.solutions[ii](0);
+				BOOST_CHECK_SMALL(abs(z*z - res.parameter_values(0)), 1e-10);
+			}
+			// the two paths go to the two different roots
+			BOOST_CHECK_SMALL(abs(res.solutions[0](0) + res.solutions[1](0)), 1e-10);
+		}
+	}
+
+	auto single = ph.Solve(params[1]);
+	BOOST_CHECK_SMALL(abs(single.solutions[0](0)*single.solutions[0](0) - dbl(9)), 1e-10);
+
+	// down to one worker, through the blackbox entry point
+	conf.num_threads = 1;
+	ph.Set(conf);
+	ph.SetTargetParameterValues(params);
+	ph.Run();
+
+	BOOST_REQUIRE_EQUAL(ph.Results().size(), 3);
+	for (const auto& res : ph.Results())
+		for (decltype(res.solutions.size()) ii{0}; ii<2; ++ii)
+			BOOST_CHECK_SMALL(abs(res.solutions[ii](0)*res.solutions[ii](0) - res.parameter_values(0)), 1e-10);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(needs_implicit_parameters)
+{
+	using namespace bertini;
+
+	auto x = MakeVariable("x");
+	auto t = MakeVariable("t");
+
+	System homotopy;
+	homotopy.AddFunction(x*x - t);
+	homotopy.AddVariableGroup(VariableGroup{x});
+	homotopy.AddPathVariable(t);
+
+	algorithm::SolnCont<Vec<dbl>> generic_solutions(1, Vec<dbl>::Ones(1));
+
+	using PH = algorithm::ParameterHomotopy<TrackerT, EndgameT>;
+	BOOST_CHECK_THROW(PH(homotopy, generic_solutions), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
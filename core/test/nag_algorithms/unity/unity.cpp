@@ -3,6 +3,7 @@
 
 #include "test/nag_algorithms/nag_algorithms_test.cpp"
 #include "test/nag_algorithms/numerical_irreducible_decomposition.cpp"
+#include "test/nag_algorithms/parameter_homotopy.cpp"
 #include "test/nag_algorithms/trace.cpp"
 #include "test/nag_algorithms/zero_dim.cpp"
 
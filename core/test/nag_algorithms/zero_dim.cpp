@@ -33,6 +33,11 @@
 #include <boost/test/unit_test.hpp>
 #include "bertini2/nag_algorithms/output.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <sstream>
+
 
 BOOST_AUTO_TEST_SUITE(zero_dim)
 
@@ -188,4 +193,555 @@ BOOST_AUTO_TEST_CASE(reference_managed_systems_GO)
 }
 
 
+
+/**
+Solve with a checkpoint log, then solve again resuming from it.  The second solve makes a fresh gamma and start system, which are replaced by the ones in the log, and should find every path in the log, producing the same solutions without tracking anything.  Resuming a solve of a different system from the log is refused.
+*/
+BOOST_AUTO_TEST_CASE(resume_from_checkpoint)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("zero_dim_%%%%%%%%.b2ck");
+
+	algorithm::CheckpointConfig checkpoint;
+	checkpoint.enabled = true;
+	checkpoint.filename = filename.string();
+	checkpoint.resume = false;
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Set(checkpoint);
+	zd.Solve();
+
+	checkpoint.resume = true;
+	auto resumed = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	resumed.DefaultSetup();
+	resumed.Set(checkpoint);
+
+	resumed.Solve();
+
+	const auto& a = zd.FinalSolutions();
+	const auto& b = resumed.FinalSolutions();
+	BOOST_REQUIRE_EQUAL(a.size(), b.size());
+	for (decltype(a.size()) ii{0}; ii<a.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(resumed.PathProfiles()[ii].counters.steps_accepted, 0);
+		BOOST_CHECK_EQUAL(resumed.PathProfiles()[ii].counters.steps_rejected, 0);
+
+		if (zd.FinalSolutionMetadata()[ii].endgame_success != SuccessCode::Success)
+			continue;
+
+		BOOST_CHECK_EQUAL(resumed.FinalSolutionMetadata()[ii].endgame_success, SuccessCode::Success);
+		BOOST_CHECK_EQUAL((a[ii]-b[ii]).norm(), 0);
+		BOOST_CHECK_EQUAL(zd.FinalSolutionMetadata()[ii].cycle_num, resumed.FinalSolutionMetadata()[ii].cycle_num);
+	}
+
+	auto other = system::Precon::Sphere();
+	auto mismatched = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(other), start_system::TotalDegree>(other);
+	mismatched.DefaultSetup();
+	mismatched.Set(checkpoint);
+	BOOST_CHECK_THROW(mismatched.Solve(), std::runtime_error);
+
+	boost::filesystem::remove(filename);
+}
+
+
+
+/**
+The first run prepares the homotopy and stores it in the cache, the second loads it, so both track the same paths, with the same gamma and patch, and find the same solutions.
+*/
+BOOST_AUTO_TEST_CASE(cached_homotopy_solves_the_same)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("homotopy_cache_%%%%%%%%");
+
+	using ZeroDimT = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree, policy::CachedCloneGiven>;
+
+	auto missed = ZeroDimT(sys, directory.string());
+	missed.DefaultSetup();
+	missed.Solve();
+
+	auto num_entries = std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator());
+	BOOST_CHECK_EQUAL(num_entries, 1);
+
+	auto hit = ZeroDimT(sys, directory.string());
+	hit.DefaultSetup();
+	hit.Solve();
+
+	num_entries = std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator());
+	BOOST_CHECK_EQUAL(num_entries, 1);
+
+	const auto& a = missed.FinalSolutions();
+	const auto& b = hit.FinalSolutions();
+	BOOST_REQUIRE_EQUAL(a.size(), b.size());
+	for (decltype(a.size()) ii{0}; ii<a.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(missed.FinalSolutionMetadata()[ii].endgame_success, hit.FinalSolutionMetadata()[ii].endgame_success);
+		if (missed.FinalSolutionMetadata()[ii].endgame_success != SuccessCode::Success)
+			continue;
+
+		BOOST_CHECK_SMALL((a[ii]-b[ii]).norm(), 1e-10);
+	}
+
+	boost::filesystem::remove_all(directory);
+}
+
+
+
+/**
+A record only partly written, as happens when killed mid-write, should be dropped when the log is re-opened, and the log should continue appending after the last complete record.
+*/
+BOOST_AUTO_TEST_CASE(checkpoint_log_drops_partial_record)
+{
+	using namespace bertini;
+	using algorithm::CheckpointLog;
+	using algorithm::CheckpointRecord;
+	using algorithm::CheckpointRecordKind;
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("partial_%%%%%%%%.b2ck");
+
+	{
+		CheckpointLog log(filename, binary::NumberType::Double, 1, false);
+		binary::Buffer payload;
+		binary::Write(payload, dbl(1,2));
+		log.Append(CheckpointRecordKind::EndgameBoundary, 3, payload);
+		log.Append(CheckpointRecordKind::PostEndgame, 3, payload);
+	}
+
+	auto full_size = boost::filesystem::file_size(filename);
+	boost::filesystem::resize_file(filename, full_size-5);
+
+	CheckpointLog log(filename, binary::NumberType::Double, 1, true);
+	BOOST_CHECK_EQUAL(log.NumRecords(), 1);
+
+	unsigned num_seen = 0;
+	log.Replay([&num_seen](CheckpointRecord const& r)
+	{
+		BOOST_CHECK(r.kind == CheckpointRecordKind::EndgameBoundary);
+		BOOST_CHECK_EQUAL(r.path_index, 3);
+
+		binary::Reader in(r.payload, r.payload+r.payload_size);
+		dbl z;
+		binary::Read(in, z);
+		BOOST_CHECK_EQUAL(z, dbl(1,2));
+		++num_seen;
+	});
+	BOOST_CHECK_EQUAL(num_seen, 1);
+
+	BOOST_CHECK_THROW(CheckpointLog(filename, binary::NumberType::MultiplePrecision, 1, true), std::runtime_error);
+
+	boost::filesystem::remove(filename);
+}
+
+
+/**
+Write the results of a solve in the binary format, and read them back.  The double precision points should come back exactly.
+*/
+BOOST_AUTO_TEST_CASE(binary_output_round_trip)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Solve();
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("zero_dim_%%%%%%%%.b2r");
+	algorithm::output::Binary<decltype(zd)>::All(filename, zd);
+
+	binary::ResultsFile results(filename);
+	BOOST_CHECK(results.NumType() == binary::NumberType::Double);
+	BOOST_CHECK_EQUAL(results.NumVariables(), zd.TargetSystem().VariableOrdering().size());
+
+	const auto& s = zd.FinalSolutions();
+	const auto& m = zd.FinalSolutionMetadata();
+	auto path_index = results.ColumnData<std::int64_t>("path_index");
+	auto cycle_num = results.ColumnData<std::int64_t>("cycle_num");
+	auto residual = results.ColumnData<double>("function_residual");
+	auto points = results.ColumnData<dbl>(binary::columns::Points);
+
+	BOOST_REQUIRE_EQUAL(results.ColumnLength(binary::columns::Points), results.NumPoints()*results.NumVariables());
+
+	for (std::uint64_t ii{0}; ii<results.NumPoints(); ++ii)
+	{
+		auto p = static_cast<decltype(s.size())>(path_index[ii]);
+		BOOST_CHECK_EQUAL(cycle_num[ii], static_cast<std::int64_t>(m[p].cycle_num));
+		BOOST_CHECK_EQUAL(residual[ii], m[p].function_residual);
+
+		auto v = results.Point<dbl>(ii);
+		BOOST_CHECK_EQUAL((v-s[p]).norm(), 0);
+		BOOST_CHECK_EQUAL(points[ii*results.NumVariables()], s[p](0));
+	}
+
+	BOOST_CHECK_THROW(results.ColumnData<double>("path_index"), std::runtime_error);
+
+	boost::filesystem::remove(filename);
+}
+
+
+/**
+The profile of a solve should be the sum of the profiles of its paths, and every tracked path should have done some work.
+*/
+BOOST_AUTO_TEST_CASE(profile_counts_work_on_every_path)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Solve();
+
+	const auto& profiles = zd.PathProfiles();
+	BOOST_REQUIRE_EQUAL(profiles.size(), zd.FinalSolutions().size());
+
+	std::uint64_t steps = 0, factorizations = 0;
+	for (auto const& p : profiles)
+	{
+		BOOST_CHECK(p.counters.steps_accepted > 0);
+		BOOST_CHECK(p.counters.newton_iterations >= p.counters.steps_accepted);
+		BOOST_CHECK(p.counters.lu_factorizations > 0);
+		BOOST_CHECK_EQUAL(p.counters.function_evaluations, p.counters.newton_iterations);
+		BOOST_CHECK(p.pre_endgame_seconds > 0);
+		steps += p.counters.steps_accepted;
+		factorizations += p.counters.lu_factorizations;
+	}
+
+	BOOST_CHECK_EQUAL(zd.Profile().counters.steps_accepted, steps);
+	BOOST_CHECK_EQUAL(zd.Profile().counters.lu_factorizations, factorizations);
+
+	std::stringstream out;
+	algorithm::output::Classic<decltype(zd)>::Profile(out, zd);
+	std::string header, total;
+	std::getline(out, header);
+	std::getline(out, total);
+	BOOST_CHECK_EQUAL(total.substr(0, 6), "total ");
+}
+
+
+
+/**
+With warm starting, paths after the first few start from the learned step size.  The model should hold the successful paths, and the solve should find as many solutions as without it.
+*/
+BOOST_AUTO_TEST_CASE(warm_start_from_path_statistics)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto cold = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	cold.DefaultSetup();
+	cold.Solve();
+	BOOST_CHECK_EQUAL(cold.PathStatisticsModel().NumPaths(), 0);
+
+	algorithm::WarmStartConfig warm_start;
+	warm_start.enabled = true;
+	warm_start.min_num_paths = 2;
+
+	auto warm = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	warm.DefaultSetup();
+	warm.Set(warm_start);
+	warm.Solve();
+
+	auto count_successes = [](auto const& zd, auto code)
+	{
+		unsigned n = 0;
+		for (auto const& m : zd.FinalSolutionMetadata())
+			if (m.*code == SuccessCode::Success)
+				++n;
+		return n;
+	};
+
+	using MetaData = decltype(warm)::SolutionMetaData;
+	auto const& model = warm.PathStatisticsModel();
+	BOOST_CHECK_EQUAL(model.NumPaths(), count_successes(warm, &MetaData::pre_endgame_success));
+	BOOST_CHECK_EQUAL(count_successes(warm, &MetaData::endgame_success), count_successes(cold, &MetaData::endgame_success));
+
+	BOOST_REQUIRE(model.NumPaths() > 0);
+	BOOST_CHECK(model.StepSizeProfile(0) > 0);
+	BOOST_CHECK(model.InitialStepSize(warm_start.step_size_quantile) > 0);
+	BOOST_CHECK_EQUAL(model.InitialPrecision(warm_start.precision_quorum), DoublePrecision());
+}
+
+
+/**
+Scheduled paths, cheap ones in the main loop and expensive ones on a dedicated worker, all come through the endgame, and each is streamed as it does.  The last solution streamed for a path is its final solution.
+*/
+BOOST_AUTO_TEST_CASE(scheduled_paths_stream_solutions)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	algorithm::PathSchedulingConfig scheduling;
+	scheduling.enabled = true;
+	scheduling.num_dedicated_workers = 1;
+	scheduling.dedicated_fraction = 0.5;
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Set(scheduling);
+
+	using ZD = decltype(zd);
+	std::map<ZD::SolnIndT, Vec<dbl>> streamed;
+	unsigned num_streamed = 0;
+	zd.SetSolutionCallback([&](ZD::SolnIndT ind, Vec<dbl> const& solution, ZD::SolutionMetaData const& smd)
+	{
+		BOOST_CHECK_EQUAL(smd.path_index, ind);
+		streamed[ind] = solution;
+		++num_streamed;
+	});
+
+	zd.Solve();
+
+	const auto& solutions = zd.FinalSolutions();
+	const auto& metadata = zd.FinalSolutionMetadata();
+
+	unsigned num_through_endgame = 0;
+	for (decltype(metadata.size()) ii{0}; ii < metadata.size(); ++ii)
+	{
+		BOOST_CHECK(metadata[ii].pre_endgame_success != SuccessCode::NeverStarted);
+		if (metadata[ii].pre_endgame_success != SuccessCode::Success)
+			continue;
+
+		++num_through_endgame;
+		BOOST_CHECK(metadata[ii].endgame_success != SuccessCode::NeverStarted);
+		BOOST_REQUIRE(streamed.count(ii));
+		BOOST_CHECK_EQUAL((streamed[ii] - solutions[ii]).norm(), 0);
+		BOOST_CHECK(zd.PathProfiles()[ii].pre_endgame_seconds > 0);
+	}
+	BOOST_CHECK(num_through_endgame > 0);
+	BOOST_CHECK_EQUAL(streamed.size(), num_through_endgame);
+	BOOST_CHECK(num_streamed >= num_through_endgame);
+
+	std::stringstream file;
+	zd.SetSolutionCallback(algorithm::output::Classic<ZD>::Streamer(file));
+	zd.Solve();
+	BOOST_CHECK(!file.str().empty());
+}
+
+
+
+/**
+Dedicated workers track the expensive paths on their own threads while the solving thread tracks the cheap ones, and end where the same paths end tracked one after another.  A sanitizer build checks the threads share nothing, such as a random number engine.
+*/
+BOOST_AUTO_TEST_CASE(scheduled_paths_on_dedicated_workers_match_serial)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Solve();
+
+	const auto serial_solutions = zd.FinalSolutions();
+	const auto serial_metadata = zd.FinalSolutionMetadata();
+
+	algorithm::PathSchedulingConfig scheduling;
+	scheduling.enabled = true;
+	scheduling.num_dedicated_workers = 2;
+	scheduling.dedicated_fraction = 0.5;
+	zd.Set(scheduling);
+	zd.Solve();
+
+	const auto& solutions = zd.FinalSolutions();
+	const auto& metadata = zd.FinalSolutionMetadata();
+
+	unsigned num_compared = 0;
+	for (decltype(metadata.size()) ii{0}; ii < metadata.size(); ++ii)
+	{
+		if (metadata[ii].endgame_success != SuccessCode::Success || serial_metadata[ii].endgame_success != SuccessCode::Success)
+			continue;
+
+		++num_compared;
+		BOOST_CHECK_SMALL(static_cast<double>((solutions[ii] - serial_solutions[ii]).norm()), 1e-6);
+	}
+	BOOST_CHECK(num_compared > 0);
+}
+
+
+/**
+The point index finds exactly the points within its tolerance.
+*/
+BOOST_AUTO_TEST_CASE(point_index_finds_near_points)
+{
+	using namespace bertini;
+	using dbl = std::complex<double>;
+
+	algorithm::PointIndex<dbl> index(1e-8);
+
+	std::vector<Vec<dbl>> points;
+	for (unsigned ii = 0; ii < 50; ++ii)
+	{
+		Vec<dbl> p(3);
+		p << dbl(1), dbl(std::cos(ii), std::sin(3*ii)), dbl(ii%7, -double(ii%5));
+		points.push_back(p);
+		index.Add(p, ii);
+	}
+
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+	{
+		Vec<dbl> q = points[ii];
+		q(1) += dbl(0, 5e-9);
+		auto near = index.Near(q);
+		BOOST_REQUIRE_EQUAL(near.size(), 1);
+		BOOST_CHECK_EQUAL(near[0], ii);
+
+		q(1) += dbl(0, 1e-8);
+		BOOST_CHECK(!index.Contains(q));
+	}
+
+	BOOST_CHECK(index.Near(Vec<dbl>::Zero(2)).empty());
+}
+
+
+
+/**
+Retracking on a fresh homotopy leaves every path which succeeded, or went to infinity, alone, and marks the solutions of the paths it recovered.
+*/
+BOOST_AUTO_TEST_CASE(gamma_retrack_only_failed_paths)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	algorithm::GammaRetrackConfig retrack;
+	retrack.enabled = true;
+	retrack.max_num_attempts = 2;
+	retrack.num_threads = 2;
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Set(retrack);
+	zd.Solve();
+
+	const auto& results = zd.GammaRetrackResults();
+	const auto& metadata = zd.FinalSolutionMetadata();
+
+	BOOST_CHECK(results.num_homotopies <= retrack.max_num_attempts);
+	BOOST_CHECK_EQUAL(results.num_homotopies==0, results.attempted.empty());
+	BOOST_CHECK_EQUAL(results.recovered.size(), results.new_solutions.size() + results.duplicates.size());
+
+	auto contains = [](auto const& indices, auto ind)
+	{
+		return std::find(indices.begin(), indices.end(), ind) != indices.end();
+	};
+
+	for (decltype(metadata.size()) ii{0}; ii < metadata.size(); ++ii)
+	{
+		const auto& m = metadata[ii];
+		BOOST_CHECK_EQUAL(m.retracked, contains(results.recovered, ii));
+
+		if (m.retracked)
+		{
+			BOOST_CHECK(contains(results.attempted, ii));
+			BOOST_CHECK(m.endgame_success==SuccessCode::Success);
+		}
+		else if (!contains(results.attempted, ii))
+		{
+			const auto code = m.pre_endgame_success==SuccessCode::Success ? m.endgame_success : m.pre_endgame_success;
+			BOOST_CHECK(code==SuccessCode::Success || code==SuccessCode::GoingToInfinity || code==SuccessCode::SecurityMaxNormReached);
+		}
+	}
+}
+
+
+
+/**
+When every path fails, every path is retracked, with the workers tracking at once on their threads.  A sanitizer build checks they share nothing, such as a random number engine.
+*/
+BOOST_AUTO_TEST_CASE(gamma_retrack_on_threads)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	algorithm::GammaRetrackConfig retrack;
+	retrack.enabled = true;
+	retrack.max_num_attempts = 2;
+	retrack.num_threads = 2;
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Set(retrack);
+
+	// too few steps to reach the endgame boundary, on any homotopy
+	auto stepping = zd.GetTracker().Get<SteppingConfig>();
+	stepping.max_num_steps = 2;
+	zd.GetTracker().Set(stepping);
+
+	zd.Solve();
+
+	const auto& results = zd.GammaRetrackResults();
+	const auto& metadata = zd.FinalSolutionMetadata();
+
+	BOOST_CHECK_EQUAL(results.num_homotopies, retrack.max_num_attempts);
+	BOOST_CHECK_EQUAL(results.attempted.size(), metadata.size());
+	BOOST_CHECK(results.recovered.empty());
+	for (const auto& m : metadata)
+	{
+		BOOST_CHECK(m.pre_endgame_success==SuccessCode::MaxNumStepsTaken);
+		BOOST_CHECK(!m.retracked);
+	}
+}
+
+
+/**
+Griewank-Osborn has a triple root at the origin, and its other three paths go to infinity.  Each path is classified finite or not, and the classification doesn't change when paths are stopped early as they head to infinity.
+*/
+BOOST_AUTO_TEST_CASE(paths_classified_finite_or_at_infinity)
+{
+	using namespace bertini;
+	using namespace tracking;
+
+	auto sys = system::Precon::GriewankOsborn();
+
+	auto zd = algorithm::ZeroDim<TrackerT, bertini::endgame::EndgameSelector<TrackerT>::Cauchy, decltype(sys), start_system::TotalDegree>(sys);
+	zd.DefaultSetup();
+	zd.Solve();
+
+	const auto& solutions = zd.FinalSolutions();
+	const auto& metadata = zd.FinalSolutionMetadata();
+
+	std::vector<bool> is_finite;
+	unsigned num_finite = 0;
+	for (decltype(metadata.size()) ii{0}; ii < metadata.size(); ++ii)
+	{
+		const auto& m = metadata[ii];
+		is_finite.push_back(m.is_finite);
+		if (!m.is_finite)
+			continue;
+
+		++num_finite;
+		BOOST_CHECK(m.endgame_success==SuccessCode::Success);
+		BOOST_CHECK_SMALL(static_cast<double>(zd.TargetSystem().DehomogenizePoint(solutions[ii]).norm()), 1e-3);
+	}
+	BOOST_CHECK(num_finite > 0);
+	BOOST_CHECK(num_finite <= 3);
+
+	DivergenceConfig divergence;
+	divergence.enabled = true;
+	zd.GetTracker().Set(divergence);
+	zd.Solve();
+
+	for (decltype(metadata.size()) ii{0}; ii < metadata.size(); ++ii)
+		BOOST_CHECK_EQUAL(zd.FinalSolutionMetadata()[ii].is_finite, bool(is_finite[ii]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
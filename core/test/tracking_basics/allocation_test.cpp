@@ -0,0 +1,260 @@
+//This file is part of Bertini 2.
+//
+//allocation_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//allocation_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with allocation_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015 - 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// dani brake, university of wisconsin eau claire
+
+/**
+\file allocation_test.cpp
+
+\brief Checks that once a tracker has tracked a path, tracking steps make no heap allocations, except a few when the precision changes.
+
+The global operator new is replaced for this test program, to count the allocations made on each thread.  It counts only while a test here holds a CountAllocations, so the other tests in the program are unaffected.  Allocations made by Eigen and mpfr go through malloc, and are not counted.
+*/
+
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <new>
+
+#include "bertini2/trackers/tracker.hpp"
+
+
+namespace {
+	thread_local unsigned long long num_allocations = 0;
+	thread_local bool counting_allocations = false;
+
+	/**
+	Counts allocations on this thread while alive.
+	*/
+	struct CountAllocations
+	{
+		CountAllocations()
+		{
+			counting_allocations = true;
+		}
+
+		~CountAllocations()
+		{
+			counting_allocations = false;
+		}
+	};
+}
+
+void* operator new(std::size_t size)
+{
+	if (counting_allocations)
+		++num_allocations;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+
+BOOST_AUTO_TEST_SUITE(tracker_allocations)
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+using bertini::MakeVariable;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+/**
+Records the number of allocations so far at the start of each step, and the number of precision changes during each step.  The records are reserved ahead, so keeping them doesn't allocate.
+*/
+template<class TrackerT>
+class AllocationsPerStep : public bertini::EventObserver<TrackerT, bertini::detail::TypeList<
+						bertini::tracking::NewStep<TrackerT>, bertini::tracking::PrecisionChanged<TrackerT> > >
+{
+	void Observe(bertini::tracking::NewStep<TrackerT> const& e) override
+	{
+		if (counts.size() < counts.capacity())
+		{
+			counts.push_back(num_allocations);
+			precision_changes.push_back(0);
+		}
+	}
+
+	void Observe(bertini::tracking::PrecisionChanged<TrackerT> const& e) override
+	{
+		if (!precision_changes.empty())
+			++precision_changes.back();
+	}
+
+public:
+	AllocationsPerStep()
+	{
+		counts.reserve(100000);
+		precision_changes.reserve(100000);
+	}
+
+	void Clear()
+	{
+		counts.clear();
+		precision_changes.clear();
+	}
+
+	std::vector<unsigned long long> counts;
+	std::vector<unsigned> precision_changes;
+};
+
+
+BOOST_AUTO_TEST_CASE(double_precision_steps_do_not_allocate)
+{
+	using namespace bertini::tracking;
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	SteppingConfig stepping_preferences;
+	NewtonConfig newton_preferences;
+
+	for (auto predictor : {Predictor::Euler, Predictor::RK4, Predictor::HeunEuler})
+	{
+		DoublePrecisionTracker tracker(sys);
+		tracker.Setup(predictor,
+		              double(1e-5),
+		              double(1e5),
+		              stepping_preferences,
+		              newton_preferences);
+
+		AllocationsPerStep<DoublePrecisionTracker> allocations;
+		tracker.AddObserver(&allocations);
+
+		dbl t_start(1), t_end(0.1);
+		Vec<dbl> start_point(2), end_point;
+		start_point << dbl(1), dbl(1);
+
+		// warm up: the first path may size things, and make the subscription lookups
+		BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==bertini::SuccessCode::Success);
+
+		allocations.Clear();
+		{
+			CountAllocations counting;
+			BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==bertini::SuccessCode::Success);
+		}
+
+		BOOST_REQUIRE(allocations.counts.size() > 2);
+		for (decltype(allocations.counts.size()) ii = 1; ii < allocations.counts.size(); ++ii)
+			BOOST_CHECK_EQUAL(allocations.counts[ii] - allocations.counts[ii-1], 0);
+	}
+}
+
+/**
+The adaptive tracker starts this path in double precision, and raises the precision as the Jacobian becomes singular near t=0.  Steps which don't change precision make no allocations, and steps which do make at most a few per change, however many steps there have been.
+*/
+BOOST_AUTO_TEST_CASE(amp_steps_allocate_only_when_changing_precision)
+{
+	using namespace bertini::tracking;
+	using mpfr = bertini::complex;
+
+	const unsigned allocations_per_change = 32;
+
+	bertini::DefaultPrecision(bertini::DoublePrecision());
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = AMPConfigFrom(sys);
+
+	SteppingConfig stepping_preferences;
+	NewtonConfig newton_preferences;
+
+	AMPTracker tracker(sys);
+	tracker.Setup(Predictor::Euler,
+	              1e-5,
+	              1e5,
+	              stepping_preferences,
+	              newton_preferences);
+	tracker.PrecisionSetup(AMP);
+
+	AllocationsPerStep<AMPTracker> allocations;
+	tracker.AddObserver(&allocations);
+
+	mpfr t_start(1), t_end(0);
+	Vec<mpfr> start_point(2), end_point;
+	start_point << mpfr(1), mpfr(1);
+
+	// warm up: the first path sizes the workspaces at each precision it visits
+	BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==bertini::SuccessCode::Success);
+
+	allocations.Clear();
+	{
+		CountAllocations counting;
+		BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==bertini::SuccessCode::Success);
+	}
+
+	BOOST_REQUIRE(allocations.counts.size() > 2);
+
+	unsigned num_changes = 0;
+	for (decltype(allocations.counts.size()) ii = 1; ii < allocations.counts.size(); ++ii)
+	{
+		num_changes += allocations.precision_changes[ii-1];
+		BOOST_CHECK_LE(allocations.counts[ii] - allocations.counts[ii-1], allocations_per_change * allocations.precision_changes[ii-1]);
+	}
+	BOOST_CHECK(num_changes > 0);
+
+	bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
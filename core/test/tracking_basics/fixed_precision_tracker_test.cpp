@@ -158,6 +158,60 @@ BOOST_AUTO_TEST_CASE(multiple_100_tracker_track_linear)
 
 
 
+// the path of t*x-1 is x=1/t, going to infinity as t goes to 0.  homogenized, it is [h:x] = [t:1], so the homogenizing ratio is t.
+BOOST_AUTO_TEST_CASE(double_tracker_stops_early_going_to_infinity)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = MakeVariable("x");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x};
+
+	sys.AddFunction(t*x-1);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	SteppingConfig stepping_preferences;
+	stepping_preferences.initial_step_size = SteppingConfig::T(1)/SteppingConfig::T(100);
+	stepping_preferences.max_step_size = SteppingConfig::T(1)/SteppingConfig::T(100);
+	NewtonConfig newton_preferences;
+
+	DoublePrecisionTracker tracker(sys);
+	tracker.Setup(Predictor::Euler,
+	              double(1e-5),
+	              double(1e5),
+	              stepping_preferences,
+	              newton_preferences);
+
+	dbl t_start(1), t_end(0);
+	Vec<dbl> start_point(2), end_point;
+	start_point << dbl(1), dbl(1);
+	sys.RescalePointToFitPatchInPlace(start_point);
+	BOOST_CHECK_CLOSE(sys.HomogenizingRatio(start_point), 1.0, 1e-10);
+
+	tracker.TrackPath(end_point, t_start, t_end, start_point);
+	const auto steps_to_threshold = tracker.NumTotalStepsTaken();
+
+	DivergenceConfig divergence;
+	divergence.enabled = true;
+	divergence.ratio_threshold = 0.5;
+	divergence.window = 4;
+	tracker.Set(divergence);
+
+	auto code = tracker.TrackPath(end_point, t_start, t_end, start_point);
+	BOOST_CHECK(code==bertini::SuccessCode::GoingToInfinity);
+	BOOST_CHECK(tracker.NumTotalStepsTaken() < steps_to_threshold);
+
+	BOOST_REQUIRE_EQUAL(end_point.size(),2);
+	BOOST_CHECK(sys.HomogenizingRatio(end_point) < divergence.ratio_threshold);
+}
+
 
 
 
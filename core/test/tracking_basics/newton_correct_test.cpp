@@ -49,6 +49,7 @@ using Var = std::shared_ptr<Variable>;
 
 using VariableGroup = bertini::VariableGroup;
 using NewtonCorrector = bertini::tracking::correct::NewtonCorrector;
+using JacobianSolver = bertini::tracking::JacobianSolver;
 
 
 
@@ -788,6 +789,135 @@ BOOST_AUTO_TEST_CASE(circle_line_one_corrector_step_double)
 		BOOST_CHECK(success_code==bertini::SuccessCode::FailedToConverge);
 	}
 
+	/*
+	A square homotopy in which each function involves three of the n variables, so its Jacobian is sparse.
+	*/
+	System SparseChain(unsigned n)
+	{
+		VariableGroup x;
+		for (unsigned ii = 0; ii < n; ++ii)
+			x.push_back(MakeVariable("x" + std::to_string(ii)));
+
+		Var t = MakeVariable("t");
+
+		System sys;
+		sys.AddVariableGroup(x);
+		sys.AddPathVariable(t);
+		for (unsigned ii = 0; ii < n; ++ii)
+			sys.AddFunction(pow(x[ii],2) + 3*x[(ii+1)%n] - x[(ii+7)%n] - 2*t);
+		return sys;
+	}
+
+
+	BOOST_AUTO_TEST_CASE(jacobian_solver_sparse_matches_dense_d)
+	{
+		auto sys = SparseChain(120);
+
+		JacobianSolver sparse(sys);
+		JacobianSolver dense(sys, 1000);
+		BOOST_CHECK(sparse.IsSparse());
+		BOOST_CHECK(!dense.IsSparse());
+		BOOST_CHECK_EQUAL(sparse.NumNonzeros(), 360);
+
+		dbl t(0.5,0.1);
+		Vec<dbl> x = bertini::RandomOfUnits<dbl>(120);
+		Mat<dbl> J = sys.Jacobian(x, t);
+		Vec<dbl> b = bertini::RandomOfUnits<dbl>(120);
+
+		BOOST_CHECK(sparse.Factor(J)==bertini::MatrixSuccessCode::Success);
+		BOOST_CHECK(dense.Factor(J)==bertini::MatrixSuccessCode::Success);
+
+		Vec<dbl> from_sparse = sparse.Solve(b);
+		Vec<dbl> from_dense = dense.Solve(b);
+		BOOST_CHECK_SMALL((from_sparse - from_dense).norm() / from_dense.norm(), 1e-10);
+		BOOST_CHECK_SMALL((J*from_sparse - b).norm(), 1e-10);
+
+		// a second factorization reuses the analysis of the pattern
+		x = bertini::RandomOfUnits<dbl>(120);
+		J = sys.Jacobian(x, t);
+		BOOST_CHECK(sparse.Factor(J)==bertini::MatrixSuccessCode::Success);
+		BOOST_CHECK_SMALL((J*sparse.Solve(b) - b).norm(), 1e-10);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(jacobian_solver_sparse_matches_dense_mp)
+	{
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		auto sys = SparseChain(120);
+
+		JacobianSolver sparse(sys);
+		JacobianSolver dense(sys, 1000);
+		BOOST_CHECK(sparse.IsSparse());
+
+		mpfr t("0.5","0.1");
+		Vec<mpfr> x = bertini::RandomOfUnits<mpfr>(120);
+		Mat<mpfr> J = sys.Jacobian(x, t);
+		Vec<mpfr> b = bertini::RandomOfUnits<mpfr>(120);
+
+		BOOST_CHECK(sparse.Factor(J)==bertini::MatrixSuccessCode::Success);
+		BOOST_CHECK(dense.Factor(J)==bertini::MatrixSuccessCode::Success);
+
+		Vec<mpfr> from_sparse = sparse.Solve(b);
+		Vec<mpfr> from_dense = dense.Solve(b);
+		BOOST_CHECK_SMALL(mpfr_float((from_sparse - from_dense).norm() / from_dense.norm()), mpfr_float("1e-20"));
+
+		// after a change of precision, the sparse factorization keeps its analysis of the pattern, and both factor at the new precision
+		DefaultPrecision(2*TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		sys.precision(2*TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		sparse.ChangePrecision(2*TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		dense.ChangePrecision(2*TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+		t = mpfr("0.5","0.1");
+		x = bertini::RandomOfUnits<mpfr>(120);
+		J = sys.Jacobian(x, t);
+		b = bertini::RandomOfUnits<mpfr>(120);
+
+		BOOST_CHECK(sparse.Factor(J)==bertini::MatrixSuccessCode::Success);
+		BOOST_CHECK(dense.Factor(J)==bertini::MatrixSuccessCode::Success);
+
+		from_sparse = sparse.Solve(b);
+		from_dense = dense.Solve(b);
+		BOOST_CHECK_EQUAL(from_sparse(0).precision(), 2*TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		BOOST_CHECK_EQUAL(from_dense(0).precision(), 2*TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+		BOOST_CHECK_SMALL(mpfr_float((from_sparse - from_dense).norm() / from_dense.norm()), mpfr_float("1e-50"));
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
+
+	BOOST_AUTO_TEST_CASE(jacobian_solver_small_or_dense_systems_stay_dense)
+	{
+		auto sys = SparseChain(20);
+		BOOST_CHECK(!JacobianSolver(sys).IsSparse());
+
+		BOOST_CHECK(!JacobianSolver(SparseChain(120), 100, 0.01).IsSparse());
+	}
+
+
+	BOOST_AUTO_TEST_CASE(newton_step_with_sparse_jacobian_d)
+	{
+		auto sys = SparseChain(120);
+
+		std::shared_ptr<NewtonCorrector> corrector = std::make_shared<NewtonCorrector>(sys);
+		BOOST_CHECK(corrector->UsesSparseJacobian());
+
+		dbl current_time(0.5,0.1);
+		Vec<dbl> current_space = bertini::RandomOfUnits<dbl>(120);
+		Vec<dbl> newton_correction_result;
+		auto success_code = corrector->Correct(newton_correction_result,
+												  sys,
+												  current_space,
+												  current_time,
+												  1e10,
+												  1,
+												  1);
+
+		BOOST_CHECK(success_code==bertini::SuccessCode::Success);
+
+		Vec<dbl> expected = current_space - sys.Jacobian(current_space, current_time).lu().solve(sys.Eval(current_space, current_time));
+		BOOST_CHECK_SMALL((newton_correction_result - expected).norm() / expected.norm(), 1e-10);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
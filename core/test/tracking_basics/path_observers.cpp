@@ -28,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "bertini2/trackers/amp_tracker.hpp"
+#include "bertini2/trackers/fixed_precision_tracker.hpp"
 #include "bertini2/trackers/observers.hpp"
 
 
@@ -232,6 +233,279 @@ BOOST_AUTO_TEST_CASE(union_of_observers)
 
 
 
+template<class TrackerT>
+class StepCounter : public bertini::EventObserver<TrackerT, bertini::detail::TypeList<
+						bertini::tracking::SuccessfulStep<TrackerT>,
+						bertini::tracking::FailedStep<TrackerT> > >
+{
+	void Observe(bertini::tracking::SuccessfulStep<TrackerT> const& e) override
+	{ ++successes; }
+
+	void Observe(bertini::tracking::FailedStep<TrackerT> const& e) override
+	{ ++failures; }
+
+public:
+	unsigned successes = 0, failures = 0;
+};
+
+
+// sees everything, and filters by casting, the way observers did before subscriptions
+template<class TrackerT>
+class CastingStepCounter : public bertini::Observer<TrackerT>
+{
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		++events;
+		if (dynamic_cast<bertini::tracking::SuccessfulStep<TrackerT> const*>(&e))
+			++successes;
+		else if (dynamic_cast<bertini::tracking::FailedStep<TrackerT> const*>(&e))
+			++failures;
+	}
+
+public:
+	unsigned successes = 0, failures = 0, events = 0;
+};
+
+
+BOOST_AUTO_TEST_CASE(subscribed_observers_see_the_same_events_as_casting_ones)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	SteppingConfig stepping_preferences;
+	NewtonConfig newton_preferences;
+
+	tracker.Setup(Predictor::Euler,
+	              	1e-5,
+					1e5,
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+
+	StepCounter<AMPTracker> subscribed;
+	CastingStepCounter<AMPTracker> casting;
+	AMPPathAccumulator<AMPTracker> path_accumulator;
+	bertini::MultiObserver<AMPTracker, StepCounter> glued;
+
+	tracker.AddObserver(&subscribed);
+	tracker.AddObserver(&casting);
+	tracker.AddObserver(&path_accumulator);
+	tracker.AddObserver(&glued);
+
+	start_point << mpfr(1), mpfr(1);
+	tracker.TrackPath(end_point, t_start, t_end, start_point);
+
+	BOOST_CHECK(subscribed.successes > 0);
+	BOOST_CHECK_EQUAL(subscribed.successes, casting.successes);
+	BOOST_CHECK_EQUAL(subscribed.failures, casting.failures);
+	BOOST_CHECK_EQUAL(path_accumulator.Path().size(), subscribed.successes);
+	BOOST_CHECK_EQUAL(std::get<0>(glued.observers_).successes, subscribed.successes);
+	BOOST_CHECK(casting.events > casting.successes + casting.failures);
+
+	// once removed, an observer sees nothing more
+	tracker.RemoveObserver(&subscribed);
+	tracker.TrackPath(end_point, t_start, t_end, start_point);
+	BOOST_CHECK(casting.successes > subscribed.successes);
+}
+
+
+
+
+
+/**
+Record a path into a trace file, read it back, and replay the path against it.  Fixed double precision tracking is deterministic, so the replay should reproduce the trace exactly.
+*/
+BOOST_AUTO_TEST_CASE(trace_record_read_and_replay)
+{
+	using namespace bertini::tracking;
+	namespace trace = bertini::trace;
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	DoublePrecisionTracker tracker(sys);
+	tracker.Setup(Predictor::Euler, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+
+	dbl t_start(1), t_end(0);
+	Vec<dbl> start_point(2), end_point;
+	start_point << dbl(1), dbl(1);
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("path_trace_%%%%%%%%.b2trace");
+	{
+		trace::Writer writer(filename);
+		TraceRecorder<DoublePrecisionTracker> recorder(writer);
+		tracker.AddObserver(&recorder);
+
+		ThisThreadPathIndex() = 7;
+		tracker.TrackPath(end_point, t_start, t_end, start_point);
+		tracker.RemoveObserver(&recorder);
+	}
+
+	auto records = trace::ReadTrace(filename);
+	boost::filesystem::remove(filename);
+
+	auto path = trace::PathRecords(records, 7);
+	BOOST_REQUIRE_EQUAL(path.size(), records.size());
+	BOOST_REQUIRE(path.size() > 2);
+	BOOST_CHECK(path.front().event == trace::EventCode::PathStarted);
+	BOOST_CHECK(path.back().event == trace::EventCode::PathEnded);
+
+	unsigned num_steps = 0;
+	for (auto const& r : path)
+		if (r.event == trace::EventCode::SuccessfulStep || r.event == trace::EventCode::FailedStep)
+			++num_steps;
+	BOOST_CHECK_EQUAL(num_steps, tracker.NumTotalStepsTaken());
+	BOOST_CHECK_EQUAL(path.front().time_real, 1);
+	BOOST_CHECK_EQUAL(path.front().precision, 16);
+
+	TraceReplayer<DoublePrecisionTracker> replayer(path);
+	tracker.AddObserver(&replayer);
+	tracker.TrackPath(end_point, t_start, t_end, start_point);
+	BOOST_CHECK(replayer.Reproduced());
+
+	// tracking to a different end time can't follow the same steps all the way
+	TraceReplayer<DoublePrecisionTracker> other(path);
+	tracker.RemoveObserver(&replayer);
+	tracker.AddObserver(&other);
+	tracker.TrackPath(end_point, t_start, dbl(0.5), start_point);
+	BOOST_CHECK(other.Diverged());
+	BOOST_CHECK(!other.Reproduced());
+}
+
+
+/**
+A ring outlives its writer, as a recorder may.  Once the writer is gone, pushing to the ring, full or not, drops the record rather than waiting forever for a flush.
+*/
+BOOST_AUTO_TEST_CASE(trace_ring_outliving_its_writer_drops_records)
+{
+	namespace trace = bertini::trace;
+
+	auto filename = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("path_trace_%%%%%%%%.b2trace");
+	std::shared_ptr<trace::Ring> ring;
+	{
+		trace::Writer writer(filename, 2, std::chrono::hours(1));
+		ring = writer.NewRing();
+
+		trace::Record r{};
+		r.path = 3;
+		ring->Push(r);
+		ring->Push(r);
+	}
+	BOOST_CHECK(ring->Closed());
+
+	trace::Record r{};
+	for (unsigned ii = 0; ii < 4*ring->Capacity(); ++ii)
+		ring->Push(r);
+
+	auto records = trace::ReadTrace(filename);
+	boost::filesystem::remove(filename);
+	BOOST_CHECK_EQUAL(records.size(), 2);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(async_logging_of_gory_detail)
+{
+	using namespace bertini::tracking;
+	namespace async_logging = bertini::async_logging;
+
+	Var x = MakeVariable("x");
+	Var y = MakeVariable("y");
+	Var t = MakeVariable("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	DoublePrecisionTracker tracker(sys);
+	tracker.Setup(Predictor::Euler, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+
+	dbl t_start(1), t_end(0);
+	Vec<dbl> start_point(2), end_point;
+	start_point << dbl(1), dbl(1);
+
+	std::vector<std::string> messages;
+	{
+		// declared before the logger, so it outlives the messages queued in it
+		async_logging::Category limited("limited");
+		limited.SetRateLimit(1, 2);
+
+		async_logging::AsyncLogger logger(1<<16, std::chrono::milliseconds(50),
+			[&](bertini::severity_level, std::string const& m){ messages.push_back(m); });
+		BOOST_CHECK_THROW(async_logging::AsyncLogger(), std::runtime_error);
+
+		GoryDetailLogger<DoublePrecisionTracker> gory;
+		tracker.AddObserver(&gory);
+		tracker.TrackPath(end_point, t_start, t_end, start_point);
+		tracker.RemoveObserver(&gory);
+
+		// pieces are copied when logged, and formatted later
+		dbl z(1,2);
+		BERTINI_LOG_WARNING(async_logging::categories::General(), "z = ", z);
+		z = dbl(3,4);
+
+		char buffer[16] = "buffer";
+		BERTINI_LOG_WARNING(async_logging::categories::General(), buffer);
+		buffer[0] = 'X';
+
+		for (int ii = 0; ii < 5; ++ii)
+			BERTINI_LOG_WARNING(limited, "limited ", ii);
+	}
+
+	auto count = [&](std::string const& m){ return std::count(messages.begin(), messages.end(), m); };
+
+	BOOST_CHECK_EQUAL(count("z = (1,2)"), 1);
+	BOOST_CHECK_EQUAL(count("buffer"), 1);
+	BOOST_CHECK_EQUAL(count("limited 0"), 1);
+	BOOST_CHECK_EQUAL(count("limited 1"), 1);
+	BOOST_CHECK_EQUAL(count("limited 2"), 0);
+	BOOST_CHECK_EQUAL(count("3 log messages of category limited suppressed by its rate limit"), 1);
+#if BERTINI_LOG_LEVEL <= 0
+	BOOST_CHECK_EQUAL(count("tracking ended"), 1);
+#endif
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
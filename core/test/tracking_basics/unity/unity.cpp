@@ -11,6 +11,7 @@
 #include "test/tracking_basics/newton_correct_test.cpp"
 #include "test/tracking_basics/path_observers.cpp"
 #include "test/tracking_basics/amp_tracker_test.cpp"
+#include "test/tracking_basics/allocation_test.cpp"
 
 
 
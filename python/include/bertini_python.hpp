@@ -40,6 +40,7 @@
 #include "parser_export.hpp"
 #include "tracker_export.hpp"
 #include "endgame_export.hpp"
+#include "results_export.hpp"
 
 #endif
 
@@ -0,0 +1,64 @@
+//This file is part of Bertini 2.
+//
+//python/results_export.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//python/results_export.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with python/results_export.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+//
+//  python/results_export.hpp:  Header file for exposing binary results files to python.
+
+#pragma once
+
+#include "python_common.hpp"
+
+#include <bertini2/io/results_file.hpp>
+
+namespace bertini{
+	namespace python{
+
+		/**
+		 Memory-mapped binary results file
+		 */
+		class ResultsFileVisitor: public def_visitor<ResultsFileVisitor>
+		{
+			friend class def_visitor_access;
+
+		public:
+			template<class PyClass>
+			void visit(PyClass& cl) const;
+
+		private:
+
+			static std::shared_ptr<binary::ResultsFile> Open(std::string const& filename);
+
+			static list Variables(binary::ResultsFile const& self);
+			static list ColumnNames(binary::ResultsFile const& self);
+
+			static object ColumnView(binary::ResultsFile const& self, std::string const& name);
+
+			static Vec<dbl> Point(binary::ResultsFile const& self, std::uint64_t index);
+			static Vec<mpfr> PointMP(binary::ResultsFile const& self, std::uint64_t index);
+		};
+
+
+		// now prototypes for expose functions defined in the .cpp files for the python bindings.
+		void ExportResultsFile();
+
+}}// re: namespaces
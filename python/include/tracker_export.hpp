@@ -39,6 +39,10 @@
 
 #include <bertini2/trackers/tracker.hpp>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 namespace bertini{
 	namespace python{
 
@@ -182,7 +186,44 @@ namespace bertini{
 		
 
 		
-		
+
+		/**
+		 The results of tracking a batch of paths.
+
+		 The points are kept in one contiguous buffer, which python gets views of, rather than copies.
+		 */
+		struct TrackedPaths
+		{
+			std::uint64_t num_paths = 0;
+			std::uint64_t num_variables = 0;
+			std::vector<dbl> points; ///< num_paths rows of num_variables coordinates
+			std::vector<std::int32_t> success_codes;
+			tracking::TrackingCounters counters; ///< the work done, summed over the tracking threads
+		};
+
+
+		/**
+		 Tracking many paths at once, in parallel, without the interpreter in the way.
+		 */
+		template<typename TrackerT>
+		class BatchTrackingVisitor: public def_visitor<BatchTrackingVisitor<TrackerT> >
+		{
+			friend class def_visitor_access;
+
+		public:
+			template<class PyClass>
+			void visit(PyClass& cl) const;
+
+			static std::shared_ptr<TrackedPaths> TrackPaths(TrackerT const& self, object const& start_points, dbl const& start_time, dbl const& end_time, unsigned num_threads);
+
+			static std::shared_ptr<TrackedPaths> TrackPathsDefaultThreads(TrackerT const& self, object const& start_points, dbl const& start_time, dbl const& end_time)
+			{
+				return TrackPaths(self, start_points, start_time, end_time, 0);
+			}
+		};
+
+
+
 		/**
 		 Stepping struct
 		 */
@@ -228,6 +269,9 @@ namespace bertini{
 		void ExportFixedTrackers();
 		void ExportFixedDoubleTracker();
 		void ExportFixedMultipleTracker();
+		void ExportTrackedPaths();
+
+		void ExportTrackingCounters();
 		
 		void ExportConfigSettings();
 
@@ -0,0 +1,117 @@
+//This file is part of Bertini 2.
+//
+//python/results_export.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//python/results_export.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with python/results_export.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2017 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+//
+//
+//  python/results_export.cpp:  source file for exposing binary results files to python.
+
+#include "results_export.hpp"
+
+namespace bertini{
+	namespace python{
+
+		std::shared_ptr<binary::ResultsFile> ResultsFileVisitor::Open(std::string const& filename)
+		{
+			return std::make_shared<binary::ResultsFile>(Path(filename));
+		}
+
+		list ResultsFileVisitor::Variables(binary::ResultsFile const& self)
+		{
+			list l;
+			for (const auto& v : self.Variables())
+				l.append(v);
+			return l;
+		}
+
+		list ResultsFileVisitor::ColumnNames(binary::ResultsFile const& self)
+		{
+			list l;
+			for (const auto& c : self.Columns())
+				l.append(c.name);
+			return l;
+		}
+
+		/**
+		Make a read-only memoryview directly onto the mapped column.  Nothing is copied, so wrapping it with numpy.frombuffer gives an array backed by the file.  Complex columns come out as interleaved doubles; use dtype=numpy.complex128 to view them as complex.
+		*/
+		object ResultsFileVisitor::ColumnView(binary::ResultsFile const& self, std::string const& name)
+		{
+			const auto& c = self.Column(name);
+
+			char const* format;
+			switch (c.type)
+			{
+				case binary::ColumnType::Int8: format = "b"; break;
+				case binary::ColumnType::Int32: format = "i"; break;
+				case binary::ColumnType::Int64: format = "q"; break;
+				case binary::ColumnType::Float64: format = "d"; break;
+				case binary::ColumnType::Complex128: format = "d"; break;
+				default: format = "B"; break;
+			}
+
+			object bytes(handle<>(PyMemoryView_FromMemory(const_cast<char*>(self.RawColumnData(name)), static_cast<Py_ssize_t>(c.size), PyBUF_READ)));
+			return bytes.attr("cast")(format);
+		}
+
+		Vec<dbl> ResultsFileVisitor::Point(binary::ResultsFile const& self, std::uint64_t index)
+		{
+			return self.Point<dbl>(index);
+		}
+
+		Vec<mpfr> ResultsFileVisitor::PointMP(binary::ResultsFile const& self, std::uint64_t index)
+		{
+			return self.Point<mpfr>(index);
+		}
+
+
+		template<class PyClass>
+		void ResultsFileVisitor::visit(PyClass& cl) const
+		{
+			cl
+			.def("__init__", make_constructor(&ResultsFileVisitor::Open), "Open and memory-map a binary results file, as written by output::Binary")
+			.def("num_points", &binary::ResultsFile::NumPoints)
+			.def("num_variables", &binary::ResultsFile::NumVariables)
+			.def("variables", &ResultsFileVisitor::Variables, "Get the names of the variables, in the order of the coordinates of the points")
+			.def("column_names", &ResultsFileVisitor::ColumnNames)
+			.def("has_column", &binary::ResultsFile::HasColumn)
+			.def("column", &ResultsFileVisitor::ColumnView, with_custodian_and_ward_postcall<0,1>(), "Get a zero-copy, read-only memoryview of a column.  Use numpy.frombuffer on it to get an array without copying.  The file stays open as long as the view is alive.")
+			.def("point", &ResultsFileVisitor::Point, "Get a point, in double precision")
+			.def("point_mp", &ResultsFileVisitor::PointMP, "Get a point, in multiple precision.  Multiple precision points come back in the precision in which they were computed")
+			;
+		}
+
+
+		void ExportResultsFile()
+		{
+			scope current_scope;
+			std::string new_submodule_name(extract<const char*>(current_scope.attr("__name__")));
+			new_submodule_name.append(".results");
+			object new_submodule(borrowed(PyImport_AddModule(new_submodule_name.c_str())));
+			current_scope.attr("results") = new_submodule;
+
+			scope new_submodule_scope = new_submodule;
+
+			class_<binary::ResultsFile, std::shared_ptr<binary::ResultsFile>, boost::noncopyable>("ResultsFile", no_init)
+			.def(ResultsFileVisitor());
+		}
+
+}} // re: namespaces
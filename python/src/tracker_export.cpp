@@ -100,6 +100,200 @@ namespace bertini{
 		}
 
 
+		namespace {
+
+			/**
+			 Releases the GIL for as long as it lives, so other python threads can run while tracking.
+			 */
+			class ReleaseGIL
+			{
+			public:
+				ReleaseGIL() : state_(PyEval_SaveThread())
+				{}
+
+				~ReleaseGIL()
+				{
+					PyEval_RestoreThread(state_);
+				}
+
+			private:
+				PyThreadState* state_;
+			};
+
+
+			/**
+			 Holds the buffer of a python object, such as a numpy array, releasing it when done.
+			 */
+			class BufferHolder
+			{
+			public:
+				BufferHolder(object const& obj)
+				{
+					if (PyObject_GetBuffer(obj.ptr(), &view_, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+						throw_error_already_set();
+				}
+
+				~BufferHolder()
+				{
+					PyBuffer_Release(&view_);
+				}
+
+				Py_buffer const& View() const
+				{
+					return view_;
+				}
+
+			private:
+				Py_buffer view_;
+			};
+
+
+			/**
+			 Make a read-only memoryview onto memory owned by C++.  The caller is responsible for keeping the owner alive.
+			 */
+			object MakeView(void const* data, std::size_t num_bytes, char const* format, tuple const& shape)
+			{
+				static char empty = 0;
+				object bytes(handle<>(PyMemoryView_FromMemory(num_bytes ? static_cast<char*>(const_cast<void*>(data)) : &empty, static_cast<Py_ssize_t>(num_bytes), PyBUF_READ)));
+				if (num_bytes==0)
+					return bytes.attr("cast")(format);
+				return bytes.attr("cast")(format, shape);
+			}
+
+
+			object PointsView(TrackedPaths const& self)
+			{
+				return MakeView(self.points.data(), self.points.size()*sizeof(dbl), "d", make_tuple(self.num_paths, 2*self.num_variables));
+			}
+
+			object SuccessCodesView(TrackedPaths const& self)
+			{
+				return MakeView(self.success_codes.data(), self.success_codes.size()*sizeof(std::int32_t), "i", make_tuple(self.num_paths));
+			}
+
+
+			dict SecondsAtPrecision(tracking::TrackingCounters const& self)
+			{
+				dict d;
+				for (auto const& p : self.seconds_at_precision)
+					d[p.first] = p.second;
+				return d;
+			}
+
+			tracking::TrackingCounters ThisThreadCountersCopy()
+			{
+				return tracking::ThisThreadCounters();
+			}
+
+		} // namespace
+
+
+
+		template<typename TrackerT>
+		std::shared_ptr<TrackedPaths> BatchTrackingVisitor<TrackerT>::TrackPaths(TrackerT const& self, object const& start_points, dbl const& start_time, dbl const& end_time, unsigned num_threads)
+		{
+			BufferHolder buffer(start_points);
+			const auto& view = buffer.View();
+
+			const auto num_vars = static_cast<std::uint64_t>(self.GetSystem().NumVariables());
+
+			if (view.ndim!=2 || view.itemsize!=sizeof(dbl) || !view.format || std::string(view.format).find("Zd")==std::string::npos)
+				throw std::runtime_error("start points must be a two-dimensional, C-contiguous array of complex128, with one start point per row");
+			if (static_cast<std::uint64_t>(view.shape[1])!=num_vars)
+				throw std::runtime_error("start points must have as many columns as the tracked system has variables");
+
+			auto result = std::make_shared<TrackedPaths>();
+			const auto num_paths = static_cast<std::uint64_t>(view.shape[0]);
+			result->num_paths = num_paths;
+			result->num_variables = num_vars;
+			result->points.resize(num_paths*num_vars);
+			result->success_codes.assign(num_paths, static_cast<std::int32_t>(SuccessCode::NeverStarted));
+
+			auto starts = static_cast<dbl const*>(view.buf);
+
+			if (num_threads==0)
+				num_threads = std::max(1u, std::thread::hardware_concurrency());
+			num_threads = static_cast<unsigned>(std::max<std::uint64_t>(1, std::min<std::uint64_t>(num_threads, num_paths)));
+
+			std::vector<std::exception_ptr> errors(num_threads);
+			std::vector<tracking::TrackingCounters> counters(num_threads);
+			{
+				ReleaseGIL no_gil;
+
+				// evaluating a system is not thread safe, so each thread gets its own deep copy, and a tracker set up like this one.
+				// they are made here, before the threads start, as copying a system walks it.
+				std::vector<System> systems;
+				systems.reserve(num_threads);
+				std::vector<std::unique_ptr<TrackerT>> trackers;
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+				{
+					systems.push_back(Clone(self.GetSystem()));
+					trackers.push_back(std::make_unique<TrackerT>(systems.back()));
+					trackers.back()->SetupLike(self);
+				}
+
+				std::atomic<std::uint64_t> next_path{0};
+
+				auto work = [&](unsigned thread_index)
+				{
+					try
+					{
+						auto& tracker = *trackers[thread_index];
+
+						const auto counters_before = tracking::ThisThreadCounters();
+
+						Vec<dbl> start(num_vars), end;
+						for (auto ii = next_path++; ii < num_paths; ii = next_path++)
+						{
+							std::copy(starts + ii*num_vars, starts + (ii+1)*num_vars, start.data());
+							tracking::ThisThreadPathIndex() = ii;
+
+							auto code = tracker.TrackPath(end, start_time, end_time, start);
+
+							result->success_codes[ii] = static_cast<std::int32_t>(code);
+							if (static_cast<std::uint64_t>(end.size())==num_vars)
+								std::copy(end.data(), end.data()+num_vars, result->points.begin() + ii*num_vars);
+						}
+
+						counters[thread_index] = tracking::ThisThreadCounters() - counters_before;
+					}
+					catch (...)
+					{
+						errors[thread_index] = std::current_exception();
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					threads.emplace_back(work, ii);
+				for (auto& t : threads)
+					t.join();
+			}
+
+			// rethrow only once we have the GIL back
+			for (auto const& e : errors)
+				if (e)
+					std::rethrow_exception(e);
+
+			for (auto const& c : counters)
+				result->counters += c;
+
+			return result;
+		}
+
+
+		template<typename TrackerT>
+		template<class PyClass>
+		void BatchTrackingVisitor<TrackerT>::visit(PyClass& cl) const
+		{
+			cl
+			.def("track_paths", &BatchTrackingVisitor<TrackerT>::TrackPathsDefaultThreads, "Track many paths at once, in parallel, from start time to end time.  The start points are a C-contiguous numpy array of complex128, one start point per row.  The GIL is released while tracking.")
+			.def("track_paths", &BatchTrackingVisitor<TrackerT>::TrackPaths, "Track many paths at once, as above, using the given number of threads.  0 means use one per core.")
+			;
+		}
+
+
+
 		template<typename T>
 		template<class PyClass>
 		void SteppingVisitor<T>::visit(PyClass& cl) const
@@ -132,6 +326,8 @@ namespace bertini{
 			scope new_submodule_scope = new_submodule;
 			
 			ExportConfigSettings();
+			ExportTrackingCounters();
+			ExportTrackedPaths();
 			ExportAMPTracker();
 			ExportFixedTrackers();
 		}
@@ -155,9 +351,43 @@ namespace bertini{
 			class_<DoublePrecisionTracker, std::shared_ptr<DoublePrecisionTracker> >("DoublePrecisionTracker", init<const System&>())
 			.def(TrackerVisitor<DoublePrecisionTracker>())
 			.def(FixedDoubleTrackerVisitor<DoublePrecisionTracker>())
+			.def(BatchTrackingVisitor<DoublePrecisionTracker>())
 			;
 		}
 
+		void ExportTrackedPaths()
+		{
+			class_<TrackedPaths, std::shared_ptr<TrackedPaths>, boost::noncopyable>("TrackedPaths", no_init)
+			.def_readonly("num_paths", &TrackedPaths::num_paths)
+			.def_readonly("num_variables", &TrackedPaths::num_variables)
+			.def("points", &PointsView, with_custodian_and_ward_postcall<0,1>(), "Get a zero-copy, read-only view of the endpoints, as a memoryview of doubles with real and imaginary parts interleaved.  numpy.asarray(r.points()).view(numpy.complex128) is a num_paths by num_variables complex array sharing memory with the results.")
+			.def("success_codes", &SuccessCodesView, with_custodian_and_ward_postcall<0,1>(), "Get a zero-copy, read-only view of the SuccessCode of each path, as integers.")
+			.def_readonly("counters", &TrackedPaths::counters, "The work done tracking the paths, summed over the threads.")
+			;
+		}
+
+		void ExportTrackingCounters()
+		{
+			using tracking::TrackingCounters;
+
+			class_<TrackingCounters>("TrackingCounters", "Counts of the work done while tracking.  Times are wall times in seconds.")
+			.def_readonly("steps_accepted", &TrackingCounters::steps_accepted)
+			.def_readonly("steps_rejected", &TrackingCounters::steps_rejected)
+			.def_readonly("newton_iterations", &TrackingCounters::newton_iterations)
+			.def_readonly("function_evaluations", &TrackingCounters::function_evaluations)
+			.def_readonly("jacobian_evaluations", &TrackingCounters::jacobian_evaluations)
+			.def_readonly("time_derivative_evaluations", &TrackingCounters::time_derivative_evaluations)
+			.def_readonly("lu_factorizations", &TrackingCounters::lu_factorizations)
+			.def_readonly("precision_changes", &TrackingCounters::precision_changes)
+			.def_readonly("refinement_seconds", &TrackingCounters::refinement_seconds)
+			.def("seconds_at_precision", &SecondsAtPrecision, "Get the wall time spent at each precision, as a dict from digits to seconds.")
+			.def(self - self)
+			.def(self += self)
+			;
+
+			def("thread_counters", &ThisThreadCountersCopy, "Get a copy of the tracking counters of the calling thread.  Subtract an earlier copy from a later one to measure the work done between them.");
+		}
+
 		void ExportFixedMultipleTracker()
 		{
 			class_<MultiplePrecisionTracker, std::shared_ptr<MultiplePrecisionTracker> >("MultiplePrecisionTracker", init<const System&>())
@@ -0,0 +1,97 @@
+# This file is part of Bertini 2.
+# 
+# python/test/tracking/batch_tracking_test.py is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# python/test/tracking/batch_tracking_test.py is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with python/test/tracking/batch_tracking_test.py.  If not, see <http://www.gnu.org/licenses/>.
+# 
+#  Copyright(C) 2017 by Bertini2 Development Team
+# 
+#  See <http://www.gnu.org/licenses/> for a copy of the license, 
+#  as well as COPYING.  Bertini2 is provided with permitted 
+#  additional terms in the b2/licenses/ directory.
+
+
+from pybertini import *
+from pybertini.function_tree.symbol import *
+from pybertini.function_tree.root import *
+from pybertini.function_tree import *
+from pybertini.tracking import *
+from pybertini.tracking.config import *
+
+import unittest
+import numpy as np
+
+
+class BatchTrackingTest(unittest.TestCase):
+    def setUp(self):
+        self.x = Variable("x");
+        self.y = Variable("y");
+        self.t = Variable("t");
+
+
+    def test_track_paths_linear(self):
+        x = self.x;  y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(x);
+        vars.append(y);
+        s.add_function(x-t);
+        s.add_function(y-2*t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        tracker = DoublePrecisionTracker(s);
+        tracker.setup(Predictor.RK4, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+
+        num_paths = 10;
+        starts = np.tile(np.array([1, 2], dtype=np.complex128), (num_paths, 1));
+
+        result = tracker.track_paths(starts, complex(1), complex(0.5), 2);
+
+        self.assertEqual(result.num_paths, num_paths);
+        self.assertEqual(result.num_variables, 2);
+
+        codes = np.asarray(result.success_codes());
+        points = np.asarray(result.points()).view(np.complex128);
+
+        self.assertEqual(points.shape, (num_paths, 2));
+        self.assertTrue(np.all(codes == int(SuccessCode.Success)));
+        self.assertTrue(np.allclose(points, np.array([0.5, 1.0])));
+
+        counters = result.counters;
+        self.assertGreaterEqual(counters.steps_accepted, num_paths);
+        self.assertGreaterEqual(counters.newton_iterations, counters.steps_accepted);
+        self.assertGreater(counters.lu_factorizations, 0);
+        self.assertEqual(counters.precision_changes, 0);
+
+
+    def test_track_paths_rejects_wrong_shape(self):
+        x = self.x;  t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(x);
+        s.add_function(x-t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        tracker = DoublePrecisionTracker(s);
+        tracker.setup(Predictor.RK4, 1e-5, 1e5, SteppingConfig(), NewtonConfig());
+
+        with self.assertRaises(Exception):
+            tracker.track_paths(np.zeros((3, 2), dtype=np.complex128), complex(1), complex(0));
+
+
+
+if __name__ == '__main__':
+    unittest.main();